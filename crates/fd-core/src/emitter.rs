@@ -1,15 +1,33 @@
 //! Emitter: SceneGraph → FD text format.
 //!
 //! Produces minimal, token-efficient output that round-trips through the parser.
+//!
+//! [`emit_document_with_spans`] also records where each node's block landed,
+//! so later edits to a few nodes can be re-emitted in place with
+//! [`patch_nodes`] instead of regenerating the whole document.
 
 use crate::id::NodeId;
 use crate::model::*;
 use petgraph::graph::NodeIndex;
+use std::collections::{HashMap, HashSet};
 use std::fmt::Write;
+use std::ops::Range;
 
 /// Emit a `SceneGraph` as an FD text document.
 #[must_use]
 pub fn emit_document(graph: &SceneGraph) -> String {
+    emit_document_inner(graph, None)
+}
+
+/// Emit a `SceneGraph` and the byte span of every node block in the output.
+#[must_use]
+pub fn emit_document_with_spans(graph: &SceneGraph) -> (String, NodeSpans) {
+    let mut spans = NodeSpans::new();
+    let text = emit_document_inner(graph, Some(&mut spans));
+    (text, spans)
+}
+
+fn emit_document_inner(graph: &SceneGraph, mut spans: Option<&mut NodeSpans>) -> String {
     let mut out = String::with_capacity(1024);
 
     // Count sections to decide if separators add value
@@ -51,7 +69,7 @@ pub fn emit_document(graph: &SceneGraph) -> String {
         out.push_str("# ─── Layout ───\n\n");
     }
     for child_idx in &children {
-        emit_node(&mut out, graph, *child_idx, 0);
+        emit_node(&mut out, graph, *child_idx, 0, spans.as_deref_mut());
         out.push('\n');
     }
 
@@ -139,8 +157,15 @@ fn emit_style_block(out: &mut String, name: &NodeId, style: &Style, depth: usize
     out.push_str("}\n");
 }
 
-fn emit_node(out: &mut String, graph: &SceneGraph, idx: NodeIndex, depth: usize) {
+fn emit_node(
+    out: &mut String,
+    graph: &SceneGraph,
+    idx: NodeIndex,
+    depth: usize,
+    mut spans: Option<&mut NodeSpans>,
+) {
     let node = &graph.graph[idx];
+    let start = out.len();
 
     // Emit preserved `# comment` lines before the node declaration
     for comment in &node.comments {
@@ -173,7 +198,7 @@ fn emit_node(out: &mut String, graph: &SceneGraph, idx: NodeIndex, depth: usize)
     // is visible first. Visual styling comes at the tail for clean folding.
     let children = graph.children(idx);
     for child_idx in &children {
-        emit_node(out, graph, *child_idx, depth + 1);
+        emit_node(out, graph, *child_idx, depth + 1, spans.as_deref_mut());
     }
 
     // Group is purely organizational — no layout mode emission
@@ -318,6 +343,135 @@ fn emit_node(out: &mut String, graph: &SceneGraph, idx: NodeIndex, depth: usize)
 
     indent(out, depth);
     out.push_str("}\n");
+
+    if let Some(spans) = spans {
+        spans.insert(idx, start..out.len());
+    }
+}
+
+// ─── In-place patches ────────────────────────────────────────────────────
+
+/// Byte range of each node's block in emitted text, from its leading
+/// `# comment` lines through its closing `}` and newline.
+pub type NodeSpans = HashMap<NodeIndex, Range<usize>>;
+
+/// Replacement of `range` (bytes of the text it applies to) with `text`.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct TextPatch {
+    pub range: Range<usize>,
+    pub text: String,
+}
+
+impl TextPatch {
+    /// Apply the patch to `text`.
+    pub fn apply(&self, text: &mut String) {
+        text.replace_range(self.range.clone(), &self.text);
+    }
+
+    /// Merge patches that were applied one after another into a single
+    /// patch against the text before the first of them. `text` is the text
+    /// after the last one. No patches gives an empty patch at 0.
+    #[must_use]
+    pub fn coalesce(patches: &[TextPatch], text: &str) -> TextPatch {
+        // (lo, hi) bounds every change so far in the current text; `grow` is
+        // how much longer that window is than the original it replaced.
+        let mut window: Option<(usize, usize, isize)> = None;
+        for patch in patches {
+            let delta = patch.text.len() as isize - patch.range.len() as isize;
+            let Range { start, end } = patch.range;
+            window = Some(match window {
+                None => (start, start + patch.text.len(), delta),
+                Some((lo, hi, grow)) => (
+                    lo.min(start),
+                    (hi.max(end) as isize + delta) as usize,
+                    grow + delta,
+                ),
+            });
+        }
+        match window {
+            Some((lo, hi, grow)) => TextPatch {
+                range: lo..(hi as isize - grow) as usize,
+                text: text[lo..hi].to_string(),
+            },
+            None => TextPatch {
+                range: 0..0,
+                text: String::new(),
+            },
+        }
+    }
+}
+
+/// Re-emit the blocks of `nodes` in place.
+///
+/// `text` and `spans` must come from [`emit_document_with_spans`] (or an
+/// earlier call to this function). Only changes confined to each node's own
+/// block are representable: structure, edges, styles and non-`Position`
+/// constraints must be unchanged. Nodes nested inside another listed node
+/// are covered by their ancestor's block.
+///
+/// Returns the patches applied, in order, or `None` if a node has no span
+/// (the caller should re-emit the whole document). `text` may already be
+/// partially patched in that case.
+pub fn patch_nodes(
+    graph: &SceneGraph,
+    text: &mut String,
+    spans: &mut NodeSpans,
+    nodes: &HashSet<NodeIndex>,
+) -> Option<Vec<TextPatch>> {
+    let has_listed_ancestor = |idx: NodeIndex| {
+        let mut cur = graph.parent(idx);
+        while let Some(p) = cur {
+            if nodes.contains(&p) {
+                return true;
+            }
+            cur = graph.parent(p);
+        }
+        false
+    };
+
+    let mut patches = Vec::new();
+    for &idx in nodes {
+        if !graph.graph.contains_node(idx) || has_listed_ancestor(idx) {
+            continue;
+        }
+        let old = spans.get(&idx)?.clone();
+
+        let mut depth = 0;
+        let mut cur = graph.parent(idx)?;
+        while cur != graph.root {
+            depth += 1;
+            cur = graph.parent(cur)?;
+        }
+
+        let mut block = String::with_capacity(old.len());
+        let mut fresh = NodeSpans::new();
+        emit_node(&mut block, graph, idx, depth, Some(&mut fresh));
+
+        // Drop the old subtree, shift what follows, grow enclosing blocks.
+        let delta = block.len() as isize - old.len() as isize;
+        let shift = |pos: usize| (pos as isize + delta) as usize;
+        spans.retain(|_, span| !(span.start >= old.start && span.end <= old.end));
+        for span in spans.values_mut() {
+            if span.start >= old.end {
+                *span = shift(span.start)..shift(span.end);
+            } else if span.end >= old.end {
+                span.end = shift(span.end);
+            }
+        }
+        spans.extend(
+            fresh
+                .into_iter()
+                .map(|(i, span)| (i, span.start + old.start..span.end + old.start)),
+        );
+
+        let patch = TextPatch {
+            range: old,
+            text: block,
+        };
+        patch.apply(text);
+        patches.push(patch);
+    }
+    Some(patches)
 }
 
 fn emit_annotations(out: &mut String, annotations: &[Annotation], depth: usize) {
@@ -2618,4 +2772,99 @@ edge @card_to_label {
         assert!(!out.contains("fill:"), "no fill in edges mode");
         assert!(!out.contains("when"), "no when in edges mode");
     }
+
+    // ─── In-place patches ────────────────────────────────────────────────
+
+    #[test]
+    fn patch_nodes_matches_full_emit() {
+        let input = r#"
+style accent {
+  fill: #6C5CE7
+}
+
+# The card
+group @card {
+  rect @bg {
+    w: 200 h: 100
+    fill: #FFFFFF
+  }
+  text @title "Hello" {
+    x: 10
+  }
+}
+
+ellipse @dot {
+  w: 20 h: 20
+}
+
+@dot -> center_in: card
+
+edge @link {
+  from: @card
+  to: @dot
+}
+"#;
+        let mut graph = parse_document(input).unwrap();
+        let (mut text, mut spans) = emit_document_with_spans(&graph);
+        let card = graph.index_of(NodeId::intern("card")).unwrap();
+        assert!(text[spans[&card].clone()].starts_with("# The card\ngroup @card {"));
+
+        // Grow a nested block and shrink a top-level one
+        let bg = graph.index_of(NodeId::intern("bg")).unwrap();
+        let title = graph.index_of(NodeId::intern("title")).unwrap();
+        if let NodeKind::Rect { width, .. } = &mut graph.graph[bg].kind {
+            *width = 1234.5;
+        }
+        graph.graph[bg].style.opacity = Some(0.5);
+        if let NodeKind::Text { content } = &mut graph.graph[title].kind {
+            *content = "Hi".into();
+        }
+        let dirty = HashSet::from([bg, title]);
+        let patches = patch_nodes(&graph, &mut text, &mut spans, &dirty).unwrap();
+        assert_eq!(patches.len(), 2);
+
+        let (full, full_spans) = emit_document_with_spans(&graph);
+        assert_eq!(text, full);
+        assert_eq!(spans, full_spans);
+
+        // A parent and its child patch as one block
+        graph.graph[title].style.opacity = Some(0.25);
+        let dirty = HashSet::from([card, title]);
+        let patches = patch_nodes(&graph, &mut text, &mut spans, &dirty).unwrap();
+        assert_eq!(patches.len(), 1);
+        assert_eq!(text, emit_document(&graph));
+    }
+
+    #[test]
+    fn coalesced_patch_equals_sequence() {
+        let base = "aaaa bbbb cccc dddd".to_string();
+        let patches = [
+            TextPatch {
+                range: 5..9,
+                text: "BB".into(),
+            },
+            TextPatch {
+                range: 13..17,
+                text: "DDDDDD".into(),
+            },
+            TextPatch {
+                range: 0..1,
+                text: "".into(),
+            },
+        ];
+        let mut text = base.clone();
+        for patch in &patches {
+            patch.apply(&mut text);
+        }
+        assert_eq!(text, "aaa BB cccc DDDDDD");
+
+        let merged = TextPatch::coalesce(&patches, &text);
+        let mut replayed = base.clone();
+        merged.apply(&mut replayed);
+        assert_eq!(replayed, text);
+        assert_eq!(merged.range, 0..19);
+
+        let none = TextPatch::coalesce(&[], &text);
+        assert_eq!((none.range, none.text.as_str()), (0..0, ""));
+    }
 }
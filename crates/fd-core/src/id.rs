@@ -1,6 +1,8 @@
 use lasso::{Spur, ThreadedRodeo};
 use serde::{Deserialize, Deserializer, Serialize, Serializer};
+use std::collections::{HashMap, HashSet};
 use std::fmt;
+use std::hash::{BuildHasherDefault, Hash, Hasher};
 use std::sync::LazyLock;
 
 /// Global string interner for node IDs — fast comparisons, low memory.
@@ -8,9 +10,16 @@ static INTERNER: LazyLock<ThreadedRodeo> = LazyLock::new(ThreadedRodeo::default)
 
 /// A lightweight, interned identifier for nodes in the scene graph.
 /// Internally a `Spur` index — 4 bytes, Copy, Eq, Hash in O(1).
-#[derive(Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Clone, Copy, PartialEq, Eq)]
 pub struct NodeId(Spur);
 
+/// Hashes as its 32-bit symbol, never as the string it names.
+impl Hash for NodeId {
+    fn hash<H: Hasher>(&self, state: &mut H) {
+        state.write_u32(self.0.into_inner().get());
+    }
+}
+
 impl NodeId {
     /// Intern a new string as a NodeId, or return existing if already interned.
     pub fn intern(s: &str) -> Self {
@@ -37,6 +46,44 @@ impl NodeId {
     }
 }
 
+// ─── Symbol-keyed maps ───────────────────────────────────────────────────
+
+/// Hasher for maps keyed by [`NodeId`].
+///
+/// Symbols are small dense integers, so SipHash buys nothing against
+/// collisions here; one multiply by an odd constant is enough. hashbrown
+/// takes the bucket from the low bits (`hash & bucket_mask`) and only the
+/// top 7 for its control byte. Multiplying by an odd number is a bijection
+/// on the low `k` bits, so distinct symbols below `2^k` never share a
+/// bucket in a `2^k`-bucket table, and the multiply also carries into the
+/// top bits that fill the control bytes.
+#[derive(Default, Clone, Copy)]
+pub struct NodeIdHasher(u64);
+
+impl Hasher for NodeIdHasher {
+    fn write_u32(&mut self, n: u32) {
+        self.0 = (self.0 ^ u64::from(n)).wrapping_mul(0x9E37_79B9_7F4A_7C15);
+    }
+
+    fn write(&mut self, bytes: &[u8]) {
+        for &b in bytes {
+            self.write_u32(u32::from(b));
+        }
+    }
+
+    fn finish(&self) -> u64 {
+        self.0
+    }
+}
+
+pub type BuildNodeIdHasher = BuildHasherDefault<NodeIdHasher>;
+
+/// `HashMap` keyed by [`NodeId`], hashing the symbol directly.
+pub type NodeIdMap<V> = HashMap<NodeId, V, BuildNodeIdHasher>;
+
+/// `HashSet` of [`NodeId`], hashing the symbol directly.
+pub type NodeIdSet = HashSet<NodeId, BuildNodeIdHasher>;
+
 impl fmt::Debug for NodeId {
     fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
         write!(f, "@{}", self.as_str())
@@ -57,8 +104,23 @@ impl Serialize for NodeId {
 
 impl<'de> Deserialize<'de> for NodeId {
     fn deserialize<D: Deserializer<'de>>(deserializer: D) -> Result<Self, D::Error> {
-        let s = String::deserialize(deserializer)?;
-        Ok(NodeId::intern(&s))
+        deserializer.deserialize_str(NodeIdVisitor)
+    }
+}
+
+/// Interns straight from the deserializer's buffer when it can lend one,
+/// instead of going through an owned `String`.
+struct NodeIdVisitor;
+
+impl serde::de::Visitor<'_> for NodeIdVisitor {
+    type Value = NodeId;
+
+    fn expecting(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.write_str("a node id string")
+    }
+
+    fn visit_str<E: serde::de::Error>(self, s: &str) -> Result<NodeId, E> {
+        Ok(NodeId::intern(s))
     }
 }
 
@@ -74,6 +136,21 @@ mod tests {
         assert_eq!(a.as_str(), "login_form");
     }
 
+    #[test]
+    fn symbol_maps_key_by_node_id() {
+        let mut map: NodeIdMap<usize> = NodeIdMap::default();
+        for i in 0..1000 {
+            map.insert(NodeId::intern(&format!("sym_{i}")), i);
+        }
+        assert_eq!(map.len(), 1000);
+        assert_eq!(map[&NodeId::intern("sym_417")], 417);
+        assert!(!map.contains_key(&NodeId::intern("sym_1000")));
+
+        let bytes = rmp_serde::to_vec(&NodeId::intern("sym_3")).unwrap();
+        let id: NodeId = rmp_serde::from_slice(&bytes).unwrap();
+        assert_eq!(map[&id], 3);
+    }
+
     #[test]
     fn anonymous_ids_are_unique() {
         let a = NodeId::anonymous("rect");
@@ -5,11 +5,12 @@
 //! layout modes for groups.
 
 use crate::model::*;
+use crate::perf::{self, Counter, Span};
 use petgraph::graph::NodeIndex;
-use std::collections::HashMap;
+use std::collections::HashSet;
 
 /// The canvas (viewport) dimensions.
-#[derive(Debug, Clone, Copy)]
+#[derive(Debug, Clone, Copy, PartialEq)]
 pub struct Viewport {
     pub width: f32,
     pub height: f32,
@@ -27,11 +28,10 @@ impl Default for Viewport {
 /// Resolve all node positions in the scene graph.
 ///
 /// Returns a map from `NodeIndex` → `ResolvedBounds` with absolute positions.
-pub fn resolve_layout(
-    graph: &SceneGraph,
-    viewport: Viewport,
-) -> HashMap<NodeIndex, ResolvedBounds> {
-    let mut bounds: HashMap<NodeIndex, ResolvedBounds> = HashMap::new();
+pub fn resolve_layout(graph: &SceneGraph, viewport: Viewport) -> BoundsMap {
+    let _span = perf::span(Span::Layout);
+    perf::set(Counter::Nodes, graph.graph.node_count() as u64);
+    let mut bounds = BoundsMap::new();
 
     // Root fills the viewport
     bounds.insert(
@@ -58,10 +58,186 @@ pub fn resolve_layout(
     bounds
 }
 
+// ─── Incremental resolution ─────────────────────────────────────────────
+
+/// A subtree re-laid-out by [`resolve_layout_dirty`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+enum Relayout {
+    /// The node and its descendants; the parent uses free layout, so
+    /// siblings are unaffected.
+    Subtree(NodeIndex),
+    /// Every child of a Column/Row/Grid container, whose own bounds are
+    /// unaffected (managed containers use their declared size).
+    Children(NodeIndex),
+}
+
+/// Re-resolve `bounds` after the nodes in `dirty` changed.
+///
+/// `bounds` must hold the result of the previous [`resolve_layout`] for the
+/// same viewport. A dirty node's text, size, style or constraints may have
+/// changed, or it may be newly added. Only the smallest enclosing subtree
+/// whose inputs changed is recomputed:
+///
+/// - group ancestors are included, since they auto-size to their children;
+/// - under a Column/Row/Grid container, all siblings are re-laid-out, since
+///   their positions depend on each other's sizes;
+/// - under any other parent, only the node's own subtree is recomputed.
+///
+/// Nodes with `center_in`/`offset` constraints targeting a recomputed node
+/// are marked dirty in turn. Structural changes (removal, reparenting) and
+/// parents resized by `fill_parent` fall back to a full [`resolve_layout`].
+pub fn resolve_layout_dirty(
+    graph: &SceneGraph,
+    bounds: &mut BoundsMap,
+    dirty: &HashSet<NodeIndex>,
+    viewport: Viewport,
+) {
+    if dirty.contains(&graph.root) || !bounds.contains_key(&graph.root) {
+        *bounds = resolve_layout(graph, viewport);
+        return;
+    }
+
+    let mut pending: Vec<NodeIndex> = dirty
+        .iter()
+        .copied()
+        .filter(|idx| graph.graph.contains_node(*idx))
+        .collect();
+    pending.sort();
+
+    let mut relayouts: Vec<Relayout> = Vec::new();
+    while !pending.is_empty() {
+        for idx in pending.drain(..) {
+            let Some(relayout) = relayout_for(graph, idx) else {
+                *bounds = resolve_layout(graph, viewport);
+                return;
+            };
+            if !relayouts.contains(&relayout) {
+                relayouts.push(relayout);
+            }
+        }
+        relayouts = prune_nested(graph, relayouts);
+
+        // Nodes constrained against anything recomputed move with it.
+        for idx in graph.graph.node_indices() {
+            let depends = graph.graph[idx].constraints.iter().any(|c| {
+                let target = match c {
+                    Constraint::CenterIn(target) if target.as_str() != "canvas" => *target,
+                    Constraint::Offset { from, .. } => *from,
+                    _ => return false,
+                };
+                graph
+                    .index_of(target)
+                    .is_some_and(|t| is_covered(graph, &relayouts, t))
+            });
+            if depends && !is_covered(graph, &relayouts, idx) {
+                pending.push(idx);
+            }
+        }
+    }
+
+    // Same three passes as `resolve_layout`, restricted to the subtrees.
+    // The containing parent's final bounds stand in for its pre-constraint
+    // ones; layout is translation-invariant, and `relayout_for` rejects
+    // parents whose size is changed by a constraint.
+    for &relayout in &relayouts {
+        match relayout {
+            Relayout::Subtree(idx) => {
+                let parent_idx = graph.parent(idx).expect("subtree root has a parent");
+                let only_child = graph.children(parent_idx).len() == 1;
+                let initial = free_child_bounds(graph, parent_idx, idx, only_child, bounds);
+                bounds.insert(idx, initial);
+                resolve_children(graph, idx, bounds, viewport);
+            }
+            Relayout::Children(parent_idx) => {
+                resolve_children(graph, parent_idx, bounds, viewport);
+            }
+        }
+    }
+    for &relayout in &relayouts {
+        for idx in relayout_roots(graph, relayout) {
+            resolve_constraints_top_down(graph, idx, bounds, viewport);
+        }
+    }
+    for &relayout in &relayouts {
+        for idx in relayout_roots(graph, relayout) {
+            recompute_group_auto_sizes(graph, idx, bounds);
+        }
+    }
+}
+
+/// The subtree to recompute when `idx` changed, or `None` if only a full
+/// resolve will do.
+fn relayout_for(graph: &SceneGraph, idx: NodeIndex) -> Option<Relayout> {
+    let mut node_idx = idx;
+    loop {
+        let parent_idx = graph.parent(node_idx)?;
+        let parent = &graph.graph[parent_idx];
+        if parent
+            .constraints
+            .iter()
+            .any(|c| matches!(c, Constraint::FillParent { .. }))
+        {
+            return None;
+        }
+        match &parent.kind {
+            NodeKind::Group => node_idx = parent_idx,
+            NodeKind::Frame { layout, .. } if !matches!(layout, LayoutMode::Free) => {
+                return Some(Relayout::Children(parent_idx));
+            }
+            _ => return Some(Relayout::Subtree(node_idx)),
+        }
+    }
+}
+
+/// Top-level nodes of a relayout, i.e. where the constraint and auto-size
+/// passes start.
+fn relayout_roots(graph: &SceneGraph, relayout: Relayout) -> Vec<NodeIndex> {
+    match relayout {
+        Relayout::Subtree(idx) => vec![idx],
+        Relayout::Children(parent_idx) => graph.children(parent_idx),
+    }
+}
+
+/// Whether `idx` lies inside one of `relayouts`.
+fn is_covered(graph: &SceneGraph, relayouts: &[Relayout], idx: NodeIndex) -> bool {
+    if relayouts.contains(&Relayout::Subtree(idx)) {
+        return true;
+    }
+    let mut cursor = graph.parent(idx);
+    while let Some(ancestor) = cursor {
+        if relayouts.contains(&Relayout::Subtree(ancestor))
+            || relayouts.contains(&Relayout::Children(ancestor))
+        {
+            return true;
+        }
+        cursor = graph.parent(ancestor);
+    }
+    false
+}
+
+/// Drop relayouts already contained in another one.
+fn prune_nested(graph: &SceneGraph, relayouts: Vec<Relayout>) -> Vec<Relayout> {
+    relayouts
+        .iter()
+        .copied()
+        .filter(|relayout| {
+            let others: Vec<Relayout> = relayouts
+                .iter()
+                .copied()
+                .filter(|r| r != relayout)
+                .collect();
+            match *relayout {
+                Relayout::Subtree(idx) => !is_covered(graph, &others, idx),
+                Relayout::Children(parent_idx) => !is_covered(graph, &others, parent_idx),
+            }
+        })
+        .collect()
+}
+
 fn resolve_constraints_top_down(
     graph: &SceneGraph,
     node_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &mut BoundsMap,
     viewport: Viewport,
 ) {
     let node = &graph.graph[node_idx];
@@ -94,11 +270,7 @@ fn is_parent_managed(graph: &SceneGraph, node_idx: NodeIndex) -> bool {
 }
 
 /// Bottom-up re-computation of group auto-sizes after all constraints are applied.
-fn recompute_group_auto_sizes(
-    graph: &SceneGraph,
-    node_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, ResolvedBounds>,
-) {
+fn recompute_group_auto_sizes(graph: &SceneGraph, node_idx: NodeIndex, bounds: &mut BoundsMap) {
     // Recurse into children first (bottom-up)
     for child_idx in graph.children(node_idx) {
         recompute_group_auto_sizes(graph, child_idx, bounds);
@@ -146,7 +318,7 @@ fn recompute_group_auto_sizes(
 fn resolve_children(
     graph: &SceneGraph,
     parent_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &mut BoundsMap,
     viewport: Viewport,
 ) {
     let parent_bounds = bounds[&parent_idx];
@@ -271,50 +443,11 @@ fn resolve_children(
         }
         LayoutMode::Free => {
             // Each child positioned at parent origin by default
+            let only_child = children.len() == 1;
             for &child_idx in &children {
-                let child_size = intrinsic_size(&graph.graph[child_idx]);
-                bounds.insert(
-                    child_idx,
-                    ResolvedBounds {
-                        x: parent_bounds.x,
-                        y: parent_bounds.y,
-                        width: child_size.0,
-                        height: child_size.1,
-                    },
-                );
-            }
-
-            // Auto-center: if parent is a shape with a single text child (no
-            // explicit position), center the text within parent bounds using
-            // its intrinsic size (hug-contents). The renderer's center/middle
-            // alignment handles visual centering within the tight bounds.
-            let parent_is_shape = matches!(
-                parent_node.kind,
-                NodeKind::Rect { .. } | NodeKind::Ellipse { .. } | NodeKind::Frame { .. }
-            );
-            if parent_is_shape && children.len() == 1 {
-                let child_idx = children[0];
-                let child_node = &graph.graph[child_idx];
-                let has_position = child_node
-                    .constraints
-                    .iter()
-                    .any(|c| matches!(c, Constraint::Position { .. }));
-                if matches!(child_node.kind, NodeKind::Text { .. })
-                    && !has_position
-                    && let Some(child_b) = bounds.get(&child_idx).copied()
-                {
-                    let cx = parent_bounds.x + (parent_bounds.width - child_b.width) / 2.0;
-                    let cy = parent_bounds.y + (parent_bounds.height - child_b.height) / 2.0;
-                    bounds.insert(
-                        child_idx,
-                        ResolvedBounds {
-                            x: cx,
-                            y: cy,
-                            width: child_b.width,
-                            height: child_b.height,
-                        },
-                    );
-                }
+                let child_bounds =
+                    free_child_bounds(graph, parent_idx, child_idx, only_child, bounds);
+                bounds.insert(child_idx, child_bounds);
             }
         }
     }
@@ -356,6 +489,53 @@ fn resolve_children(
     }
 }
 
+/// Initial bounds of a child in a free-layout parent: the parent origin at
+/// the child's intrinsic size.
+///
+/// Auto-center: if the parent is a shape with a single text child (no
+/// explicit position), the text is centered within the parent bounds using
+/// its intrinsic size (hug-contents). The renderer's center/middle
+/// alignment handles visual centering within the tight bounds.
+fn free_child_bounds(
+    graph: &SceneGraph,
+    parent_idx: NodeIndex,
+    child_idx: NodeIndex,
+    only_child: bool,
+    bounds: &BoundsMap,
+) -> ResolvedBounds {
+    let parent_bounds = bounds[&parent_idx];
+    let child_node = &graph.graph[child_idx];
+    let (width, height) = intrinsic_size(child_node);
+
+    let parent_is_shape = matches!(
+        graph.graph[parent_idx].kind,
+        NodeKind::Rect { .. } | NodeKind::Ellipse { .. } | NodeKind::Frame { .. }
+    );
+    let has_position = child_node
+        .constraints
+        .iter()
+        .any(|c| matches!(c, Constraint::Position { .. }));
+    let (x, y) = if parent_is_shape
+        && only_child
+        && matches!(child_node.kind, NodeKind::Text { .. })
+        && !has_position
+    {
+        (
+            parent_bounds.x + (parent_bounds.width - width) / 2.0,
+            parent_bounds.y + (parent_bounds.height - height) / 2.0,
+        )
+    } else {
+        (parent_bounds.x, parent_bounds.y)
+    };
+
+    ResolvedBounds {
+        x,
+        y,
+        width,
+        height,
+    }
+}
+
 /// Recursively shift a node and all its descendants by (dx, dy).
 /// Used after pass 2 repositioning to keep subtree positions consistent.
 fn shift_subtree(
@@ -363,7 +543,7 @@ fn shift_subtree(
     node_idx: NodeIndex,
     dx: f32,
     dy: f32,
-    bounds: &mut HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &mut BoundsMap,
 ) {
     if let Some(b) = bounds.get(&node_idx).copied() {
         bounds.insert(
@@ -402,7 +582,7 @@ fn apply_constraint(
     graph: &SceneGraph,
     node_idx: NodeIndex,
     constraint: &Constraint,
-    bounds: &mut HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &mut BoundsMap,
     viewport: Viewport,
 ) {
     let node_bounds = match bounds.get(&node_idx) {
@@ -1176,4 +1356,133 @@ group @form {
             login_btn.width
         );
     }
+
+    // ─── Incremental resolution ──────────────────────────────────────────
+
+    fn assert_matches_full(graph: &SceneGraph, bounds: &BoundsMap) {
+        let full = resolve_layout(graph, Viewport::default());
+        for (idx, expected) in &full {
+            let got = bounds[idx];
+            assert!(
+                (got.x - expected.x).abs() < 0.01
+                    && (got.y - expected.y).abs() < 0.01
+                    && (got.width - expected.width).abs() < 0.01
+                    && (got.height - expected.height).abs() < 0.01,
+                "@{}: incremental {got:?} != full {expected:?}",
+                graph.graph[*idx].id.as_str()
+            );
+        }
+    }
+
+    fn resize(graph: &mut SceneGraph, id: &str, w: f32, h: f32) -> NodeIndex {
+        let node = graph.get_by_id_mut(NodeId::intern(id)).unwrap();
+        if let NodeKind::Rect { width, height } = &mut node.kind {
+            *width = w;
+            *height = h;
+        }
+        graph.index_of(NodeId::intern(id)).unwrap()
+    }
+
+    #[test]
+    fn layout_dirty_reflows_column_only() {
+        let input = r#"
+frame @todo {
+  w: 200 h: 400
+  layout: column gap=8 pad=8
+  rect @card1 { w: 180 h: 40 }
+  rect @card2 { w: 180 h: 40 }
+}
+frame @done {
+  w: 200 h: 400
+  layout: column gap=8 pad=8
+  rect @card3 { w: 180 h: 40 }
+}
+"#;
+        let mut graph = parse_document(input).unwrap();
+        let mut bounds = resolve_layout(&graph, Viewport::default());
+
+        // Poison an unrelated subtree: it must not be recomputed.
+        let card3 = graph.index_of(NodeId::intern("card3")).unwrap();
+        let sentinel = ResolvedBounds {
+            x: -1.0,
+            y: -1.0,
+            width: 1.0,
+            height: 1.0,
+        };
+        bounds.insert(card3, sentinel);
+
+        let card1 = resize(&mut graph, "card1", 180.0, 90.0);
+        resolve_layout_dirty(
+            &graph,
+            &mut bounds,
+            &HashSet::from([card1]),
+            Viewport::default(),
+        );
+
+        let card2 = bounds[&graph.index_of(NodeId::intern("card2")).unwrap()];
+        let todo = bounds[&graph.index_of(NodeId::intern("todo")).unwrap()];
+        assert!((card2.y - (todo.y + 8.0 + 90.0 + 8.0)).abs() < 0.01);
+        assert_eq!(bounds[&card3], sentinel);
+
+        bounds.insert(card3, resolve_layout(&graph, Viewport::default())[&card3]);
+        assert_matches_full(&graph, &bounds);
+    }
+
+    #[test]
+    fn layout_dirty_updates_group_and_dependents() {
+        let input = r#"
+group @stack {
+  rect @a { w: 100 h: 40 x: 10 y: 10 }
+  rect @b { w: 80 h: 30 x: 10 y: 60 }
+}
+rect @badge { w: 20 h: 20 }
+@badge -> center_in: stack
+"#;
+        let mut graph = parse_document(input).unwrap();
+        let mut bounds = resolve_layout(&graph, Viewport::default());
+
+        let a = resize(&mut graph, "a", 300.0, 200.0);
+        resolve_layout_dirty(
+            &graph,
+            &mut bounds,
+            &HashSet::from([a]),
+            Viewport::default(),
+        );
+        assert_matches_full(&graph, &bounds);
+
+        let b = graph.index_of(NodeId::intern("b")).unwrap();
+        graph.graph[b].constraints =
+            smallvec::smallvec![Constraint::Position { x: 400.0, y: 300.0 }];
+        resolve_layout_dirty(
+            &graph,
+            &mut bounds,
+            &HashSet::from([b]),
+            Viewport::default(),
+        );
+        assert_matches_full(&graph, &bounds);
+    }
+
+    #[test]
+    fn layout_dirty_text_in_shape() {
+        let input = r#"
+rect @button {
+  w: 200 h: 60
+  text @label "OK" {}
+}
+"#;
+        let mut graph = parse_document(input).unwrap();
+        let mut bounds = resolve_layout(&graph, Viewport::default());
+
+        let label = graph.index_of(NodeId::intern("label")).unwrap();
+        graph.graph[label].kind = NodeKind::Text {
+            content: "Continue".into(),
+        };
+        resolve_layout_dirty(
+            &graph,
+            &mut bounds,
+            &HashSet::from([label]),
+            Viewport::default(),
+        );
+        assert_matches_full(&graph, &bounds);
+    }
 }
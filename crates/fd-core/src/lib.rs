@@ -5,13 +5,17 @@ pub mod layout;
 pub mod lint;
 pub mod model;
 pub mod parser;
+pub mod perf;
 pub mod resolve;
+pub mod scan;
+pub mod snapshot;
+pub mod stream;
 pub mod transform;
 
-pub use emitter::{ReadMode, emit_filtered};
+pub use emitter::{NodeSpans, ReadMode, TextPatch, emit_filtered};
 pub use format::{FormatConfig, format_document};
 pub use id::NodeId;
-pub use layout::{Viewport, resolve_layout};
+pub use layout::{Viewport, resolve_layout, resolve_layout_dirty};
 pub use lint::{LintDiagnostic, LintSeverity, lint_document};
 pub use model::*;
 pub use transform::{dedup_use_styles, hoist_styles, sort_nodes};
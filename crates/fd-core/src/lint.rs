@@ -3,9 +3,8 @@
 //! Reports structural issues without modifying the document.
 //! Results feed into `textDocument/publishDiagnostics` in the LSP server.
 
-use crate::id::NodeId;
+use crate::id::{NodeId, NodeIdSet};
 use crate::model::SceneGraph;
-use std::collections::HashSet;
 
 // ─── Diagnostic types ────────────────────────────────────────────────────
 
@@ -82,9 +81,9 @@ fn is_anonymous_id(id: &str) -> bool {
 fn lint_duplicate_use(graph: &SceneGraph, diags: &mut Vec<LintDiagnostic>) {
     for idx in graph.graph.node_indices() {
         let node = &graph.graph[idx];
-        let mut seen = HashSet::new();
+        let mut seen = NodeIdSet::default();
         for style_id in &node.use_styles {
-            if !seen.insert(style_id) {
+            if !seen.insert(*style_id) {
                 diags.push(LintDiagnostic {
                     node_id: node.id,
                     message: format!(
@@ -103,7 +102,7 @@ fn lint_duplicate_use(graph: &SceneGraph, diags: &mut Vec<LintDiagnostic>) {
 /// Info when a top-level `style {}` block is defined but never referenced.
 fn lint_unused_styles(graph: &SceneGraph, diags: &mut Vec<LintDiagnostic>) {
     // Collect all style IDs referenced by any node or edge.
-    let mut referenced: HashSet<NodeId> = HashSet::new();
+    let mut referenced = NodeIdSet::default();
 
     for idx in graph.graph.node_indices() {
         for style_id in &graph.graph[idx].use_styles {
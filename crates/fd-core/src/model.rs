@@ -6,7 +6,7 @@
 //! constraint-based — relationships are preferred over raw positions.
 //! `Position { x, y }` is the escape hatch for drag-placed or pinned nodes.
 
-use crate::id::NodeId;
+use crate::id::{NodeId, NodeIdMap};
 use petgraph::graph::NodeIndex;
 use petgraph::stable_graph::StableDiGraph;
 use serde::{Deserialize, Serialize};
@@ -533,10 +533,10 @@ pub struct SceneGraph {
     pub root: NodeIndex,
 
     /// Named theme definitions (`theme base_text { ... }`).
-    pub styles: HashMap<NodeId, Style>,
+    pub styles: NodeIdMap<Style>,
 
     /// Index from NodeId → NodeIndex for fast lookup.
-    pub id_index: HashMap<NodeId, NodeIndex>,
+    pub id_index: NodeIdMap<NodeIndex>,
 
     /// Visual edges (connections between nodes).
     pub edges: Vec<Edge>,
@@ -558,13 +558,13 @@ impl SceneGraph {
         let root_node = SceneNode::new(NodeId::intern("root"), NodeKind::Root);
         let root = graph.add_node(root_node);
 
-        let mut id_index = HashMap::new();
+        let mut id_index = NodeIdMap::default();
         id_index.insert(NodeId::intern("root"), root);
 
         Self {
             graph,
             root,
-            styles: HashMap::new(),
+            styles: NodeIdMap::default(),
             id_index,
             edges: Vec::new(),
             imports: Vec::new(),
@@ -914,6 +914,147 @@ impl ResolvedBounds {
     }
 }
 
+/// Resolved bounds keyed by `NodeIndex`, stored densely by index.
+///
+/// Scene graph indices are small, contiguous integers (the graph is a
+/// `StableDiGraph`, which reuses freed slots), so a `Vec` slot per index
+/// replaces hashing on every lookup in layout, hit testing and rendering.
+/// The API mirrors the subset of `HashMap` the callers use; iteration is in
+/// index order, which is also document order for a freshly parsed file.
+#[derive(Debug, Clone, Default)]
+pub struct BoundsMap {
+    slots: Vec<Option<(NodeIndex, ResolvedBounds)>>,
+    len: usize,
+}
+
+/// Iterator over the entries of a [`BoundsMap`], in index order.
+pub type BoundsIter<'a> = std::iter::Map<
+    std::iter::Flatten<std::slice::Iter<'a, Option<(NodeIndex, ResolvedBounds)>>>,
+    fn(&'a (NodeIndex, ResolvedBounds)) -> (&'a NodeIndex, &'a ResolvedBounds),
+>;
+
+impl BoundsMap {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// An empty map with room for indices below `capacity`.
+    pub fn with_capacity(capacity: usize) -> Self {
+        Self {
+            slots: Vec::with_capacity(capacity),
+            len: 0,
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn get(&self, idx: &NodeIndex) -> Option<&ResolvedBounds> {
+        self.slots.get(idx.index())?.as_ref().map(|(_, b)| b)
+    }
+
+    pub fn get_mut(&mut self, idx: &NodeIndex) -> Option<&mut ResolvedBounds> {
+        self.slots.get_mut(idx.index())?.as_mut().map(|(_, b)| b)
+    }
+
+    pub fn contains_key(&self, idx: &NodeIndex) -> bool {
+        self.get(idx).is_some()
+    }
+
+    /// Set the bounds of `idx`, returning the previous value.
+    pub fn insert(&mut self, idx: NodeIndex, bounds: ResolvedBounds) -> Option<ResolvedBounds> {
+        let i = idx.index();
+        if i >= self.slots.len() {
+            self.slots.resize(i + 1, None);
+        }
+        let old = self.slots[i].replace((idx, bounds)).map(|(_, b)| b);
+        if old.is_none() {
+            self.len += 1;
+        }
+        old
+    }
+
+    pub fn remove(&mut self, idx: &NodeIndex) -> Option<ResolvedBounds> {
+        let old = self.slots.get_mut(idx.index())?.take().map(|(_, b)| b);
+        if old.is_some() {
+            self.len -= 1;
+        }
+        old
+    }
+
+    pub fn clear(&mut self) {
+        self.slots.clear();
+        self.len = 0;
+    }
+
+    /// Keep only the entries for which `keep` returns true.
+    pub fn retain(&mut self, mut keep: impl FnMut(&NodeIndex, &mut ResolvedBounds) -> bool) {
+        for slot in &mut self.slots {
+            if let Some((idx, b)) = slot
+                && !keep(idx, b)
+            {
+                *slot = None;
+                self.len -= 1;
+            }
+        }
+    }
+
+    /// Entries in index order.
+    pub fn iter(&self) -> BoundsIter<'_> {
+        let refs: fn(&(NodeIndex, ResolvedBounds)) -> (&NodeIndex, &ResolvedBounds) =
+            |(idx, b)| (idx, b);
+        self.slots.iter().flatten().map(refs)
+    }
+
+    pub fn keys(&self) -> impl Iterator<Item = &NodeIndex> {
+        self.iter().map(|(idx, _)| idx)
+    }
+
+    pub fn values(&self) -> impl Iterator<Item = &ResolvedBounds> {
+        self.iter().map(|(_, b)| b)
+    }
+}
+
+impl PartialEq for BoundsMap {
+    /// Equal if they hold the same entries, regardless of spare capacity.
+    fn eq(&self, other: &Self) -> bool {
+        self.len == other.len && self.iter().all(|(idx, b)| other.get(idx) == Some(b))
+    }
+}
+
+impl std::ops::Index<&NodeIndex> for BoundsMap {
+    type Output = ResolvedBounds;
+
+    fn index(&self, idx: &NodeIndex) -> &ResolvedBounds {
+        self.get(idx)
+            .unwrap_or_else(|| panic!("no bounds for node {}", idx.index()))
+    }
+}
+
+impl<'a> IntoIterator for &'a BoundsMap {
+    type Item = (&'a NodeIndex, &'a ResolvedBounds);
+    type IntoIter = BoundsIter<'a>;
+
+    fn into_iter(self) -> Self::IntoIter {
+        self.iter()
+    }
+}
+
+impl FromIterator<(NodeIndex, ResolvedBounds)> for BoundsMap {
+    fn from_iter<I: IntoIterator<Item = (NodeIndex, ResolvedBounds)>>(iter: I) -> Self {
+        let mut map = Self::new();
+        for (idx, b) in iter {
+            map.insert(idx, b);
+        }
+        map
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -1162,4 +1303,33 @@ mod tests {
         // Fill should still be present
         assert!(resolved.fill.is_some());
     }
+
+    #[test]
+    fn bounds_map_behaves_like_a_map() {
+        let b = |x: f32| ResolvedBounds {
+            x,
+            y: 0.0,
+            width: 10.0,
+            height: 10.0,
+        };
+        let mut map = BoundsMap::new();
+        assert_eq!(map.insert(NodeIndex::new(5), b(5.0)), None);
+        assert_eq!(map.insert(NodeIndex::new(1), b(1.0)), None);
+        assert_eq!(map.insert(NodeIndex::new(5), b(6.0)), Some(b(5.0)));
+        assert_eq!(map.len(), 2);
+        assert_eq!(map[&NodeIndex::new(5)].x, 6.0);
+        assert!(!map.contains_key(&NodeIndex::new(3)));
+        assert!(map.get(&NodeIndex::new(99)).is_none());
+
+        // Iteration is in index order
+        let keys: Vec<usize> = map.keys().map(|idx| idx.index()).collect();
+        assert_eq!(keys, [1, 5]);
+
+        assert_eq!(map.remove(&NodeIndex::new(1)), Some(b(1.0)));
+        assert_eq!(map.remove(&NodeIndex::new(1)), None);
+        assert_eq!(map.len(), 1);
+
+        let same: BoundsMap = [(NodeIndex::new(5), b(6.0))].into_iter().collect();
+        assert_eq!(map, same);
+    }
 }
@@ -7,6 +7,9 @@
 
 use crate::id::NodeId;
 use crate::model::*;
+use crate::perf::{self, Counter, Span};
+use crate::scan;
+use std::fmt;
 use winnow::ascii::space1;
 use winnow::combinator::{alt, delimited, opt, preceded};
 use winnow::error::ContextError;
@@ -16,14 +19,32 @@ use winnow::token::{take_till, take_while};
 /// Parse an FD document string into a `SceneGraph`.
 #[must_use = "parsing result should be used"]
 pub fn parse_document(input: &str) -> Result<SceneGraph, String> {
+    let _span = perf::span(Span::Parse);
     let mut graph = SceneGraph::new();
+    parse_declarations(&mut graph, input, 1)?;
+    perf::set(Counter::Nodes, graph.graph.node_count() as u64);
+    Ok(graph)
+}
+
+/// Parse the top-level declarations in `input` into `graph`, numbering
+/// lines in error messages from `first_line`. Lets a document be parsed
+/// a piece at a time (see [`crate::stream`]).
+pub(crate) fn parse_declarations(
+    graph: &mut SceneGraph,
+    input: &str,
+    first_line: usize,
+) -> Result<(), String> {
     let mut rest = input;
 
     // Collect any leading comments before the first declaration.
     let mut pending_comments = collect_leading_comments(&mut rest);
 
     while !rest.is_empty() {
-        let line = line_number(input, rest);
+        let line = LineNumber {
+            first_line,
+            full_input: input,
+            remaining: rest,
+        };
         let end = {
             let max = rest.len().min(40);
             // Find a valid UTF-8 char boundary at or before `max`
@@ -58,7 +79,7 @@ pub fn parse_document(input: &str) -> Result<SceneGraph, String> {
                 })?;
                 node_data.comments = std::mem::take(&mut pending_comments);
                 let root = graph.root;
-                insert_node_recursive(&mut graph, root, node_data);
+                insert_node_recursive(graph, root, node_data);
             } else {
                 let (node_id, constraint) = parse_constraint_line
                     .parse_next(&mut rest)
@@ -98,7 +119,7 @@ pub fn parse_document(input: &str) -> Result<SceneGraph, String> {
             })?;
             node_data.comments = std::mem::take(&mut pending_comments);
             let root = graph.root;
-            insert_node_recursive(&mut graph, root, node_data);
+            insert_node_recursive(graph, root, node_data);
         } else {
             // Skip unknown line
             let _ = take_till::<_, _, ContextError>(0.., '\n').parse_next(&mut rest);
@@ -114,16 +135,28 @@ pub fn parse_document(input: &str) -> Result<SceneGraph, String> {
         pending_comments.extend(more);
     }
 
-    Ok(graph)
+    Ok(())
 }
 
-/// Compute the 1-based line number of `remaining` within `full_input`.
-fn line_number(full_input: &str, remaining: &str) -> usize {
-    let consumed = full_input.len() - remaining.len();
-    full_input[..consumed].matches('\n').count() + 1
+/// The 1-based line number of `remaining` within `full_input` (which
+/// starts on `first_line`), counted only when displayed: error messages
+/// need it, successful parses don't, and counting per declaration made
+/// parsing quadratic.
+struct LineNumber<'a> {
+    first_line: usize,
+    full_input: &'a str,
+    remaining: &'a str,
 }
 
-fn starts_with_node_keyword(s: &str) -> bool {
+impl fmt::Display for LineNumber<'_> {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        let consumed = self.full_input.len() - self.remaining.len();
+        let line = self.first_line + scan::count_newlines(&self.full_input.as_bytes()[..consumed]);
+        write!(f, "{line}")
+    }
+}
+
+pub(crate) fn starts_with_node_keyword(s: &str) -> bool {
     s.starts_with("group")
         || s.starts_with("frame")
         || s.starts_with("rect")
@@ -134,7 +167,7 @@ fn starts_with_node_keyword(s: &str) -> bool {
 
 /// Check if input starts with `@identifier` followed by whitespace then `{`.
 /// Distinguishes generic nodes (`@id { }`) from constraint lines (`@id -> ...`).
-fn is_generic_node_start(s: &str) -> bool {
+pub(crate) fn is_generic_node_start(s: &str) -> bool {
     let rest = match s.strip_prefix('@') {
         Some(r) => r,
         None => return false,
@@ -207,7 +240,11 @@ fn collect_leading_comments(input: &mut &str) -> Vec<String> {
     loop {
         // Skip pure whitespace (not newlines that separate nodes)
         let before = *input;
-        *input = input.trim_start();
+        *input = &input[scan::whitespace_run(input.as_bytes())..];
+        // Non-ASCII whitespace is rare enough for the char-wise path
+        if input.as_bytes().first().is_some_and(|b| !b.is_ascii()) {
+            *input = input.trim_start();
+        }
         if input.starts_with('#') {
             // Regular `# comment` — collect it
             let end = input.find('\n').unwrap_or(input.len());
@@ -221,7 +258,9 @@ fn collect_leading_comments(input: &mut &str) -> Vec<String> {
             }
             continue;
         }
-        if *input == before {
+        // Compare positions, not contents: equal-length slices would be
+        // compared byte by byte through the rest of the document
+        if input.len() == before.len() {
             break;
         }
     }
@@ -234,10 +273,9 @@ fn skip_ws_and_comments(input: &mut &str) {
     let _ = collect_leading_comments(input);
 }
 
-/// Consume optional whitespace (concrete error type avoids inference issues).
+/// Consume optional spaces and tabs.
 fn skip_space(input: &mut &str) {
-    use winnow::ascii::space0;
-    let _: Result<&str, winnow::error::ErrMode<ContextError>> = space0.parse_next(input);
+    *input = &input[scan::blank_run(input.as_bytes())..];
 }
 
 fn parse_identifier<'a>(input: &mut &'a str) -> ModalResult<&'a str> {
@@ -252,23 +290,29 @@ fn parse_node_id(input: &mut &str) -> ModalResult<NodeId> {
 
 fn parse_hex_color(input: &mut &str) -> ModalResult<Color> {
     let _ = '#'.parse_next(input)?;
-    let hex_digits: &str = take_while(1..=8, |c: char| c.is_ascii_hexdigit()).parse_next(input)?;
+    let len = scan::hex_run(input.as_bytes()).min(8);
+    if len == 0 {
+        return Err(winnow::error::ErrMode::Backtrack(ContextError::new()));
+    }
+    let (hex_digits, rest) = input.split_at(len);
+    *input = rest;
     Color::from_hex(hex_digits)
         .ok_or_else(|| winnow::error::ErrMode::Backtrack(ContextError::new()))
 }
 
 fn parse_number(input: &mut &str) -> ModalResult<f32> {
-    let start = *input;
-    if input.starts_with('-') {
-        *input = &input[1..];
+    let bytes = input.as_bytes();
+    let sign = usize::from(bytes.first() == Some(&b'-'));
+    let int_len = scan::digit_run(&bytes[sign..]);
+    if int_len == 0 {
+        return Err(winnow::error::ErrMode::Backtrack(ContextError::new()));
     }
-    let _ = take_while(1.., |c: char| c.is_ascii_digit()).parse_next(input)?;
-    if input.starts_with('.') {
-        *input = &input[1..];
-        let _ =
-            take_while::<_, _, ContextError>(0.., |c: char| c.is_ascii_digit()).parse_next(input);
+    let mut end = sign + int_len;
+    if bytes.get(end) == Some(&b'.') {
+        end += 1 + scan::digit_run(&bytes[end + 1..]);
     }
-    let matched = &start[..start.len() - input.len()];
+    let (matched, rest) = input.split_at(end);
+    *input = rest;
     matched
         .parse::<f32>()
         .map_err(|_| winnow::error::ErrMode::Backtrack(ContextError::new()))
@@ -463,7 +507,7 @@ fn parse_font_value(input: &mut &str, style: &mut Style) -> ModalResult<()> {
     }
 
     // Fallback: numeric weight + size
-    if *input == saved
+    if input.len() == saved.len()
         && let Ok(n1) = parse_number.parse_next(input)
     {
         skip_space(input);
@@ -0,0 +1,338 @@
+//! Opt-in timing spans and counters for the hot paths.
+//!
+//! Parse, layout, sync, hit testing and rendering open a [`span`] around
+//! their work and bump [`Counter`]s and [`Cache`] hit/miss pairs as they
+//! go. Everything is off until a host calls [`enable`] with a clock; while
+//! off, each probe is one relaxed atomic load and a branch, and the clock
+//! is never read. Hosts report the totals with [`stats`] (the wasm
+//! `get_perf_stats` export, the LSP `fd/perfStats` request).
+//!
+//! The clock is supplied by the host because `std::time::Instant` is not
+//! available on `wasm32-unknown-unknown`; native hosts pass
+//! [`monotonic_ms`].
+
+use serde::Serialize;
+use std::collections::BTreeMap;
+use std::sync::OnceLock;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+
+/// Milliseconds since an arbitrary, fixed origin.
+static CLOCK: OnceLock<fn() -> f64> = OnceLock::new();
+
+/// Start recording, reading time from `clock` (milliseconds from any fixed
+/// origin). The first clock installed stays in use.
+pub fn enable(clock: fn() -> f64) {
+    let _ = CLOCK.set(clock);
+    ENABLED.store(true, Ordering::Relaxed);
+}
+
+/// Stop recording. Totals so far are kept until [`reset`].
+pub fn disable() {
+    ENABLED.store(false, Ordering::Relaxed);
+}
+
+#[inline]
+pub fn is_enabled() -> bool {
+    ENABLED.load(Ordering::Relaxed)
+}
+
+/// A clock for native hosts: milliseconds since its first call.
+#[cfg(not(target_arch = "wasm32"))]
+pub fn monotonic_ms() -> f64 {
+    static ORIGIN: OnceLock<std::time::Instant> = OnceLock::new();
+    ORIGIN
+        .get_or_init(std::time::Instant::now)
+        .elapsed()
+        .as_secs_f64()
+        * 1000.0
+}
+
+fn now_ms() -> Option<f64> {
+    CLOCK.get().map(|clock| clock())
+}
+
+// ─── Spans ───────────────────────────────────────────────────────────────
+
+/// A timed region of a hot path.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Span {
+    /// `parser::parse_document`.
+    Parse,
+    /// Full `layout::resolve_layout`.
+    Layout,
+    /// `SyncEngine::resolve`, incremental or full.
+    SyncResolve,
+    /// `SyncEngine::flush_to_text`, patched or re-emitted.
+    SyncFlush,
+    /// Point hit tests.
+    HitTest,
+    /// One canvas frame.
+    Render,
+}
+
+impl Span {
+    const ALL: [Span; 6] = [
+        Span::Parse,
+        Span::Layout,
+        Span::SyncResolve,
+        Span::SyncFlush,
+        Span::HitTest,
+        Span::Render,
+    ];
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Span::Parse => "parse",
+            Span::Layout => "layout",
+            Span::SyncResolve => "sync_resolve",
+            Span::SyncFlush => "sync_flush",
+            Span::HitTest => "hit_test",
+            Span::Render => "render",
+        }
+    }
+}
+
+/// Per-span totals, in nanoseconds.
+struct SpanSlot {
+    count: AtomicU64,
+    total_ns: AtomicU64,
+    max_ns: AtomicU64,
+}
+
+static SPANS: [SpanSlot; Span::ALL.len()] = [const {
+    SpanSlot {
+        count: AtomicU64::new(0),
+        total_ns: AtomicU64::new(0),
+        max_ns: AtomicU64::new(0),
+    }
+}; Span::ALL.len()];
+
+/// Time the enclosing scope as `span`: keep the guard alive until the
+/// work is done (`let _span = perf::span(Span::Parse);`).
+#[inline]
+#[must_use = "the span ends when the guard is dropped"]
+pub fn span(span: Span) -> SpanGuard {
+    SpanGuard {
+        span,
+        start: if is_enabled() { now_ms() } else { None },
+    }
+}
+
+/// Records its span's duration when dropped.
+pub struct SpanGuard {
+    span: Span,
+    start: Option<f64>,
+}
+
+impl Drop for SpanGuard {
+    #[inline]
+    fn drop(&mut self) {
+        if let Some(start) = self.start {
+            record_span(self.span, start);
+        }
+    }
+}
+
+fn record_span(span: Span, start: f64) {
+    let Some(end) = now_ms() else {
+        return;
+    };
+    let ns = ((end - start).max(0.0) * 1e6) as u64;
+    let slot = &SPANS[span as usize];
+    slot.count.fetch_add(1, Ordering::Relaxed);
+    slot.total_ns.fetch_add(ns, Ordering::Relaxed);
+    slot.max_ns.fetch_max(ns, Ordering::Relaxed);
+}
+
+// ─── Counters ────────────────────────────────────────────────────────────
+
+/// A running count (or, for [`Counter::Nodes`], the latest value).
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Counter {
+    /// Nodes in the most recently parsed or laid-out graph.
+    Nodes,
+    /// tree-sitter error recoveries while reparsing LSP documents.
+    SyntaxRecoveries,
+}
+
+impl Counter {
+    const ALL: [Counter; 2] = [Counter::Nodes, Counter::SyntaxRecoveries];
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Counter::Nodes => "nodes",
+            Counter::SyntaxRecoveries => "syntax_recoveries",
+        }
+    }
+}
+
+static COUNTERS: [AtomicU64; Counter::ALL.len()] =
+    [const { AtomicU64::new(0) }; Counter::ALL.len()];
+
+#[inline]
+pub fn add(counter: Counter, n: u64) {
+    if is_enabled() {
+        COUNTERS[counter as usize].fetch_add(n, Ordering::Relaxed);
+    }
+}
+
+#[inline]
+pub fn set(counter: Counter, value: u64) {
+    if is_enabled() {
+        COUNTERS[counter as usize].store(value, Ordering::Relaxed);
+    }
+}
+
+/// A lookup that either reuses earlier work (hit) or redoes it (miss).
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Cache {
+    /// `ImportCache` entries.
+    Import,
+    /// Retained canvas shapes.
+    Draw,
+    /// `SyncEngine::resolve`: incremental (hit) or full (miss) layout.
+    Layout,
+    /// `SyncEngine::flush_to_text`: blocks patched in place (hit) or the
+    /// whole document re-emitted (miss).
+    TextPatch,
+}
+
+impl Cache {
+    const ALL: [Cache; 4] = [Cache::Import, Cache::Draw, Cache::Layout, Cache::TextPatch];
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Cache::Import => "import",
+            Cache::Draw => "draw",
+            Cache::Layout => "layout",
+            Cache::TextPatch => "text_patch",
+        }
+    }
+}
+
+/// `[hits, misses]` per cache.
+static CACHES: [[AtomicU64; 2]; Cache::ALL.len()] =
+    [const { [AtomicU64::new(0), AtomicU64::new(0)] }; Cache::ALL.len()];
+
+#[inline]
+pub fn cache(cache: Cache, hit: bool) {
+    if is_enabled() {
+        CACHES[cache as usize][usize::from(!hit)].fetch_add(1, Ordering::Relaxed);
+    }
+}
+
+// ─── Reporting ───────────────────────────────────────────────────────────
+
+#[derive(Debug, Clone, PartialEq, Serialize)]
+pub struct SpanStats {
+    pub count: u64,
+    pub total_ms: f64,
+    pub mean_ms: f64,
+    pub max_ms: f64,
+}
+
+#[derive(Debug, Clone, PartialEq, Serialize)]
+pub struct CacheStats {
+    pub hits: u64,
+    pub misses: u64,
+    /// `None` before the first lookup.
+    pub hit_rate: Option<f64>,
+}
+
+/// Everything recorded since startup or the last [`reset`].
+#[derive(Debug, Clone, PartialEq, Serialize)]
+pub struct PerfStats {
+    pub enabled: bool,
+    pub spans: BTreeMap<&'static str, SpanStats>,
+    pub counters: BTreeMap<&'static str, u64>,
+    pub caches: BTreeMap<&'static str, CacheStats>,
+}
+
+pub fn stats() -> PerfStats {
+    let ms = |ns: &AtomicU64| ns.load(Ordering::Relaxed) as f64 / 1e6;
+    let spans = Span::ALL.iter().map(|&span| {
+        let slot = &SPANS[span as usize];
+        let count = slot.count.load(Ordering::Relaxed);
+        let total_ms = ms(&slot.total_ns);
+        let stats = SpanStats {
+            count,
+            total_ms,
+            mean_ms: if count == 0 {
+                0.0
+            } else {
+                total_ms / count as f64
+            },
+            max_ms: ms(&slot.max_ns),
+        };
+        (span.name(), stats)
+    });
+    let counters = Counter::ALL.iter().map(|&counter| {
+        let value = COUNTERS[counter as usize].load(Ordering::Relaxed);
+        (counter.name(), value)
+    });
+    let caches = Cache::ALL.iter().map(|&cache| {
+        let [hits, misses] = &CACHES[cache as usize];
+        let (hits, misses) = (hits.load(Ordering::Relaxed), misses.load(Ordering::Relaxed));
+        let lookups = hits + misses;
+        let stats = CacheStats {
+            hits,
+            misses,
+            hit_rate: (lookups > 0).then(|| hits as f64 / lookups as f64),
+        };
+        (cache.name(), stats)
+    });
+    PerfStats {
+        enabled: is_enabled(),
+        spans: spans.collect(),
+        counters: counters.collect(),
+        caches: caches.collect(),
+    }
+}
+
+/// Zero every total, e.g. before reproducing a slow interaction.
+pub fn reset() {
+    for slot in &SPANS {
+        slot.count.store(0, Ordering::Relaxed);
+        slot.total_ns.store(0, Ordering::Relaxed);
+        slot.max_ns.store(0, Ordering::Relaxed);
+    }
+    for counter in COUNTERS.iter().chain(CACHES.iter().flatten()) {
+        counter.store(0, Ordering::Relaxed);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::parser::parse_document;
+
+    /// Advances 1 ms per read, so every span lasts at least that long.
+    fn ticking_clock() -> f64 {
+        static TICKS: AtomicU64 = AtomicU64::new(0);
+        TICKS.fetch_add(1, Ordering::Relaxed) as f64
+    }
+
+    // Other tests run concurrently and may add to the totals, so this
+    // only checks lower bounds.
+    #[test]
+    fn records_spans_counters_and_caches_while_enabled() {
+        enable(ticking_clock);
+        parse_document("rect @a { w: 10 h: 10 }\nrect @b { w: 10 h: 10 }\n").unwrap();
+        cache(Cache::Draw, true);
+        cache(Cache::Draw, false);
+        cache(Cache::Draw, true);
+
+        let stats = stats();
+        assert!(stats.enabled);
+        let parse = &stats.spans["parse"];
+        assert!(parse.count >= 1);
+        assert!(parse.max_ms >= 1.0 && parse.total_ms >= parse.max_ms);
+        assert!(stats.counters["nodes"] >= 1);
+        let draw = &stats.caches["draw"];
+        assert!(draw.hits >= 2 && draw.misses >= 1);
+        assert!(draw.hit_rate.is_some_and(|r| r > 0.0 && r < 1.0));
+        assert_eq!(stats.spans.len(), Span::ALL.len());
+    }
+}
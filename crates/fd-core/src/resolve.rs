@@ -7,7 +7,10 @@
 use crate::id::NodeId;
 use crate::model::{Import, SceneGraph};
 use crate::parser::parse_document;
-use std::collections::HashSet;
+use crate::perf::{self, Cache};
+use std::collections::{HashMap, HashSet};
+use std::hash::{DefaultHasher, Hash, Hasher};
+use std::sync::{Arc, Mutex, OnceLock};
 
 // ─── Import Loader Trait ─────────────────────────────────────────────────
 
@@ -20,6 +23,128 @@ use std::collections::HashSet;
 pub trait ImportLoader {
     /// Load the contents of a `.fd` file at the given path.
     fn load(&self, path: &str) -> Result<String, String>;
+
+    /// Load and parse the file at `path`, before its own imports are
+    /// resolved. Override to share parsed files through an [`ImportCache`].
+    fn parse(&self, path: &str) -> Result<Arc<SceneGraph>, String> {
+        parse_import(path, self.load(path)?).map(Arc::new)
+    }
+}
+
+fn parse_import(path: &str, source: String) -> Result<SceneGraph, String> {
+    parse_document(&source).map_err(|e| format!("Error parsing \"{path}\": {e}"))
+}
+
+// ─── Import Cache ────────────────────────────────────────────────────────
+
+type CacheSlot = Arc<OnceLock<Result<Arc<SceneGraph>, String>>>;
+
+struct CacheEntry {
+    /// Hash of the source the slot was parsed from; `None` if the entry
+    /// was loaded unverified by [`ImportCache::get_or_parse`].
+    source_hash: Option<u64>,
+    slot: CacheSlot,
+}
+
+/// Parsed import files, shared between resolutions and threads.
+///
+/// Entries are keyed by a caller-chosen identity (e.g. a canonical file
+/// path), so the same library imported from many files is read and parsed
+/// once. Threads asking for a file that is being parsed wait for it instead
+/// of parsing it again. Failures are cached too.
+///
+/// Long-lived hosts whose files change under them use
+/// [`ImportCache::get_or_parse_source`], which reparses only when the
+/// content hash changes, and [`ImportCache::invalidate`] on file events.
+#[derive(Default)]
+pub struct ImportCache {
+    entries: Mutex<HashMap<String, CacheEntry>>,
+}
+
+impl ImportCache {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// The parsed file for `key`, loading it with `load` on first use.
+    /// The entry is trusted until invalidated. `path` is the import path,
+    /// used in error messages.
+    pub fn get_or_parse(
+        &self,
+        key: &str,
+        path: &str,
+        load: impl FnOnce() -> Result<String, String>,
+    ) -> Result<Arc<SceneGraph>, String> {
+        let slot = self.slot(key, |_| true, None);
+        slot.get_or_init(|| parse_import(path, load()?).map(Arc::new))
+            .clone()
+    }
+
+    /// The parsed form of `source`, the current content of `key`. Reparses
+    /// only if the content differs from the cached entry's.
+    pub fn get_or_parse_source(
+        &self,
+        key: &str,
+        path: &str,
+        source: String,
+    ) -> Result<Arc<SceneGraph>, String> {
+        let mut hasher = DefaultHasher::new();
+        source.hash(&mut hasher);
+        let hash = Some(hasher.finish());
+        let slot = self.slot(key, |entry| entry.source_hash == hash, hash);
+        slot.get_or_init(|| parse_import(path, source).map(Arc::new))
+            .clone()
+    }
+
+    /// The slot for `key`, replaced by an empty one unless `fresh` accepts
+    /// the current entry.
+    fn slot(
+        &self,
+        key: &str,
+        fresh: impl FnOnce(&CacheEntry) -> bool,
+        source_hash: Option<u64>,
+    ) -> CacheSlot {
+        let mut entries = self.entries.lock().unwrap_or_else(|e| e.into_inner());
+        if let Some(entry) = entries.get(key)
+            && fresh(entry)
+        {
+            perf::cache(Cache::Import, true);
+            return entry.slot.clone();
+        }
+        perf::cache(Cache::Import, false);
+        let slot = CacheSlot::default();
+        entries.insert(
+            key.to_string(),
+            CacheEntry {
+                source_hash,
+                slot: slot.clone(),
+            },
+        );
+        slot
+    }
+
+    /// Forget `key`, e.g. after its file changed or was deleted. Returns
+    /// whether it was cached.
+    pub fn invalidate(&self, key: &str) -> bool {
+        let mut entries = self.entries.lock().unwrap_or_else(|e| e.into_inner());
+        entries.remove(key).is_some()
+    }
+
+    pub fn clear(&self) {
+        self.entries
+            .lock()
+            .unwrap_or_else(|e| e.into_inner())
+            .clear();
+    }
+
+    /// Number of distinct files seen.
+    pub fn len(&self) -> usize {
+        self.entries.lock().unwrap_or_else(|e| e.into_inner()).len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
 }
 
 // ─── Resolver ────────────────────────────────────────────────────────────
@@ -53,14 +178,14 @@ fn resolve_imports_recursive(
         }
 
         // Load and parse the imported file
-        let source = loader.load(&import.path)?;
-        let mut imported = parse_document(&source)
-            .map_err(|e| format!("Error parsing \"{}\": {e}", import.path))?;
+        let mut imported = loader.parse(&import.path)?;
 
-        // Recursively resolve the imported file's own imports
+        // Recursively resolve the imported file's own imports, on a copy
+        // if the parsed file is shared
         let nested_imports = imported.imports.clone();
         if !nested_imports.is_empty() {
-            resolve_imports_recursive(&mut imported, &nested_imports, loader, visited)?;
+            let imported = Arc::make_mut(&mut imported);
+            resolve_imports_recursive(imported, &nested_imports, loader, visited)?;
         }
 
         // Merge namespaced styles
@@ -233,6 +358,85 @@ rect @hero { w: 200 h: 100 }
         assert!(graph.styles.contains_key(&NodeId::intern("btn.accent")));
     }
 
+    /// Loader that shares parses through a cache and counts reads.
+    struct CachedLoader<'a> {
+        files: HashMap<String, String>,
+        cache: &'a ImportCache,
+        reads: std::cell::Cell<usize>,
+    }
+
+    impl ImportLoader for CachedLoader<'_> {
+        fn load(&self, path: &str) -> Result<String, String> {
+            self.reads.set(self.reads.get() + 1);
+            self.files
+                .get(path)
+                .cloned()
+                .ok_or_else(|| format!("File not found: {path}"))
+        }
+
+        fn parse(&self, path: &str) -> Result<Arc<SceneGraph>, String> {
+            self.cache.get_or_parse(path, path, || self.load(path))
+        }
+    }
+
+    #[test]
+    fn resolve_shares_cached_parses() {
+        let tokens = "style primary { fill: #3B82F6 }\n";
+        let buttons = "import \"tokens.fd\" as tok\nrect @btn { w: 80 h: 32 }\n";
+        let cache = ImportCache::new();
+        let loader = CachedLoader {
+            files: HashMap::from([
+                ("buttons.fd".to_string(), buttons.to_string()),
+                ("tokens.fd".to_string(), tokens.to_string()),
+            ]),
+            cache: &cache,
+            reads: std::cell::Cell::new(0),
+        };
+
+        for source in [
+            "import \"buttons.fd\" as ui\n",
+            "import \"tokens.fd\" as t\n",
+        ] {
+            let mut graph = parse_document(source).unwrap();
+            resolve_imports(&mut graph, &loader).unwrap();
+        }
+        let mut graph = parse_document("import \"buttons.fd\" as ui\n").unwrap();
+        resolve_imports(&mut graph, &loader).unwrap();
+
+        // Each file is read once; resolving a shared parse leaves it intact
+        assert_eq!(loader.reads.get(), 2);
+        assert_eq!(cache.len(), 2);
+        assert!(graph.styles.contains_key(&NodeId::intern("ui.tok.primary")));
+        let cached = cache.get_or_parse("buttons.fd", "buttons.fd", || unreachable!());
+        assert!(cached.unwrap().styles.is_empty());
+
+        let missing = parse_document("import \"nope.fd\" as n\n");
+        let err = resolve_imports(&mut missing.unwrap(), &loader).unwrap_err();
+        assert!(err.contains("File not found"));
+        assert_eq!(cache.len(), 3);
+    }
+
+    #[test]
+    fn cache_reparses_only_changed_content() {
+        let cache = ImportCache::new();
+        let v1 = "rect @a { w: 10 h: 10 }\n".to_string();
+        let v2 = "rect @b { w: 10 h: 10 }\n".to_string();
+
+        let first = cache
+            .get_or_parse_source("kit.fd", "kit.fd", v1.clone())
+            .unwrap();
+        let same = cache.get_or_parse_source("kit.fd", "kit.fd", v1).unwrap();
+        assert!(Arc::ptr_eq(&first, &same));
+
+        let changed = cache.get_or_parse_source("kit.fd", "kit.fd", v2).unwrap();
+        assert!(changed.get_by_id(NodeId::intern("b")).is_some());
+        assert_eq!(cache.len(), 1);
+
+        assert!(cache.invalidate("kit.fd"));
+        assert!(!cache.invalidate("kit.fd"));
+        assert!(cache.is_empty());
+    }
+
     #[test]
     fn resolve_circular_import_error() {
         let file_a = "import \"b.fd\" as b\n";
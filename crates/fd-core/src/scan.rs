@@ -0,0 +1,146 @@
+//! Block-at-a-time byte scanning for the parser's hot loops.
+//!
+//! Generated `.fd` files are mostly indentation, numbers and hex colors, so
+//! the parser measures runs of whitespace, digits and hex digits 16 bytes
+//! per step. Each block is two `u64` lanes tested with SWAR (SIMD within a
+//! register): per-byte comparisons done in carry-free integer arithmetic,
+//! exact for every byte value. It is plain safe Rust, so native targets
+//! and wasm32 share one code path with no feature detection.
+
+const LO: u64 = 0x0101_0101_0101_0101;
+const HI: u64 = 0x8080_8080_8080_8080;
+
+/// High bit set in each byte of `w` equal to `c`.
+#[inline]
+fn eq(w: u64, c: u8) -> u64 {
+    let x = w ^ (LO * u64::from(c));
+    !((((x & !HI) + !HI) | x) & HI) & HI
+}
+
+/// High bit set in each ASCII byte of `w` that is `>= n` (`1 <= n <= 0x80`);
+/// other bytes are unspecified, so callers mask with [`ascii`].
+#[inline]
+fn ge(w: u64, n: u8) -> u64 {
+    ((w & !HI) + LO * u64::from(0x80 - n)) & HI
+}
+
+/// High bit set in each ASCII byte of `w`.
+#[inline]
+fn ascii(w: u64) -> u64 {
+    !w & HI
+}
+
+/// ASCII whitespace as [`char::is_whitespace`] sees it: space and `\t`..`\r`.
+#[inline]
+fn ws_class(w: u64) -> u64 {
+    eq(w, b' ') | (ascii(w) & ge(w, b'\t') & !ge(w, b'\r' + 1))
+}
+
+#[inline]
+fn blank_class(w: u64) -> u64 {
+    eq(w, b' ') | eq(w, b'\t')
+}
+
+#[inline]
+fn digit_class(w: u64) -> u64 {
+    ascii(w) & ge(w, b'0') & !ge(w, b'9' + 1)
+}
+
+#[inline]
+fn hex_class(w: u64) -> u64 {
+    let lower = w | (LO * 0x20);
+    digit_class(w) | (ascii(w) & ge(lower, b'a') & !ge(lower, b'f' + 1))
+}
+
+/// Length of the leading run of `bytes` whose bytes are in `class`
+/// (`scalar` is the same test, one byte at a time, for the tail).
+#[inline]
+fn run_len(bytes: &[u8], class: impl Fn(u64) -> u64, scalar: impl Fn(u8) -> bool) -> usize {
+    let mut i = 0;
+    while let Some(block) = bytes.get(i..i + 16) {
+        let (lo, hi) = block.split_at(8);
+        let lo = !class(u64::from_le_bytes(lo.try_into().unwrap())) & HI;
+        if lo != 0 {
+            return i + (lo.trailing_zeros() / 8) as usize;
+        }
+        let hi = !class(u64::from_le_bytes(hi.try_into().unwrap())) & HI;
+        if hi != 0 {
+            return i + 8 + (hi.trailing_zeros() / 8) as usize;
+        }
+        i += 16;
+    }
+    i + bytes[i..].iter().take_while(|&&b| scalar(b)).count()
+}
+
+/// Leading ASCII whitespace (space, `\t`, `\n`, `\x0B`, `\x0C`, `\r`).
+pub fn whitespace_run(bytes: &[u8]) -> usize {
+    run_len(bytes, ws_class, |b| {
+        b == b' ' || (b'\t'..=b'\r').contains(&b)
+    })
+}
+
+/// Leading spaces and tabs.
+pub fn blank_run(bytes: &[u8]) -> usize {
+    run_len(bytes, blank_class, |b| b == b' ' || b == b'\t')
+}
+
+/// Leading ASCII digits.
+pub fn digit_run(bytes: &[u8]) -> usize {
+    run_len(bytes, digit_class, |b| b.is_ascii_digit())
+}
+
+/// Leading ASCII hex digits.
+pub fn hex_run(bytes: &[u8]) -> usize {
+    run_len(bytes, hex_class, |b| b.is_ascii_hexdigit())
+}
+
+/// Number of `\n` bytes in `bytes`.
+pub fn count_newlines(bytes: &[u8]) -> usize {
+    let mut blocks = bytes.chunks_exact(8);
+    let mut count = 0;
+    for block in &mut blocks {
+        count += eq(u64::from_le_bytes(block.try_into().unwrap()), b'\n').count_ones() as usize;
+    }
+    count + blocks.remainder().iter().filter(|&&b| b == b'\n').count()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// A scanner and the byte class it should match.
+    type Case = (fn(&[u8]) -> usize, fn(u8) -> bool);
+
+    /// Every byte value, at every offset within a block, against the
+    /// scalar definition.
+    #[test]
+    fn classes_match_scalar_definitions() {
+        let scanners: [Case; 4] = [
+            (whitespace_run, |b| {
+                (b as char).is_whitespace() && b.is_ascii()
+            }),
+            (blank_run, |b| b == b' ' || b == b'\t'),
+            (digit_run, |b| b.is_ascii_digit()),
+            (hex_run, |b| b.is_ascii_hexdigit()),
+        ];
+        for (scan, member) in scanners {
+            let fill = (0..=255u8).find(|&b| member(b)).unwrap();
+            for stop in 0..=255u8 {
+                for len in [0, 3, 7, 8, 15, 16, 20, 33] {
+                    let mut bytes = vec![fill; len];
+                    bytes.push(stop);
+                    bytes.extend_from_slice(&[fill; 9]);
+                    let expected = if member(stop) { len + 10 } else { len };
+                    assert_eq!(scan(&bytes), expected, "stop byte {stop:#04x}, run {len}");
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn counts_newlines() {
+        let text = "a\nbb\n\nccc\u{e9}\n".repeat(7);
+        assert_eq!(count_newlines(text.as_bytes()), 28);
+        assert_eq!(count_newlines(b""), 0);
+    }
+}
@@ -0,0 +1,288 @@
+//! Binary snapshots of a parsed, laid-out document.
+//!
+//! A snapshot stores the scene graph and its resolved bounds as
+//! MessagePack behind a small versioned header, together with a hash of
+//! the source text it was built from. Reopening a document whose text still
+//! matches loads the snapshot instead of parsing and solving layout again.
+//!
+//! Node indices are renumbered densely in their original order, so child
+//! order (which follows `NodeIndex` order) survives the round trip. The
+//! `id_index` is rebuilt while nodes are inserted rather than stored.
+
+use crate::id::{NodeId, NodeIdMap};
+use crate::layout::Viewport;
+use crate::model::{BoundsMap, Edge, Import, ResolvedBounds, SceneGraph, SceneNode, Style};
+use petgraph::graph::NodeIndex;
+use petgraph::stable_graph::StableDiGraph;
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+
+/// Leading bytes of every snapshot.
+pub const SNAPSHOT_MAGIC: [u8; 4] = *b"FDSN";
+
+/// Bumped whenever the payload layout or the model types change shape.
+pub const SNAPSHOT_VERSION: u16 = 1;
+
+const HEADER_LEN: usize = SNAPSHOT_MAGIC.len() + 2;
+
+/// Parent slot of the root node.
+const NO_PARENT: u32 = u32::MAX;
+
+/// Stable 64-bit FNV-1a hash of a document's source text.
+///
+/// Unlike `DefaultHasher`, the value doesn't change between builds, so it
+/// can be persisted next to the snapshot.
+pub fn source_hash(text: &str) -> u64 {
+    text.bytes().fold(0xcbf2_9ce4_8422_2325_u64, |h, b| {
+        (h ^ u64::from(b)).wrapping_mul(0x0100_0000_01b3)
+    })
+}
+
+/// A document restored from a snapshot.
+#[derive(Debug, Clone)]
+pub struct Snapshot {
+    pub graph: SceneGraph,
+    pub bounds: BoundsMap,
+    /// Viewport `bounds` were resolved against.
+    pub viewport: Viewport,
+}
+
+#[derive(Serialize, Deserialize)]
+struct Payload {
+    source_hash: u64,
+    viewport: (f32, f32),
+    /// Nodes in original index order; a node's position is its new index.
+    nodes: Vec<SceneNode>,
+    /// Parent position of each node, `NO_PARENT` for the root.
+    parents: Vec<u32>,
+    root: u32,
+    styles: Vec<(NodeId, Style)>,
+    edges: Vec<Edge>,
+    imports: Vec<Import>,
+    sorted_child_order: Vec<(u32, Vec<u32>)>,
+    /// `(position, [x, y, width, height])`.
+    bounds: Vec<(u32, [f32; 4])>,
+}
+
+/// Serialize `graph` and its `bounds` (resolved against `viewport`) as a
+/// snapshot of `source`.
+pub fn write_snapshot(
+    graph: &SceneGraph,
+    bounds: &BoundsMap,
+    viewport: Viewport,
+    source: &str,
+) -> Result<Vec<u8>, String> {
+    let order: Vec<NodeIndex> = graph.graph.node_indices().collect();
+    let position: HashMap<NodeIndex, u32> = order
+        .iter()
+        .enumerate()
+        .map(|(pos, &idx)| (idx, pos as u32))
+        .collect();
+    let pos = |idx: &NodeIndex| position[idx];
+
+    let payload = Payload {
+        source_hash: source_hash(source),
+        viewport: (viewport.width, viewport.height),
+        nodes: order.iter().map(|&idx| graph.graph[idx].clone()).collect(),
+        parents: order
+            .iter()
+            .map(|&idx| graph.parent(idx).map_or(NO_PARENT, |p| pos(&p)))
+            .collect(),
+        root: pos(&graph.root),
+        styles: graph
+            .styles
+            .iter()
+            .map(|(name, style)| (*name, style.clone()))
+            .collect(),
+        edges: graph.edges.clone(),
+        imports: graph.imports.clone(),
+        // Orders may still name removed nodes; those are dropped
+        sorted_child_order: graph
+            .sorted_child_order
+            .iter()
+            .filter_map(|(parent, children)| {
+                let children = children.iter().filter_map(|c| position.get(c).copied());
+                Some((*position.get(parent)?, children.collect()))
+            })
+            .collect(),
+        bounds: bounds
+            .iter()
+            .filter(|(idx, _)| position.contains_key(idx))
+            .map(|(idx, b)| (pos(idx), [b.x, b.y, b.width, b.height]))
+            .collect(),
+    };
+
+    let body = rmp_serde::to_vec(&payload).map_err(|e| format!("snapshot encode error: {e}"))?;
+    let mut out = Vec::with_capacity(HEADER_LEN + body.len());
+    out.extend_from_slice(&SNAPSHOT_MAGIC);
+    out.extend_from_slice(&SNAPSHOT_VERSION.to_le_bytes());
+    out.extend_from_slice(&body);
+    Ok(out)
+}
+
+/// Restore a snapshot written by [`write_snapshot`].
+///
+/// # Errors
+/// - Not a snapshot, or written by a different format version
+/// - Built from text other than `source` (stale)
+/// - Corrupt payload
+pub fn read_snapshot(bytes: &[u8], source: &str) -> Result<Snapshot, String> {
+    if bytes.len() < HEADER_LEN || bytes[..SNAPSHOT_MAGIC.len()] != SNAPSHOT_MAGIC {
+        return Err("not an FD snapshot".to_string());
+    }
+    let version = u16::from_le_bytes([bytes[4], bytes[5]]);
+    if version != SNAPSHOT_VERSION {
+        return Err(format!(
+            "snapshot version {version} is not supported (expected {SNAPSHOT_VERSION})"
+        ));
+    }
+    let payload: Payload = rmp_serde::from_slice(&bytes[HEADER_LEN..])
+        .map_err(|e| format!("snapshot decode error: {e}"))?;
+    if payload.source_hash != source_hash(source) {
+        return Err("snapshot is stale: source text changed".to_string());
+    }
+
+    let count = payload.nodes.len();
+    if payload.parents.len() != count || payload.root as usize >= count {
+        return Err("snapshot is corrupt: node tables disagree".to_string());
+    }
+    let index = |pos: u32| -> Result<NodeIndex, String> {
+        if (pos as usize) < count {
+            Ok(NodeIndex::new(pos as usize))
+        } else {
+            Err(format!("snapshot is corrupt: node {pos} out of range"))
+        }
+    };
+
+    let mut graph = StableDiGraph::with_capacity(count, count);
+    let mut id_index = NodeIdMap::with_capacity_and_hasher(count, Default::default());
+    for node in payload.nodes {
+        id_index.insert(node.id, graph.add_node(node));
+    }
+    for (pos, &parent) in payload.parents.iter().enumerate() {
+        if parent != NO_PARENT {
+            graph.add_edge(index(parent)?, NodeIndex::new(pos), ());
+        }
+    }
+
+    let mut sorted_child_order = HashMap::with_capacity(payload.sorted_child_order.len());
+    for (parent, children) in payload.sorted_child_order {
+        let children = children
+            .into_iter()
+            .map(index)
+            .collect::<Result<Vec<_>, _>>()?;
+        sorted_child_order.insert(index(parent)?, children);
+    }
+
+    let mut bounds = BoundsMap::with_capacity(count);
+    for (pos, [x, y, width, height]) in payload.bounds {
+        bounds.insert(
+            index(pos)?,
+            ResolvedBounds {
+                x,
+                y,
+                width,
+                height,
+            },
+        );
+    }
+
+    Ok(Snapshot {
+        graph: SceneGraph {
+            graph,
+            root: index(payload.root)?,
+            styles: payload.styles.into_iter().collect(),
+            id_index,
+            edges: payload.edges,
+            imports: payload.imports,
+            sorted_child_order,
+        },
+        bounds,
+        viewport: Viewport {
+            width: payload.viewport.0,
+            height: payload.viewport.1,
+        },
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::emitter::emit_document;
+    use crate::layout::resolve_layout;
+    use crate::parser::parse_document;
+
+    const SOURCE: &str = r#"
+style accent { fill: #6C5CE7 }
+frame @card {
+  w: 320 h: 200
+  layout: column gap=8 pad=16
+  rect @header { w: 280 h: 40; use: accent }
+  text @title "Hello" { font: "Inter" 600 18 }
+}
+ellipse @dot { w: 20 h: 20 }
+edge @link { from: @card; to: @dot; arrow: end }
+"#;
+
+    #[test]
+    fn snapshot_roundtrip_matches_fresh_parse() {
+        let graph = parse_document(SOURCE).unwrap();
+        let viewport = Viewport::default();
+        let bounds = resolve_layout(&graph, viewport);
+
+        let bytes = write_snapshot(&graph, &bounds, viewport, SOURCE).unwrap();
+        let restored = read_snapshot(&bytes, SOURCE).unwrap();
+
+        assert_eq!(emit_document(&restored.graph), emit_document(&graph));
+        assert_eq!(restored.viewport, viewport);
+        assert_eq!(
+            restored.graph.index_of(NodeId::intern("title")),
+            graph.index_of(NodeId::intern("title"))
+        );
+        // A freshly parsed graph has dense indices, so bounds carry over as-is
+        assert_eq!(restored.bounds, bounds);
+        assert_eq!(resolve_layout(&restored.graph, viewport), bounds);
+    }
+
+    #[test]
+    fn snapshot_rejects_stale_or_foreign_bytes() {
+        let graph = parse_document(SOURCE).unwrap();
+        let viewport = Viewport::default();
+        let bounds = resolve_layout(&graph, viewport);
+        let mut bytes = write_snapshot(&graph, &bounds, viewport, SOURCE).unwrap();
+
+        let edited = SOURCE.replace("320", "330");
+        assert!(
+            read_snapshot(&bytes, &edited)
+                .unwrap_err()
+                .contains("stale")
+        );
+        assert!(read_snapshot(b"rect @a {}", SOURCE).is_err());
+
+        bytes[4] = bytes[4].wrapping_add(1);
+        assert!(
+            read_snapshot(&bytes, SOURCE)
+                .unwrap_err()
+                .contains("version")
+        );
+    }
+
+    #[test]
+    fn snapshot_renumbers_sparse_indices() {
+        let mut graph = parse_document(SOURCE).unwrap();
+        let header = graph.index_of(NodeId::intern("header")).unwrap();
+        graph.remove_node(header);
+        let viewport = Viewport::default();
+        let bounds = resolve_layout(&graph, viewport);
+
+        let bytes = write_snapshot(&graph, &bounds, viewport, SOURCE).unwrap();
+        let restored = read_snapshot(&bytes, SOURCE).unwrap();
+        assert_eq!(emit_document(&restored.graph), emit_document(&graph));
+        assert_eq!(restored.bounds.len(), bounds.len());
+        let title = restored.graph.index_of(NodeId::intern("title")).unwrap();
+        assert_eq!(
+            restored.bounds[&title],
+            bounds[&graph.index_of(NodeId::intern("title")).unwrap()]
+        );
+    }
+}
@@ -0,0 +1,411 @@
+//! Chunked, lazy parsing for very large documents.
+//!
+//! [`LazyDocument`] reads a document as a stream of byte chunks (e.g. from
+//! a file) and splits it at top-level declaration boundaries without
+//! building any nodes. Each declaration keeps its source text and the id
+//! of the node it declares; [`LazyDocument::materialize`] parses only the
+//! declarations asked for into a `SceneGraph`. A machine-generated file of
+//! many large top-level subtrees then costs about its own size in memory
+//! until a subtree is expanded, rather than a full scene graph.
+//!
+//! A declaration ends at a newline outside any `{ }` block, string or
+//! comment. Comments before a declaration stay with it, since the parser
+//! attaches them to the next node. Parse errors surface when the
+//! declaration holding them is materialized.
+
+use crate::id::{NodeId, NodeIdMap};
+use crate::model::SceneGraph;
+use crate::parser::{is_generic_node_start, parse_declarations, starts_with_node_keyword};
+use crate::perf::{self, Counter, Span};
+use std::io::Read;
+
+/// Size of the reads made by [`LazyDocument::from_reader`].
+const READ_CHUNK: usize = 64 * 1024;
+
+/// Node keywords, as accepted by the parser.
+const NODE_KEYWORDS: [&str; 6] = ["group", "frame", "rect", "ellipse", "path", "text"];
+
+/// What a top-level declaration declares.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum DeclKind {
+    Import,
+    /// A `style` or `theme` block.
+    Style,
+    /// A node and its subtree; `None` for anonymous nodes.
+    Node(Option<NodeId>),
+    /// A `@id -> …` constraint line.
+    Constraint(NodeId),
+    Edge,
+    /// Top-level `spec` blocks, trailing comments and lines the parser
+    /// skips.
+    Other,
+}
+
+/// One top-level declaration and the comments before it.
+#[derive(Debug, Clone)]
+pub struct Declaration {
+    pub kind: DeclKind,
+    /// 1-based line the text starts on.
+    pub first_line: usize,
+    pub text: Box<str>,
+}
+
+/// A document split into unparsed top-level declarations.
+#[derive(Debug, Default)]
+pub struct LazyDocument {
+    declarations: Vec<Declaration>,
+    /// Top-level node id → index into `declarations`.
+    nodes: NodeIdMap<usize>,
+}
+
+impl LazyDocument {
+    /// Split a document arriving as `chunks` of UTF-8 bytes. Chunks may
+    /// break anywhere, even inside a character.
+    pub fn from_chunks<I>(chunks: I) -> Result<Self, String>
+    where
+        I: IntoIterator,
+        I::Item: AsRef<[u8]>,
+    {
+        let mut doc = Self::default();
+        let mut splitter = Splitter::new();
+        for chunk in chunks {
+            splitter.push(chunk.as_ref(), &mut doc)?;
+        }
+        splitter.finish(&mut doc)?;
+        Ok(doc)
+    }
+
+    /// Split a document read from `reader`, a chunk at a time.
+    pub fn from_reader(mut reader: impl Read) -> Result<Self, String> {
+        let mut doc = Self::default();
+        let mut splitter = Splitter::new();
+        let mut buf = vec![0; READ_CHUNK];
+        loop {
+            let n = match reader.read(&mut buf) {
+                Ok(0) => break,
+                Ok(n) => n,
+                Err(e) if e.kind() == std::io::ErrorKind::Interrupted => continue,
+                Err(e) => return Err(format!("read error: {e}")),
+            };
+            splitter.push(&buf[..n], &mut doc)?;
+        }
+        splitter.finish(&mut doc)?;
+        Ok(doc)
+    }
+
+    /// Declarations in document order. Their texts concatenate to the
+    /// whole document.
+    pub fn declarations(&self) -> &[Declaration] {
+        &self.declarations
+    }
+
+    /// Ids of the named top-level nodes, in document order.
+    pub fn top_level_ids(&self) -> impl Iterator<Item = NodeId> + '_ {
+        self.declarations.iter().filter_map(|decl| match decl.kind {
+            DeclKind::Node(id) => id,
+            _ => None,
+        })
+    }
+
+    /// The top-level node declaration whose subtree declares `id`, found
+    /// without parsing: `id` itself, or a node declared inside it.
+    pub fn declaring(&self, id: NodeId) -> Option<&Declaration> {
+        if let Some(&i) = self.nodes.get(&id) {
+            return Some(&self.declarations[i]);
+        }
+        let name = id.as_str();
+        self.declarations.iter().find(|decl| {
+            matches!(decl.kind, DeclKind::Node(_))
+                && decl
+                    .text
+                    .lines()
+                    .any(|line| declared_id(line.trim_start()) == Some(name))
+        })
+    }
+
+    /// Parse the top-level nodes `keep` accepts, plus every import, style,
+    /// constraint and edge, into a scene graph. Anonymous top-level nodes
+    /// are always included; constraints on nodes left out are ignored, as
+    /// the parser ignores constraints on unknown nodes.
+    pub fn materialize(&self, mut keep: impl FnMut(NodeId) -> bool) -> Result<SceneGraph, String> {
+        let _span = perf::span(Span::Parse);
+        let mut graph = SceneGraph::new();
+        for decl in &self.declarations {
+            if let DeclKind::Node(Some(id)) = decl.kind
+                && !keep(id)
+            {
+                continue;
+            }
+            parse_declarations(&mut graph, &decl.text, decl.first_line)?;
+        }
+        perf::set(Counter::Nodes, graph.graph.node_count() as u64);
+        Ok(graph)
+    }
+
+    /// The whole document, as [`crate::parser::parse_document`] would
+    /// parse it.
+    pub fn materialize_all(&self) -> Result<SceneGraph, String> {
+        self.materialize(|_| true)
+    }
+
+    fn push_declaration(&mut self, first_line: usize, bytes: &[u8]) -> Result<(), String> {
+        let text = std::str::from_utf8(bytes)
+            .map_err(|e| format!("line {first_line}: declaration is not valid UTF-8: {e}"))?;
+        let kind = classify(text);
+        if let DeclKind::Node(Some(id)) = kind {
+            self.nodes.entry(id).or_insert(self.declarations.len());
+        }
+        self.declarations.push(Declaration {
+            kind,
+            first_line,
+            text: text.into(),
+        });
+        Ok(())
+    }
+}
+
+// ─── Splitting ───────────────────────────────────────────────────────────
+
+/// Finds declaration boundaries in a byte stream, holding back only the
+/// declaration still being read.
+struct Splitter {
+    pending: Vec<u8>,
+    /// Bytes of `pending` already scanned.
+    scanned: usize,
+    depth: usize,
+    in_string: bool,
+    in_comment: bool,
+    /// Only blanks so far on the current line.
+    at_line_start: bool,
+    /// The pending text has more than comments and blank lines.
+    has_content: bool,
+    /// Line the pending text starts on.
+    first_line: usize,
+    line: usize,
+}
+
+impl Splitter {
+    fn new() -> Self {
+        Self {
+            pending: Vec::new(),
+            scanned: 0,
+            depth: 0,
+            in_string: false,
+            in_comment: false,
+            at_line_start: true,
+            has_content: false,
+            first_line: 1,
+            line: 1,
+        }
+    }
+
+    /// Append `chunk`, moving every declaration it completes into `doc`.
+    fn push(&mut self, chunk: &[u8], doc: &mut LazyDocument) -> Result<(), String> {
+        self.pending.extend_from_slice(chunk);
+        self.scan(doc, false)
+    }
+
+    /// Flush whatever is left (even an unterminated block) as the last
+    /// declaration.
+    fn finish(mut self, doc: &mut LazyDocument) -> Result<(), String> {
+        self.scan(doc, true)?;
+        if self.pending.is_empty() {
+            return Ok(());
+        }
+        doc.push_declaration(self.first_line, &self.pending)
+    }
+
+    fn scan(&mut self, doc: &mut LazyDocument, at_end: bool) -> Result<(), String> {
+        // Start of the pending declaration within `pending`
+        let mut start = 0;
+        let mut i = self.scanned;
+        while i < self.pending.len() {
+            let b = self.pending[i];
+            if b == b'\n' {
+                self.in_comment = false;
+                self.at_line_start = true;
+                self.line += 1;
+                if self.depth == 0 && !self.in_string && self.has_content {
+                    doc.push_declaration(self.first_line, &self.pending[start..=i])?;
+                    start = i + 1;
+                    self.first_line = self.line;
+                    self.has_content = false;
+                }
+            } else if self.in_comment {
+            } else if self.in_string {
+                self.in_string = b != b'"';
+            } else if !is_blank(b) {
+                match b {
+                    b'#' => {
+                        // A comment, or a hex color: decide once the next
+                        // byte has arrived. Like `skip_ws_and_comments`, a
+                        // `#` at a token start is a comment unless it
+                        // begins a hex run (`fill: #FFF`, `w: 10 #}`)
+                        let next = self.pending.get(i + 1).copied();
+                        if next.is_none() && !at_end {
+                            break;
+                        }
+                        let after_blank = i > 0 && is_blank(self.pending[i - 1]);
+                        let starts_hex = next.is_some_and(|n| n.is_ascii_hexdigit());
+                        self.in_comment = self.at_line_start || (after_blank && !starts_hex);
+                    }
+                    b'"' => self.in_string = true,
+                    b'{' => self.depth += 1,
+                    b'}' => self.depth = self.depth.saturating_sub(1),
+                    _ => {}
+                }
+                if !self.in_comment {
+                    self.has_content = true;
+                }
+                self.at_line_start = false;
+            }
+            i += 1;
+        }
+        self.pending.drain(..start);
+        self.scanned = i - start;
+        Ok(())
+    }
+}
+
+fn is_blank(b: u8) -> bool {
+    matches!(b, b' ' | b'\t' | b'\r')
+}
+
+// ─── Classification ──────────────────────────────────────────────────────
+
+/// What `text` declares, decided the same way the parser picks a branch.
+fn classify(text: &str) -> DeclKind {
+    let Some(rest) = text
+        .lines()
+        .map(str::trim_start)
+        .find(|line| !line.is_empty() && !line.starts_with('#'))
+    else {
+        return DeclKind::Other;
+    };
+    let id = || declared_id(rest).map(NodeId::intern);
+    if rest.starts_with("import ") {
+        DeclKind::Import
+    } else if rest.starts_with("style ") || rest.starts_with("theme ") {
+        DeclKind::Style
+    } else if rest.starts_with("spec ") || rest.starts_with("spec{") {
+        DeclKind::Other
+    } else if rest.starts_with('@') {
+        match id() {
+            Some(id) if !is_generic_node_start(rest) => DeclKind::Constraint(id),
+            id => DeclKind::Node(id),
+        }
+    } else if rest.starts_with("edge ") {
+        DeclKind::Edge
+    } else if starts_with_node_keyword(rest) {
+        DeclKind::Node(id())
+    } else {
+        DeclKind::Other
+    }
+}
+
+/// The id in a line starting `@id` or `kind @id`.
+fn declared_id(line: &str) -> Option<&str> {
+    let keyword = NODE_KEYWORDS.iter().find(|kw| line.starts_with(**kw));
+    let rest = keyword.map_or(line, |kw| line[kw.len()..].trim_start_matches([' ', '\t']));
+    let rest = rest.strip_prefix('@')?;
+    let len = rest
+        .find(|c: char| !(c.is_alphanumeric() || c == '_'))
+        .unwrap_or(rest.len());
+    (len > 0).then(|| &rest[..len])
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::emitter::emit_document;
+    use crate::parser::parse_document;
+
+    const SOURCE: &str = r##"# Design system
+import "kit.fd" as kit
+style accent { fill: #6C5CE7 }
+
+# The card
+frame @card {
+  w: 320 h: 200 #"sized to the grid
+  layout: column gap=8 pad=16
+  # A brace in a comment: {
+  text @title "Braces { and # in strings" { font: "Inter" 600 18 }
+  rect @header { w: 280 h: 40; fill: #FFF; use: accent }
+}
+ellipse @dot { w: 20 h: 20 #}
+}
+@dot -> center_in: canvas
+edge @link { from: @card; to: @dot; arrow: end }
+# trailing
+"##;
+
+    fn split(chunk: usize) -> LazyDocument {
+        LazyDocument::from_chunks(SOURCE.as_bytes().chunks(chunk)).unwrap()
+    }
+
+    #[test]
+    fn splits_top_level_declarations_at_any_chunk_size() {
+        let kinds: Vec<DeclKind> = split(SOURCE.len())
+            .declarations()
+            .iter()
+            .map(|d| d.kind)
+            .collect();
+        let (card, dot) = (NodeId::intern("card"), NodeId::intern("dot"));
+        assert_eq!(
+            kinds,
+            [
+                DeclKind::Import,
+                DeclKind::Style,
+                DeclKind::Node(Some(card)),
+                DeclKind::Node(Some(dot)),
+                DeclKind::Constraint(dot),
+                DeclKind::Edge,
+                DeclKind::Other,
+            ]
+        );
+        // Anonymous ids are numbered per parse, so they stay out of SOURCE
+        assert_eq!(classify("\n# note\nrect { w: 5 }\n"), DeclKind::Node(None));
+
+        let expected = emit_document(&parse_document(SOURCE).unwrap());
+        for chunk in 1..=17 {
+            let doc = split(chunk);
+            let text: String = doc.declarations().iter().map(|d| &*d.text).collect();
+            assert_eq!(text, SOURCE, "chunk size {chunk}");
+            assert_eq!(doc.declarations().len(), kinds.len(), "chunk size {chunk}");
+            assert_eq!(emit_document(&doc.materialize_all().unwrap()), expected);
+        }
+        assert_eq!(split(4).declarations()[2].first_line, 4);
+    }
+
+    #[test]
+    fn materializes_only_requested_subtrees() {
+        let doc = LazyDocument::from_reader(SOURCE.as_bytes()).unwrap();
+        let card = NodeId::intern("card");
+        assert_eq!(
+            doc.top_level_ids().collect::<Vec<_>>(),
+            [card, NodeId::intern("dot")]
+        );
+        assert_eq!(
+            doc.declaring(NodeId::intern("title")).unwrap().kind,
+            DeclKind::Node(Some(card))
+        );
+        assert!(doc.declaring(NodeId::intern("nope")).is_none());
+
+        let graph = doc.materialize(|id| id == card).unwrap();
+        assert!(graph.get_by_id(NodeId::intern("header")).is_some());
+        assert!(graph.get_by_id(NodeId::intern("dot")).is_none());
+        assert!(graph.styles.contains_key(&NodeId::intern("accent")));
+        assert_eq!(graph.edges.len(), 1);
+    }
+
+    #[test]
+    fn errors_report_document_lines() {
+        let source = "rect @a { w: 10 h: 10 }\n\n# broken\nrect @b { w: }}}\n";
+        let doc = LazyDocument::from_chunks([source]).unwrap();
+        let err = doc.materialize_all().unwrap_err();
+        assert_eq!(err, parse_document(source).unwrap_err());
+        assert!(err.starts_with("line 4:"), "{err}");
+        // The broken declaration is never parsed unless asked for
+        assert!(doc.materialize(|id| id.as_str() == "a").is_ok());
+    }
+}
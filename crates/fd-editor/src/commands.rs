@@ -1,13 +1,32 @@
 //! Undo/Redo command stack.
 //!
 //! Every mutation is wrapped in a reversible `Command` that can be undone.
-//! Commands are pushed to a stack; undo pops and applies the inverse.
+//! Commands are pushed to a stack; undo pops and applies the inverse, so
+//! undo and redo cost the size of the change, not of the document.
 //!
-//! Drag gestures use **text-snapshot batching**: the full text is captured
-//! at the start and end of the gesture, so undo/redo replaces the whole
-//! document in a single step (no per-mutation inverse chain).
+//! Drag gestures are batched: every mutation between `begin_batch()` and
+//! `end_batch()` is recorded with its inverse as one undo step, and the
+//! per-frame moves, resizes and path updates of a node are coalesced into
+//! one delta, so a long drag costs the same as a short one. A gesture falls
+//! back to a text diff if it also changed the graph outside mutations (see
+//! [`SyncEngine::direct_edits`]) or moved a node that wasn't pinned by a
+//! plain `Position`, since a move drops the node's other constraints.
+//!
+//! Discrete multi-node edits (delete, group, … on a selection) go through
+//! [`CommandStack::execute_batch`]: one undo step holding every mutation
+//! and its inverse.
+//!
+//! History is capped both by depth and by an estimated byte budget; the
+//! oldest steps are dropped first.
 
 use crate::sync::{GraphMutation, SyncEngine};
+use fd_core::id::NodeId;
+use fd_core::model::Constraint;
+use std::collections::{HashMap, VecDeque};
+use std::mem::{Discriminant, discriminant, size_of};
+
+/// Default cap on the estimated size of the undo/redo history.
+pub const DEFAULT_HISTORY_BYTES: usize = 16 * 1024 * 1024;
 
 /// A command that captures both a forward mutation and its inverse.
 /// May hold a single mutation or a batch of mutations (from drag gestures).
@@ -19,115 +38,280 @@ pub enum Command {
         inverse: Box<GraphMutation>,
         description: String,
     },
-    /// Snapshot-based batch: captures full text before and after a gesture.
+    /// Several mutations applied as one step. `inverse[i]` undoes
+    /// `forward[i]`; undo runs them last to first.
+    Batch {
+        forward: Vec<GraphMutation>,
+        inverse: Vec<GraphMutation>,
+        description: String,
+    },
+    /// Text diff for a gesture mutations alone can't replay: undo puts
+    /// `before` back in place of `after` at byte `start`, redo the reverse.
     Snapshot {
-        text_before: String,
-        text_after: String,
+        start: usize,
+        before: String,
+        after: String,
         description: String,
     },
 }
 
+impl Command {
+    /// Rough heap + inline size, for the history budget.
+    pub fn approx_bytes(&self) -> usize {
+        size_of::<Self>()
+            + match self {
+                Command::Single {
+                    forward,
+                    inverse,
+                    description,
+                } => mutation_bytes(forward) + mutation_bytes(inverse) + description.len(),
+                Command::Batch {
+                    forward,
+                    inverse,
+                    description,
+                } => {
+                    forward
+                        .iter()
+                        .chain(inverse)
+                        .map(mutation_bytes)
+                        .sum::<usize>()
+                        + description.len()
+                }
+                Command::Snapshot {
+                    before,
+                    after,
+                    description,
+                    ..
+                } => before.len() + after.len() + description.len(),
+            }
+    }
+}
+
+/// Mutations recorded during an open gesture batch.
+#[derive(Default)]
+struct BatchRecorder {
+    forward: Vec<GraphMutation>,
+    inverse: Vec<GraphMutation>,
+    /// Latest coalescible op per node and mutation kind, since the last
+    /// op that can't be reordered with them.
+    latest: HashMap<(NodeId, Discriminant<GraphMutation>), usize>,
+    /// A recorded mutation can't be undone by replaying its inverse (see
+    /// [`move_is_replayable`]).
+    needs_text_diff: bool,
+}
+
+impl BatchRecorder {
+    fn record(&mut self, forward: GraphMutation, inverse: GraphMutation) {
+        let Some(id) = coalescible_id(&forward) else {
+            self.latest.clear();
+            self.forward.push(forward);
+            self.inverse.push(inverse);
+            return;
+        };
+        let key = (id, discriminant(&forward));
+        if let Some(&i) = self.latest.get(&key) {
+            match (&mut self.forward[i], &forward) {
+                // Relative: the deltas add up
+                (
+                    GraphMutation::MoveNode { dx, dy, .. },
+                    GraphMutation::MoveNode {
+                        dx: ndx, dy: ndy, ..
+                    },
+                ) => {
+                    *dx += ndx;
+                    *dy += ndy;
+                    self.inverse[i] = GraphMutation::MoveNode {
+                        id,
+                        dx: -*dx,
+                        dy: -*dy,
+                    };
+                }
+                // Absolute: the first inverse and the last value win
+                (slot, _) => *slot = forward,
+            }
+            return;
+        }
+        self.latest.insert(key, self.forward.len());
+        self.forward.push(forward);
+        self.inverse.push(inverse);
+    }
+}
+
+/// The node a per-frame mutation targets, if consecutive ones on the same
+/// node fold into one. These commute with ones on other nodes, so folding
+/// across them is safe.
+fn coalescible_id(mutation: &GraphMutation) -> Option<NodeId> {
+    match mutation {
+        GraphMutation::MoveNode { id, .. }
+        | GraphMutation::ResizeNode { id, .. }
+        | GraphMutation::UpdatePath { id, .. } => Some(*id),
+        _ => None,
+    }
+}
+
 /// Manages undo/redo stacks with batch grouping for drag gestures.
 pub struct CommandStack {
-    undo_stack: Vec<Command>,
+    undo_stack: VecDeque<Command>,
     redo_stack: Vec<Command>,
     /// Maximum undo depth.
     max_depth: usize,
+    /// Cap on the estimated size of both stacks.
+    max_bytes: usize,
+    /// Estimated size of both stacks.
+    history_bytes: usize,
     /// Batch nesting depth (0 = not batching).
     batch_depth: usize,
-    /// Text snapshot captured at the start of a batch.
-    batch_snapshot: Option<String>,
-    /// Whether any mutations occurred during the current batch.
-    batch_dirty: bool,
+    /// Text at the start of the batch, kept only until it closes.
+    batch_text: Option<String>,
+    /// `SyncEngine::direct_edits` at the start of the batch.
+    batch_direct_edits: u64,
+    /// Mutations recorded during the current batch.
+    batch: BatchRecorder,
 }
 
 impl CommandStack {
     pub fn new(max_depth: usize) -> Self {
+        Self::with_budget(max_depth, DEFAULT_HISTORY_BYTES)
+    }
+
+    /// Like [`CommandStack::new`], dropping the oldest steps once the
+    /// history's estimated size exceeds `max_bytes`. The latest step is
+    /// always kept.
+    pub fn with_budget(max_depth: usize, max_bytes: usize) -> Self {
         Self {
-            undo_stack: Vec::with_capacity(max_depth),
+            undo_stack: VecDeque::with_capacity(max_depth.min(1024)),
             redo_stack: Vec::new(),
             max_depth,
+            max_bytes,
+            history_bytes: 0,
             batch_depth: 0,
-            batch_snapshot: None,
-            batch_dirty: false,
+            batch_text: None,
+            batch_direct_edits: 0,
+            batch: BatchRecorder::default(),
         }
     }
 
-    /// Start a batch group. Captures the current text as a snapshot
-    /// for undo. All mutations until `end_batch()` are applied live
-    /// but tracked as one atomic undo step.
+    /// Start a batch group. All mutations until `end_batch()` are applied
+    /// live but tracked as one atomic undo step.
     pub fn begin_batch(&mut self, engine: &mut SyncEngine) {
         if self.batch_depth == 0 {
-            self.batch_snapshot = Some(engine.current_text().to_string());
-            self.batch_dirty = false;
+            self.batch_text = Some(engine.current_text().to_string());
+            self.batch_direct_edits = engine.direct_edits();
+            self.batch = BatchRecorder::default();
         }
         self.batch_depth += 1;
     }
 
-    /// End a batch group. When the outermost batch closes, if any
-    /// mutations occurred, push one snapshot command to the undo stack.
+    /// End a batch group. When the outermost batch closes and the text
+    /// changed, push one command to the undo stack: the recorded deltas or,
+    /// if the graph was also edited directly meanwhile, a text diff.
     pub fn end_batch(&mut self, engine: &mut SyncEngine) {
         if self.batch_depth == 0 {
             return;
         }
         self.batch_depth -= 1;
-        if self.batch_depth == 0 {
-            if self.batch_dirty {
-                // Flush text so snapshot_after reflects final state
-                engine.flush_to_text();
-                let text_after = engine.current_text().to_string();
-                let text_before = self.batch_snapshot.take().unwrap_or_default();
-
-                // Only push if text actually changed
-                if text_before != text_after {
-                    let cmd = Command::Snapshot {
-                        text_before,
-                        text_after,
-                        description: "canvas edit".to_string(),
-                    };
-                    self.undo_stack.push(cmd);
-                    if self.undo_stack.len() > self.max_depth {
-                        self.undo_stack.remove(0);
-                    }
-                    self.redo_stack.clear();
-                }
-            }
-            self.batch_snapshot = None;
-            self.batch_dirty = false;
+        if self.batch_depth > 0 {
+            return;
         }
+        let batch = std::mem::take(&mut self.batch);
+        let replayable = !batch.needs_text_diff && engine.direct_edits() == self.batch_direct_edits;
+        let text_before = self.batch_text.take().unwrap_or_default();
+        let text_after = engine.current_text();
+        // Only push if text actually changed
+        if text_before == text_after {
+            return;
+        }
+        let description = "canvas edit".to_string();
+        let cmd = if replayable {
+            Command::Batch {
+                forward: batch.forward,
+                inverse: batch.inverse,
+                description,
+            }
+        } else {
+            let (start, before, after) = text_diff(&text_before, text_after);
+            Command::Snapshot {
+                start,
+                before: before.to_string(),
+                after: after.to_string(),
+                description,
+            }
+        };
+        self.push(cmd);
     }
 
     /// Execute a mutation via the sync engine and push to undo stack.
     pub fn execute(&mut self, engine: &mut SyncEngine, mutation: GraphMutation, description: &str) {
-        if self.batch_depth > 0 {
-            // Inside a batch: apply the mutation live but don't track it.
-            // The snapshot at end_batch() will capture the cumulative effect.
-            engine.apply_mutation(mutation);
-            self.batch_dirty = true;
-            return;
-        }
-
         let inverse = compute_inverse(engine, &mutation);
+        let replayable = self.batch_depth == 0 || move_is_replayable(engine, &mutation);
         engine.apply_mutation(mutation.clone());
 
-        let cmd = Command::Single {
+        if self.batch_depth > 0 {
+            // Inside a batch: end_batch() pushes the coalesced deltas
+            self.batch.needs_text_diff |= !replayable;
+            self.batch.record(mutation, inverse);
+            return;
+        }
+        self.push(Command::Single {
             forward: Box::new(mutation),
             inverse: Box::new(inverse),
             description: description.to_string(),
-        };
+        });
+    }
 
-        self.undo_stack.push(cmd);
-        if self.undo_stack.len() > self.max_depth {
-            self.undo_stack.remove(0);
+    /// Execute several mutations, in order, as one undo step.
+    ///
+    /// Like [`SyncEngine::apply_mutation`] this neither resolves layout nor
+    /// flushes text; callers do that once afterwards (or inside a
+    /// [`SyncEngine::begin_batch`]).
+    pub fn execute_batch(
+        &mut self,
+        engine: &mut SyncEngine,
+        mutations: Vec<GraphMutation>,
+        description: &str,
+    ) {
+        if self.batch_depth > 0 || mutations.len() <= 1 {
+            for mutation in mutations {
+                self.execute(engine, mutation, description);
+            }
+            return;
+        }
+
+        // Each inverse is taken against the state its mutation sees
+        let mut inverse = Vec::with_capacity(mutations.len());
+        for mutation in &mutations {
+            inverse.push(compute_inverse(engine, mutation));
+            engine.apply_mutation(mutation.clone());
         }
 
-        // Clear redo stack on new action
-        self.redo_stack.clear();
+        self.push(Command::Batch {
+            forward: mutations,
+            inverse,
+            description: description.to_string(),
+        });
     }
 
-    /// Undo the last command (or batch snapshot).
+    /// Record a new action: drop the redo history, then trim to
+    /// `max_depth` and the byte budget.
+    fn push(&mut self, cmd: Command) {
+        for old in self.redo_stack.drain(..) {
+            self.history_bytes -= old.approx_bytes();
+        }
+        self.history_bytes += cmd.approx_bytes();
+        self.undo_stack.push_back(cmd);
+        while self.undo_stack.len() > self.max_depth
+            || (self.history_bytes > self.max_bytes && self.undo_stack.len() > 1)
+        {
+            match self.undo_stack.pop_front() {
+                Some(old) => self.history_bytes -= old.approx_bytes(),
+                None => break,
+            }
+        }
+    }
+
+    /// Undo the last command (or batch).
     pub fn undo(&mut self, engine: &mut SyncEngine) -> Option<String> {
-        let cmd = self.undo_stack.pop()?;
+        let cmd = self.undo_stack.pop_back()?;
         let desc = match &cmd {
             Command::Single {
                 inverse,
@@ -137,12 +321,23 @@ impl CommandStack {
                 engine.apply_mutation(*inverse.clone());
                 description.clone()
             }
-            Command::Snapshot {
-                text_before,
+            Command::Batch {
+                inverse,
                 description,
                 ..
             } => {
-                let _ = engine.set_text(text_before);
+                for mutation in inverse.iter().rev() {
+                    engine.apply_mutation(mutation.clone());
+                }
+                description.clone()
+            }
+            Command::Snapshot {
+                start,
+                before,
+                after,
+                description,
+            } => {
+                splice_text(engine, *start, after, before);
                 description.clone()
             }
         };
@@ -150,7 +345,7 @@ impl CommandStack {
         Some(desc)
     }
 
-    /// Redo the last undone command (or batch snapshot).
+    /// Redo the last undone command (or batch).
     pub fn redo(&mut self, engine: &mut SyncEngine) -> Option<String> {
         let cmd = self.redo_stack.pop()?;
         let desc = match &cmd {
@@ -162,16 +357,27 @@ impl CommandStack {
                 engine.apply_mutation(*forward.clone());
                 description.clone()
             }
-            Command::Snapshot {
-                text_after,
+            Command::Batch {
+                forward,
                 description,
                 ..
             } => {
-                let _ = engine.set_text(text_after);
+                for mutation in forward {
+                    engine.apply_mutation(mutation.clone());
+                }
+                description.clone()
+            }
+            Command::Snapshot {
+                start,
+                before,
+                after,
+                description,
+            } => {
+                splice_text(engine, *start, before, after);
                 description.clone()
             }
         };
-        self.undo_stack.push(cmd);
+        self.undo_stack.push_back(cmd);
         Some(desc)
     }
 
@@ -182,6 +388,130 @@ impl CommandStack {
     pub fn can_redo(&self) -> bool {
         !self.redo_stack.is_empty()
     }
+
+    /// Estimated size of the undo and redo history, in bytes.
+    pub fn history_bytes(&self) -> usize {
+        self.history_bytes
+    }
+}
+
+/// The differing middle of two texts: `(start, old, new)` with
+/// `old == &before[start..]` and `new == &after[start..]` minus their
+/// common suffix.
+fn text_diff<'a>(before: &'a str, after: &'a str) -> (usize, &'a str, &'a str) {
+    let mut start = before
+        .bytes()
+        .zip(after.bytes())
+        .take_while(|(a, b)| a == b)
+        .count();
+    while !before.is_char_boundary(start) {
+        start -= 1;
+    }
+    let max_suffix = before.len().min(after.len()) - start;
+    let mut suffix = before
+        .bytes()
+        .rev()
+        .zip(after.bytes().rev())
+        .take(max_suffix)
+        .take_while(|(a, b)| a == b)
+        .count();
+    while !before.is_char_boundary(before.len() - suffix) {
+        suffix -= 1;
+    }
+    (
+        start,
+        &before[start..before.len() - suffix],
+        &after[start..after.len() - suffix],
+    )
+}
+
+/// Replace `expected` at byte `start` of the engine's text with
+/// `replacement` and reparse. Leaves the document alone if the text there
+/// is no longer `expected`.
+fn splice_text(engine: &mut SyncEngine, start: usize, expected: &str, replacement: &str) {
+    let text = engine.current_text();
+    if text.get(start..start + expected.len()) != Some(expected) {
+        return;
+    }
+    let mut spliced = String::with_capacity(text.len() - expected.len() + replacement.len());
+    spliced.push_str(&text[..start]);
+    spliced.push_str(replacement);
+    spliced.push_str(&text[start + expected.len()..]);
+    let _ = engine.set_text(&spliced);
+}
+
+/// Rough size of a mutation: inline size plus the heap data it owns.
+fn mutation_bytes(mutation: &GraphMutation) -> usize {
+    size_of::<GraphMutation>()
+        + match mutation {
+            GraphMutation::AddNode { node, .. } => {
+                size_of::<fd_core::model::SceneNode>()
+                    + node.comments.iter().map(String::len).sum::<usize>()
+                    + match &node.kind {
+                        fd_core::model::NodeKind::Text { content } => content.len(),
+                        fd_core::model::NodeKind::Path { commands } => {
+                            commands.len() * size_of::<fd_core::model::PathCmd>()
+                        }
+                        _ => 0,
+                    }
+            }
+            GraphMutation::SetText { content, .. } => content.len(),
+            GraphMutation::SetAnnotations { annotations, .. } => {
+                annotations.len() * size_of::<fd_core::model::Annotation>()
+            }
+            GraphMutation::UpdatePath { commands, .. } => {
+                commands.len() * size_of::<fd_core::model::PathCmd>()
+            }
+            GraphMutation::GroupNodes { ids, .. } => ids.len() * size_of::<NodeId>(),
+            GraphMutation::SetAnimations { animations, .. } => {
+                animations.len() * size_of::<fd_core::model::AnimKeyframe>()
+            }
+            GraphMutation::AddEdge { .. } => size_of::<fd_core::model::Edge>(),
+            _ => 0,
+        }
+}
+
+/// Whether `MoveNode { -dx, -dy }` restores the node `mutation` moves.
+///
+/// A move strips `center_in`, offset and `fill_parent` constraints and pins
+/// an explicit `Position` where the node ends up, so moving back only gives
+/// the original text if the node was already pinned by a `Position` (or by
+/// none, which reads as 0, 0) that matches its resolved bounds, and not,
+/// say, placed by its parent's layout.
+fn move_is_replayable(engine: &SyncEngine, mutation: &GraphMutation) -> bool {
+    let GraphMutation::MoveNode { id, .. } = mutation else {
+        return true;
+    };
+    let Some(idx) = engine.graph.index_of(*id) else {
+        return true;
+    };
+    let mut positional = engine.graph.graph[idx].constraints.iter().filter(|c| {
+        matches!(
+            c,
+            Constraint::Position { .. }
+                | Constraint::CenterIn(_)
+                | Constraint::Offset { .. }
+                | Constraint::FillParent { .. }
+        )
+    });
+    let (x, y) = match (positional.next(), positional.next()) {
+        // Emitted the same as `Position { x: 0, y: 0 }`
+        (None, _) => (0.0, 0.0),
+        (Some(Constraint::Position { x, y }), None) => (*x, *y),
+        _ => return false,
+    };
+    let bounds = engine.current_bounds();
+    let Some(own) = bounds.get(&idx) else {
+        return false;
+    };
+    let (px, py) = engine
+        .graph
+        .parent(idx)
+        .and_then(|pidx| bounds.get(&pidx))
+        .map(|pb| (pb.x, pb.y))
+        .unwrap_or((0.0, 0.0));
+    // apply_mutation rounds the pinned position to 0.01
+    (own.x - px - x).abs() < 0.005 && (own.y - py - y).abs() < 0.005
 }
 
 /// Compute the inverse mutation needed to undo `mutation`.
@@ -638,4 +968,173 @@ rect @box {
 
         assert!(!stack.can_undo());
     }
+
+    #[test]
+    fn batch_coalesces_drag_frames() {
+        let input = "rect @a { w: 10 h: 10 }\nrect @b { w: 10 h: 10 }\n";
+        let mut engine = SyncEngine::from_text(input, Viewport::default()).unwrap();
+        let before = engine.current_text().to_string();
+        let mut stack = CommandStack::new(100);
+
+        stack.begin_batch(&mut engine);
+        for _ in 0..50 {
+            for id in ["a", "b"] {
+                let id = NodeId::intern(id);
+                stack.execute(
+                    &mut engine,
+                    GraphMutation::MoveNode {
+                        id,
+                        dx: 2.0,
+                        dy: 1.0,
+                    },
+                    "drag",
+                );
+            }
+        }
+        stack.end_batch(&mut engine);
+
+        match stack.undo_stack.back() {
+            Some(Command::Batch { forward, .. }) => {
+                assert_eq!(forward.len(), 2, "one delta per dragged node");
+                assert!(matches!(forward[0], GraphMutation::MoveNode { dx, dy, .. }
+                    if dx == 100.0 && dy == 50.0));
+            }
+            other => panic!("expected a delta batch, got {other:?}"),
+        }
+        let after = engine.current_text().to_string();
+
+        stack.undo(&mut engine);
+        engine.resolve();
+        assert_eq!(engine.current_text(), before);
+        stack.redo(&mut engine);
+        engine.resolve();
+        assert_eq!(engine.current_text(), after);
+    }
+
+    #[test]
+    fn direct_edit_in_batch_falls_back_to_text_diff() {
+        let input = "rect @a { w: 10 h: 10 }\nrect @b { w: 10 h: 10 }\n";
+        let mut engine = SyncEngine::from_text(input, Viewport::default()).unwrap();
+        let before = engine.current_text().to_string();
+        let mut stack = CommandStack::new(100);
+
+        stack.begin_batch(&mut engine);
+        let a = NodeId::intern("a");
+        stack.execute(
+            &mut engine,
+            GraphMutation::MoveNode {
+                id: a,
+                dx: 5.0,
+                dy: 0.0,
+            },
+            "drag",
+        );
+        let idx = engine.graph.index_of(a).unwrap();
+        assert!(engine.graph.bring_forward(idx));
+        engine.mark_text_stale();
+        stack.end_batch(&mut engine);
+
+        let after = engine.current_text().to_string();
+        match stack.undo_stack.back() {
+            Some(Command::Snapshot {
+                before: old,
+                after: new,
+                ..
+            }) => {
+                assert!(old.len() < before.len() && new.len() < after.len());
+            }
+            other => panic!("expected a text diff, got {other:?}"),
+        }
+        stack.undo(&mut engine);
+        assert_eq!(engine.current_text(), before);
+        stack.redo(&mut engine);
+        assert_eq!(engine.current_text(), after);
+    }
+
+    #[test]
+    fn drag_of_constrained_node_undoes_to_original_text() {
+        let input = "rect @box { w: 100 h: 50 }\n@box -> center_in: canvas\n";
+        let mut engine = SyncEngine::from_text(input, Viewport::default()).unwrap();
+        let before = engine.current_text().to_string();
+        assert!(before.contains("center_in: canvas"));
+        let mut stack = CommandStack::new(100);
+
+        stack.begin_batch(&mut engine);
+        for _ in 0..5 {
+            stack.execute(
+                &mut engine,
+                GraphMutation::MoveNode {
+                    id: NodeId::intern("box"),
+                    dx: 10.0,
+                    dy: 5.0,
+                },
+                "drag",
+            );
+        }
+        stack.end_batch(&mut engine);
+
+        let after = engine.current_text().to_string();
+        assert!(!after.contains("center_in"), "the drag pins the node");
+        assert!(
+            matches!(stack.undo_stack.back(), Some(Command::Snapshot { .. })),
+            "a move that drops center_in can't be replayed"
+        );
+
+        stack.undo(&mut engine);
+        engine.resolve();
+        assert_eq!(engine.current_text(), before);
+        stack.redo(&mut engine);
+        engine.resolve();
+        assert_eq!(engine.current_text(), after);
+    }
+
+    #[test]
+    fn history_budget_drops_oldest() {
+        let mut engine =
+            SyncEngine::from_text("rect @a { w: 10 h: 10 }\n", Viewport::default()).unwrap();
+        let a = NodeId::intern("a");
+        let step = Command::Single {
+            forward: Box::new(GraphMutation::MoveNode {
+                id: a,
+                dx: 1.0,
+                dy: 0.0,
+            }),
+            inverse: Box::new(GraphMutation::MoveNode {
+                id: a,
+                dx: -1.0,
+                dy: 0.0,
+            }),
+            description: "move".to_string(),
+        }
+        .approx_bytes();
+        let mut stack = CommandStack::with_budget(100, step * 3);
+
+        for _ in 0..10 {
+            stack.execute(
+                &mut engine,
+                GraphMutation::MoveNode {
+                    id: a,
+                    dx: 1.0,
+                    dy: 0.0,
+                },
+                "move",
+            );
+        }
+        assert_eq!(stack.undo_stack.len(), 3);
+        assert_eq!(stack.history_bytes(), step * 3);
+
+        stack.undo(&mut engine);
+        assert_eq!(stack.history_bytes(), step * 3, "redo history counts too");
+        stack.execute(
+            &mut engine,
+            GraphMutation::MoveNode {
+                id: a,
+                dx: 1.0,
+                dy: 0.0,
+            },
+            "move",
+        );
+        assert_eq!(stack.history_bytes(), step * 3);
+        assert!(!stack.can_redo());
+    }
 }
@@ -13,12 +13,15 @@
 //!   keystroke.
 
 use fd_core::NodeIndex;
-use fd_core::emitter::emit_document;
+use fd_core::emitter::{NodeSpans, TextPatch, emit_document_with_spans, patch_nodes};
 use fd_core::id::NodeId;
 use fd_core::model::*;
 use fd_core::parser::parse_document;
-use fd_core::{ResolvedBounds, Viewport, resolve_layout};
-use std::collections::HashMap;
+use fd_core::perf::{self, Cache, Span};
+use fd_core::snapshot::{read_snapshot, write_snapshot};
+use fd_core::{ResolvedBounds, Viewport, resolve_layout, resolve_layout_dirty};
+use fd_render::spatial::SpatialIndex;
+use std::collections::HashSet;
 
 /// The sync engine holds the authoritative scene graph and keeps text + canvas
 /// in sync.
@@ -30,7 +33,11 @@ pub struct SyncEngine {
     pub text: String,
 
     /// Resolved layout bounds (recomputed after mutations).
-    pub bounds: HashMap<NodeIndex, ResolvedBounds>,
+    pub bounds: BoundsMap,
+
+    /// Spatial index over `bounds` for hit testing. Kept current by every
+    /// method here; code writing `bounds` directly calls `reindex_bounds`.
+    spatial: SpatialIndex,
 
     /// Canvas viewport dimensions.
     pub viewport: Viewport,
@@ -38,9 +45,46 @@ pub struct SyncEngine {
     /// Dirty flag: set when graph changes and text needs re-emit.
     text_dirty: bool,
 
+    /// Byte span of each node block in `text`, while `text` is emitter
+    /// output. `None` after `set_text` until the next full emit.
+    text_spans: Option<NodeSpans>,
+
+    /// Nodes whose own block changed since the last flush.
+    text_patch_nodes: HashSet<NodeIndex>,
+
+    /// Set when a change reaches beyond single node blocks, so the next
+    /// flush re-emits the whole document.
+    text_stale: bool,
+
+    /// Patches applied to `text` since the last `take_text_patch`, or
+    /// `None` if it was re-emitted wholesale in the meantime.
+    text_patches: Option<Vec<TextPatch>>,
+
     /// Dirty flag: set when text changes and graph needs re-parse.
     graph_dirty: bool,
 
+    /// Nodes whose layout inputs changed since the last `resolve()`.
+    layout_dirty: HashSet<NodeIndex>,
+
+    /// Set when a structural change needs a full `resolve_layout`.
+    layout_stale: bool,
+
+    /// Viewport `bounds` were last resolved against.
+    resolved_viewport: Viewport,
+
+    /// Nesting depth of open batches (see [`SyncEngine::begin_batch`]).
+    batch_depth: usize,
+
+    /// `resolve()` was requested inside the open batch.
+    batch_resolve: bool,
+
+    /// `flush_to_text()` was requested inside the open batch.
+    batch_flush: bool,
+
+    /// Graph edits made other than through `apply_mutation` (see
+    /// [`SyncEngine::direct_edits`]).
+    direct_edits: u64,
+
     /// Last detach event: (child_id, old_parent_id). Reset on flush.
     pub last_detach: Option<(fd_core::id::NodeId, fd_core::id::NodeId)>,
 }
@@ -50,15 +94,27 @@ impl SyncEngine {
     pub fn from_text(text: &str, viewport: Viewport) -> Result<Self, String> {
         let graph = parse_document(text)?;
         let bounds = resolve_layout(&graph, viewport);
-        let canonical_text = emit_document(&graph);
+        let (canonical_text, spans) = emit_document_with_spans(&graph);
 
         Ok(Self {
             graph,
             text: canonical_text,
+            spatial: SpatialIndex::from_bounds(&bounds),
             bounds,
             viewport,
             text_dirty: false,
+            text_spans: Some(spans),
+            text_patch_nodes: HashSet::new(),
+            text_stale: false,
+            text_patches: Some(Vec::new()),
             graph_dirty: false,
+            layout_dirty: HashSet::new(),
+            layout_stale: false,
+            resolved_viewport: viewport,
+            batch_depth: 0,
+            batch_resolve: false,
+            batch_flush: false,
+            direct_edits: 0,
             last_detach: None,
         })
     }
@@ -67,15 +123,27 @@ impl SyncEngine {
     pub fn new(viewport: Viewport) -> Self {
         let graph = SceneGraph::new();
         let bounds = resolve_layout(&graph, viewport);
-        let text = emit_document(&graph);
+        let (text, spans) = emit_document_with_spans(&graph);
 
         Self {
             graph,
             text,
+            spatial: SpatialIndex::from_bounds(&bounds),
             bounds,
             viewport,
             text_dirty: false,
+            text_spans: Some(spans),
+            text_patch_nodes: HashSet::new(),
+            text_stale: false,
+            text_patches: Some(Vec::new()),
             graph_dirty: false,
+            layout_dirty: HashSet::new(),
+            layout_stale: false,
+            resolved_viewport: viewport,
+            batch_depth: 0,
+            batch_resolve: false,
+            batch_flush: false,
+            direct_edits: 0,
             last_detach: None,
         }
     }
@@ -85,12 +153,20 @@ impl SyncEngine {
     /// Apply a graph mutation from canvas interaction, then re-sync text.
     /// This is the hot path during drag/draw — must be fast.
     pub fn apply_mutation(&mut self, mutation: GraphMutation) {
+        match self.patchable_node(&mutation) {
+            Some(idx) => {
+                self.text_patch_nodes.insert(idx);
+            }
+            None => self.text_stale = true,
+        }
+
         match mutation {
             GraphMutation::MoveNode { id, dx, dy } => {
                 if let Some(idx) = self.graph.index_of(id) {
                     if let Some(bounds) = self.bounds.get_mut(&idx) {
                         bounds.x += dx;
                         bounds.y += dy;
+                        self.spatial.insert(idx, *bounds);
                     }
                     // Propagate movement to all descendants' cached bounds
                     // so children move together with their parent (e.g. group drag).
@@ -99,6 +175,7 @@ impl SyncEngine {
                         if let Some(child_bounds) = self.bounds.get_mut(&child_idx) {
                             child_bounds.x += dx;
                             child_bounds.y += dy;
+                            self.spatial.insert(child_idx, *child_bounds);
                         }
                     }
                     // Pin moved node to Position constraint with parent-relative coords.
@@ -133,6 +210,7 @@ impl SyncEngine {
                         let ry = (rel_y * 100.0).round() / 100.0;
                         node.constraints.push(Constraint::Position { x: rx, y: ry });
                     }
+                    self.layout_dirty.insert(idx);
                 }
             }
             GraphMutation::ResizeNode { id, width, height } => {
@@ -168,6 +246,10 @@ impl SyncEngine {
                 {
                     bounds.width = rw;
                     bounds.height = rh;
+                    self.spatial.insert(idx, *bounds);
+                }
+                if let Some(idx) = self.graph.index_of(id) {
+                    self.layout_dirty.insert(idx);
                 }
             }
             GraphMutation::AddNode { parent_id, node } => {
@@ -185,29 +267,41 @@ impl SyncEngine {
                     _ => (0.0, 0.0),
                 };
                 let idx = self.graph.add_node(parent_idx, *node);
+                // Re-lay-out the parent too: a new sibling can change how
+                // existing children are placed (e.g. text auto-centering).
+                self.layout_dirty.insert(if parent_idx == self.graph.root {
+                    idx
+                } else {
+                    parent_idx
+                });
                 // Insert bounds for only the new node (don't re-resolve all nodes)
                 if let Some((x, y)) = abs_pos {
-                    self.bounds.insert(
-                        idx,
-                        ResolvedBounds {
-                            x,
-                            y,
-                            width: w,
-                            height: h,
-                        },
-                    );
+                    let bounds = ResolvedBounds {
+                        x,
+                        y,
+                        width: w,
+                        height: h,
+                    };
+                    self.bounds.insert(idx, bounds);
+                    self.spatial.insert(idx, bounds);
                 }
             }
             GraphMutation::RemoveNode { id } => {
                 if let Some(idx) = self.graph.index_of(id) {
                     self.bounds.remove(&idx);
+                    self.spatial.remove(idx);
                     self.graph.remove_node(idx);
+                    self.layout_stale = true;
                 }
             }
             GraphMutation::SetStyle { id, style } => {
                 if let Some(node) = self.graph.get_by_id_mut(id) {
                     node.style = style;
                 }
+                // Font size feeds into text size
+                if let Some(idx) = self.graph.index_of(id) {
+                    self.layout_dirty.insert(idx);
+                }
             }
             GraphMutation::SetText { id, content } => {
                 if let Some(node) = self.graph.get_by_id_mut(id)
@@ -215,6 +309,9 @@ impl SyncEngine {
                 {
                     *c = content;
                 }
+                if let Some(idx) = self.graph.index_of(id) {
+                    self.layout_dirty.insert(idx);
+                }
             }
             GraphMutation::SetAnnotations { id, annotations } => {
                 if let Some(node) = self.graph.get_by_id_mut(id) {
@@ -237,7 +334,8 @@ impl SyncEngine {
                         dx: 20.0,
                         dy: 20.0,
                     });
-                    self.graph.add_node(self.graph.root, cloned);
+                    let idx = self.graph.add_node(self.graph.root, cloned);
+                    self.layout_dirty.insert(idx);
                 }
             }
             GraphMutation::UpdatePath { id, commands } => {
@@ -253,6 +351,7 @@ impl SyncEngine {
                 if ids.is_empty() {
                     return;
                 }
+                self.layout_stale = true;
 
                 let first_idx = match self.graph.index_of(ids[0]) {
                     Some(idx) => idx,
@@ -303,15 +402,14 @@ impl SyncEngine {
                     }
                 }
                 // Initialize bounds for the group so MoveNode can find them
-                self.bounds.insert(
-                    group_idx,
-                    ResolvedBounds {
-                        x: min_x,
-                        y: min_y,
-                        width: if max_x > min_x { max_x - min_x } else { 0.0 },
-                        height: if max_y > min_y { max_y - min_y } else { 0.0 },
-                    },
-                );
+                let group_bounds = ResolvedBounds {
+                    x: min_x,
+                    y: min_y,
+                    width: if max_x > min_x { max_x - min_x } else { 0.0 },
+                    height: if max_y > min_y { max_y - min_y } else { 0.0 },
+                };
+                self.bounds.insert(group_idx, group_bounds);
+                self.spatial.insert(group_idx, group_bounds);
 
                 for &id in &ids {
                     if let Some(idx) = self.graph.index_of(id) {
@@ -331,6 +429,7 @@ impl SyncEngine {
             }
             GraphMutation::UngroupNode { id } => {
                 if let Some(group_idx) = self.graph.index_of(id) {
+                    self.layout_stale = true;
                     let parent_idx = self.graph.parent(group_idx).unwrap_or(self.graph.root);
 
                     let (group_rel_x, group_rel_y) = if let Some(group) = self.graph.get_by_id(id) {
@@ -362,6 +461,7 @@ impl SyncEngine {
 
                     self.graph.remove_node(group_idx);
                     self.bounds.remove(&group_idx);
+                    self.spatial.remove(group_idx);
                 }
             }
             GraphMutation::AddEdge { edge } => {
@@ -375,18 +475,174 @@ impl SyncEngine {
         self.text_dirty = true;
     }
 
-    /// Flush: re-emit the text from the current graph state.
+    /// The node whose block is the only text `mutation` changes, if any.
+    /// Structural edits and anything touching edges or top-level
+    /// constraints return `None` and need a full re-emit.
+    fn patchable_node(&self, mutation: &GraphMutation) -> Option<NodeIndex> {
+        match mutation {
+            // Moving replaces all positioning constraints with an inline
+            // Position, so it's local only if the node had nothing else.
+            GraphMutation::MoveNode { id, .. } => self.graph.get_by_id(*id).and_then(|node| {
+                node.constraints
+                    .iter()
+                    .all(|c| matches!(c, Constraint::Position { .. }))
+                    .then(|| self.graph.index_of(*id))?
+            }),
+            GraphMutation::ResizeNode { id, .. }
+            | GraphMutation::SetStyle { id, .. }
+            | GraphMutation::SetText { id, .. }
+            | GraphMutation::SetAnnotations { id, .. }
+            | GraphMutation::SetAnimations { id, .. }
+            | GraphMutation::UpdatePath { id, .. } => self.graph.index_of(*id),
+            _ => None,
+        }
+    }
+
+    // ─── Batches ─────────────────────────────────────────────────────────
+
+    /// Open a batch: until the matching [`SyncEngine::commit_batch`],
+    /// `resolve()` and `flush_to_text()` only record that they were asked
+    /// for, so many mutations cost one layout pass and one text emit.
+    ///
+    /// Bounds of nodes moved or resized in place stay current inside a
+    /// batch; everything else waits for the commit. Batches nest.
+    pub fn begin_batch(&mut self) {
+        self.batch_depth += 1;
+    }
+
+    /// Close a batch. Closing the outermost one runs each deferred pass
+    /// once: layout first, then text.
+    pub fn commit_batch(&mut self) {
+        if self.batch_depth == 0 {
+            return;
+        }
+        self.batch_depth -= 1;
+        if self.batch_depth > 0 {
+            return;
+        }
+        if std::mem::take(&mut self.batch_resolve) {
+            self.resolve();
+        }
+        if std::mem::take(&mut self.batch_flush) {
+            self.flush_to_text();
+        }
+    }
+
+    /// Whether a batch is open.
+    pub fn in_batch(&self) -> bool {
+        self.batch_depth > 0
+    }
+
+    /// Number of graph changes so far that bypassed
+    /// [`SyncEngine::apply_mutation`]: new text, drop detaches, and edits
+    /// reported through [`SyncEngine::mark_text_stale`]. Undo history uses
+    /// it to tell whether a span of mutations fully describes a change.
+    pub fn direct_edits(&self) -> u64 {
+        self.direct_edits
+    }
+
+    /// Flush: bring the text up to date with the graph.
     /// Called after a batch of mutations (e.g. at end of drag gesture).
+    /// Inside a [batch](SyncEngine::begin_batch) this waits for the commit.
+    ///
+    /// Blocks of nodes changed in place are re-emitted where they sit
+    /// ([`patch_nodes`]); anything else re-emits the whole document.
     pub fn flush_to_text(&mut self) {
-        if self.text_dirty {
-            self.text = emit_document(&self.graph);
-            self.text_dirty = false;
+        if self.batch_depth > 0 {
+            self.batch_flush |= self.text_dirty;
+            return;
+        }
+        self.emit_text();
+    }
+
+    fn emit_text(&mut self) {
+        if !self.text_dirty {
+            return;
+        }
+        let _span = perf::span(Span::SyncFlush);
+        let patched = match &mut self.text_spans {
+            Some(spans) if !self.text_stale => {
+                patch_nodes(&self.graph, &mut self.text, spans, &self.text_patch_nodes)
+            }
+            _ => None,
+        };
+        perf::cache(Cache::TextPatch, patched.is_some());
+        match patched {
+            Some(patches) => {
+                if let Some(log) = &mut self.text_patches {
+                    log.extend(patches);
+                }
+            }
+            None => {
+                let (text, spans) = emit_document_with_spans(&self.graph);
+                self.text = text;
+                self.text_spans = Some(spans);
+                self.text_patches = None;
+            }
         }
+        self.text_patch_nodes.clear();
+        self.text_stale = false;
+        self.text_dirty = false;
+    }
+
+    /// Mark the text out of date after the graph was edited directly rather
+    /// than through [`SyncEngine::apply_mutation`] (e.g. z-order, edges);
+    /// the next flush re-emits the whole document.
+    pub fn mark_text_stale(&mut self) {
+        self.direct_edits += 1;
+        self.text_dirty = true;
+        self.text_stale = true;
+    }
+
+    /// The edit from the text as of the previous call (or the last
+    /// `set_text`) to the current text, as one patch in bytes of that
+    /// older text. `None` if the text was re-emitted wholesale since, so it
+    /// has to be sent in full.
+    pub fn take_text_patch(&mut self) -> Option<TextPatch> {
+        self.emit_text();
+        let patches = self.text_patches.replace(Vec::new())?;
+        Some(TextPatch::coalesce(&patches, &self.text))
     }
 
     /// Re-resolve layout after mutations.
+    ///
+    /// Only the subtrees touched since the last call are recomputed (see
+    /// [`resolve_layout_dirty`]); structural changes and viewport resizes
+    /// fall back to a full [`resolve_layout`]. Inside a
+    /// [batch](SyncEngine::begin_batch) this waits for the commit.
     pub fn resolve(&mut self) {
-        self.bounds = resolve_layout(&self.graph, self.viewport);
+        if self.batch_depth > 0 {
+            self.batch_resolve = true;
+            return;
+        }
+        self.resolve_now();
+    }
+
+    fn resolve_now(&mut self) {
+        let _span = perf::span(Span::SyncResolve);
+        if self.layout_stale || self.viewport != self.resolved_viewport {
+            perf::cache(Cache::Layout, false);
+            self.bounds = resolve_layout(&self.graph, self.viewport);
+        } else if !self.layout_dirty.is_empty() {
+            perf::cache(Cache::Layout, true);
+            resolve_layout_dirty(
+                &self.graph,
+                &mut self.bounds,
+                &self.layout_dirty,
+                self.viewport,
+            );
+        }
+        self.layout_dirty.clear();
+        self.layout_stale = false;
+        self.resolved_viewport = self.viewport;
+        self.spatial.sync(&self.bounds);
+    }
+
+    /// Mark a node whose layout inputs were changed outside
+    /// [`SyncEngine::apply_mutation`] (e.g. z-order within a column), so the
+    /// next [`SyncEngine::resolve`] picks it up.
+    pub fn mark_layout_dirty(&mut self, idx: NodeIndex) {
+        self.layout_dirty.insert(idx);
     }
 
     // ─── Text → Canvas direction ─────────────────────────────────────────
@@ -395,12 +651,61 @@ impl SyncEngine {
     /// Used when the text editor sends a full document update.
     pub fn set_text(&mut self, new_text: &str) -> Result<(), String> {
         let new_graph = parse_document(new_text)?;
-        self.graph = new_graph;
-        self.bounds = resolve_layout(&self.graph, self.viewport);
+        let bounds = resolve_layout(&new_graph, self.viewport);
+        self.replace_document(new_text, new_graph, bounds);
+        Ok(())
+    }
+
+    /// Like [`SyncEngine::set_text`], but restores the graph and layout
+    /// from `snapshot` (see [`SyncEngine::snapshot`]) if it was taken of
+    /// exactly `new_text`, skipping the parse. Any other snapshot (stale,
+    /// foreign or from another format version) falls back to parsing.
+    /// Returns whether the snapshot was used.
+    pub fn set_text_from_snapshot(
+        &mut self,
+        new_text: &str,
+        snapshot: &[u8],
+    ) -> Result<bool, String> {
+        let Ok(restored) = read_snapshot(snapshot, new_text) else {
+            self.set_text(new_text)?;
+            return Ok(false);
+        };
+        let bounds = if restored.viewport == self.viewport {
+            restored.bounds
+        } else {
+            resolve_layout(&restored.graph, self.viewport)
+        };
+        self.replace_document(new_text, restored.graph, bounds);
+        Ok(true)
+    }
+
+    /// Binary snapshot of the current document, its text flushed and its
+    /// layout resolved, for a later [`SyncEngine::set_text_from_snapshot`].
+    pub fn snapshot(&mut self) -> Result<Vec<u8>, String> {
+        self.emit_text();
+        self.resolve_now();
+        write_snapshot(&self.graph, &self.bounds, self.viewport, &self.text)
+    }
+
+    /// Install a new document: `graph` parsed from `new_text`, with
+    /// `bounds` resolved against the current viewport.
+    fn replace_document(&mut self, new_text: &str, graph: SceneGraph, bounds: BoundsMap) {
+        self.direct_edits += 1;
+        self.graph = graph;
+        self.bounds = bounds;
+        self.spatial = SpatialIndex::from_bounds(&self.bounds);
+        self.layout_dirty.clear();
+        self.layout_stale = false;
+        self.resolved_viewport = self.viewport;
         self.text = new_text.to_string();
+        // Hand-written text has no known node spans; the next flush
+        // re-emits in full (and canonicalizes, as before).
+        self.text_spans = None;
+        self.text_patch_nodes.clear();
+        self.text_stale = false;
+        self.text_patches = Some(Vec::new());
         self.graph_dirty = false;
         self.text_dirty = false;
-        Ok(())
     }
 
     /// Incremental text update: only specific line range changed.
@@ -427,6 +732,10 @@ impl SyncEngine {
                 handle_child_group_relationship(&mut self.graph, idx, &mut self.bounds)
         {
             self.last_detach = Some(info);
+            self.direct_edits += 1;
+            self.layout_stale = true;
+            self.text_stale = true;
+            self.spatial.sync(&self.bounds);
             self.text_dirty = true;
             return true;
         }
@@ -435,15 +744,28 @@ impl SyncEngine {
 
     /// Get current text (synced).
     pub fn current_text(&mut self) -> &str {
-        self.flush_to_text();
+        self.emit_text();
         &self.text
     }
 
     /// Get current bounds for all nodes.
-    pub fn current_bounds(&self) -> &HashMap<NodeIndex, ResolvedBounds> {
+    pub fn current_bounds(&self) -> &BoundsMap {
         &self.bounds
     }
 
+    /// Spatial index over [`SyncEngine::current_bounds`], for hit testing.
+    pub fn spatial_index(&self) -> &SpatialIndex {
+        &self.spatial
+    }
+
+    /// Re-index `idx` after its entry in `bounds` was written directly.
+    pub fn reindex_bounds(&mut self, idx: NodeIndex) {
+        match self.bounds.get(&idx) {
+            Some(b) => self.spatial.insert(idx, *b),
+            None => self.spatial.remove(idx),
+        }
+    }
+
     /// Evaluate if a dragging node is near detaching from its parent group.
     /// Returns the parent NodeId and the center coordinates of both the child and parent
     /// if the overlap is less than 25% of the child's area.
@@ -567,11 +889,14 @@ impl SyncEngine {
             expand_group_to_children(&self.graph, group_idx, &mut self.bounds, None);
             if self.bounds.get(&group_idx).copied() != old_bounds {
                 changed = true;
+                // Expansion is provisional until the next resolve, as before
+                self.layout_dirty.insert(group_idx);
             }
         }
 
         if changed {
             self.text_dirty = true;
+            self.spatial.sync(&self.bounds);
         }
         changed
     }
@@ -620,7 +945,7 @@ fn bboxes_overlap(a: &fd_core::ResolvedBounds, b: &fd_core::ResolvedBounds) -> b
 fn handle_child_group_relationship(
     graph: &mut SceneGraph,
     child_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, fd_core::ResolvedBounds>,
+    bounds: &mut BoundsMap,
 ) -> Option<(fd_core::id::NodeId, fd_core::id::NodeId)> {
     let parent_idx = graph.parent(child_idx)?;
 
@@ -691,7 +1016,7 @@ fn group_padding(graph: &SceneGraph, group_idx: NodeIndex) -> f32 {
 fn expand_group_to_children(
     graph: &SceneGraph,
     group_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, fd_core::ResolvedBounds>,
+    bounds: &mut BoundsMap,
     exclude_idx: Option<NodeIndex>,
 ) {
     let pad = group_padding(graph, group_idx);
@@ -736,7 +1061,7 @@ fn detach_child_from_group(
     graph: &mut SceneGraph,
     child_idx: NodeIndex,
     old_parent_idx: NodeIndex,
-    bounds: &mut HashMap<NodeIndex, fd_core::ResolvedBounds>,
+    bounds: &mut BoundsMap,
 ) {
     let child_b = match bounds.get(&child_idx) {
         Some(b) => *b,
@@ -854,6 +1179,7 @@ pub enum GraphMutation {
 #[cfg(test)]
 mod tests {
     use super::*;
+    use fd_core::emitter::emit_document;
 
     #[test]
     fn sync_text_to_canvas() {
@@ -985,6 +1311,125 @@ rect @box {
         assert!(engine.text.contains("accept: \"all tests pass\""));
     }
 
+    #[test]
+    fn sync_batch_defers_resolve_and_flush() {
+        let input = "rect @a { w: 10 h: 10 }\nrect @b { w: 10 h: 10 }\n";
+        let mut engine = SyncEngine::from_text(input, Viewport::default()).unwrap();
+        let text_before = engine.text.clone();
+
+        engine.begin_batch();
+        for id in ["a", "b"] {
+            engine.apply_mutation(GraphMutation::ResizeNode {
+                id: NodeId::intern(id),
+                width: 40.0,
+                height: 30.0,
+            });
+            engine.resolve();
+            engine.flush_to_text();
+        }
+        engine.begin_batch();
+        engine.commit_batch();
+        assert!(engine.in_batch());
+        assert_eq!(engine.text, text_before, "flush waits for the commit");
+
+        engine.commit_batch();
+        assert!(!engine.in_batch());
+        assert_eq!(engine.text.matches("w: 40 h: 30").count(), 2);
+        let b = engine.graph.index_of(NodeId::intern("b")).unwrap();
+        assert_eq!(engine.current_bounds()[&b].width, 40.0);
+    }
+
+    #[test]
+    fn sync_snapshot_restores_document() {
+        let input = "frame @card {\n  w: 200 h: 100\n  layout: column gap=8 pad=16\n  rect @a { w: 50 h: 20 }\n}\n";
+        let viewport = Viewport {
+            width: 800.0,
+            height: 600.0,
+        };
+        let mut engine = SyncEngine::from_text(input, viewport).unwrap();
+        let snapshot = engine.snapshot().unwrap();
+        let text = engine.current_text().to_string();
+
+        let mut reopened = SyncEngine::new(viewport);
+        assert!(reopened.set_text_from_snapshot(&text, &snapshot).unwrap());
+        assert_eq!(
+            reopened.graph.graph.node_count(),
+            engine.graph.graph.node_count()
+        );
+        assert_eq!(reopened.bounds, engine.bounds);
+        let a = reopened.graph.index_of(NodeId::intern("a")).unwrap();
+        let (cx, cy) = reopened.bounds[&a].center();
+        assert!(reopened.spatial_index().query_point(cx, cy).contains(&a));
+        assert_eq!(reopened.current_text(), text);
+
+        // Edited text doesn't match the snapshot: parsed instead
+        let edited = text.replace("w: 50", "w: 60");
+        assert!(!reopened.set_text_from_snapshot(&edited, &snapshot).unwrap());
+        let a = reopened.graph.index_of(NodeId::intern("a")).unwrap();
+        assert_eq!(reopened.bounds[&a].width, 60.0);
+    }
+
+    #[test]
+    fn sync_drag_patches_text_in_place() {
+        let input = r#"
+group @cards {
+  rect @a {
+    w: 100 h: 50
+    x: 10
+  }
+  rect @b {
+    w: 100 h: 50
+    y: 80
+  }
+}
+
+ellipse @dot {
+  w: 20 h: 20
+}
+
+@dot -> center_in: cards
+"#;
+        let viewport = Viewport {
+            width: 800.0,
+            height: 600.0,
+        };
+        let mut engine = SyncEngine::from_text(input, viewport).unwrap();
+        let before = engine.current_text().to_string();
+
+        engine.apply_mutation(GraphMutation::MoveNode {
+            id: NodeId::intern("b"),
+            dx: 15.0,
+            dy: 0.0,
+        });
+        engine.apply_mutation(GraphMutation::ResizeNode {
+            id: NodeId::intern("b"),
+            width: 140.0,
+            height: 50.0,
+        });
+        let patch = engine
+            .take_text_patch()
+            .expect("local edits patch in place");
+        assert_eq!(engine.text, emit_document(&engine.graph));
+        // Only @b's block is rewritten
+        assert!(patch.text.starts_with("  rect @b {") && patch.text.ends_with("}\n"));
+        let mut replayed = before;
+        patch.apply(&mut replayed);
+        assert_eq!(replayed, engine.text);
+
+        // Moving @dot drops its center_in constraint: a full re-emit
+        engine.apply_mutation(GraphMutation::MoveNode {
+            id: NodeId::intern("dot"),
+            dx: 5.0,
+            dy: 5.0,
+        });
+        assert_eq!(engine.take_text_patch(), None);
+        assert_eq!(engine.text, emit_document(&engine.graph));
+
+        // Nothing since the last take: an empty patch
+        let empty = engine.take_text_patch().unwrap();
+        assert!(empty.range.is_empty() && empty.text.is_empty());
+    }
+
     #[test]
     fn sync_annotations_roundtrip() {
         let input = r#"
@@ -1024,6 +1469,97 @@ rect @card {
         );
     }
 
+    #[test]
+    fn sync_resize_reflows_column_incrementally() {
+        let input = r#"
+frame @todo {
+  w: 200 h: 400
+  layout: column gap=8 pad=8
+  rect @card1 { w: 180 h: 40 }
+  rect @card2 { w: 180 h: 40 }
+}
+rect @note { w: 100 h: 40 }
+@note -> center_in: todo
+"#;
+        let viewport = Viewport {
+            width: 800.0,
+            height: 600.0,
+        };
+        let mut engine = SyncEngine::from_text(input, viewport).unwrap();
+
+        engine.apply_mutation(GraphMutation::ResizeNode {
+            id: NodeId::intern("card1"),
+            width: 180.0,
+            height: 100.0,
+        });
+        engine.resolve();
+
+        let card2 = engine.graph.index_of(NodeId::intern("card2")).unwrap();
+        let todo = engine.graph.index_of(NodeId::intern("todo")).unwrap();
+        assert!((engine.bounds[&card2].y - (engine.bounds[&todo].y + 116.0)).abs() < 0.01);
+
+        // Same result as a full re-resolve
+        let full = resolve_layout(&engine.graph, viewport);
+        for (idx, b) in &full {
+            let got = engine.bounds[idx];
+            assert!((got.x - b.x).abs() < 0.01 && (got.y - b.y).abs() < 0.01);
+            assert!((got.width - b.width).abs() < 0.01 && (got.height - b.height).abs() < 0.01);
+        }
+    }
+
+    #[test]
+    fn sync_spatial_index_follows_bounds() {
+        let input = r#"
+group @cluster {
+  rect @a { w: 50 h: 50 x: 0 y: 0 }
+  rect @b { w: 50 h: 50 x: 100 y: 0 }
+}
+rect @c { w: 40 h: 40 x: 400 y: 300 }
+"#;
+        let viewport = Viewport {
+            width: 800.0,
+            height: 600.0,
+        };
+        let mut engine = SyncEngine::from_text(input, viewport).unwrap();
+
+        engine.apply_mutation(GraphMutation::MoveNode {
+            id: NodeId::intern("cluster"),
+            dx: 200.0,
+            dy: 150.0,
+        });
+        engine.apply_mutation(GraphMutation::ResizeNode {
+            id: NodeId::intern("c"),
+            width: 120.0,
+            height: 120.0,
+        });
+        assert_spatial_matches(&engine);
+
+        engine.resolve();
+        assert_spatial_matches(&engine);
+
+        engine.apply_mutation(GraphMutation::RemoveNode {
+            id: NodeId::intern("c"),
+        });
+        engine.resolve();
+        assert_spatial_matches(&engine);
+    }
+
+    fn assert_spatial_matches(engine: &SyncEngine) {
+        use fd_render::hit::{hit_test, hit_test_indexed};
+        let index = engine.spatial_index();
+        assert_eq!(index.len(), engine.bounds.len());
+        for y in (0..600).step_by(10) {
+            for x in (0..800).step_by(10) {
+                let (x, y) = (x as f32, y as f32);
+                assert_eq!(
+                    hit_test_indexed(&engine.graph, index, x, y),
+                    hit_test(&engine.graph, &engine.bounds, x, y),
+                    "point ({x}, {y})"
+                );
+            }
+        }
+    }
+
     #[test]
     fn sync_move_multi_frame_no_jitter() {
         // Simulates a drag gesture across 3 frames.
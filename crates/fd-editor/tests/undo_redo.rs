@@ -231,3 +231,36 @@ fn text_reflects_state_after_undo() {
         "original width should be restored in text"
     );
 }
+
+// ─── Batched edits ──────────────────────────────────────────────────────
+
+#[test]
+fn batch_undoes_as_one_step() {
+    let mut engine = SyncEngine::from_text(
+        "rect @a { w: 10 h: 10 }\nrect @b { w: 10 h: 10 }\nrect @c { w: 10 h: 10 }\n",
+        VIEWPORT,
+    )
+    .unwrap();
+    let mut stack = CommandStack::new(100);
+    let before = engine.current_text().to_string();
+
+    let removals = ["a", "b", "c"]
+        .iter()
+        .map(|id| GraphMutation::RemoveNode {
+            id: NodeId::intern(id),
+        })
+        .collect();
+    stack.execute_batch(&mut engine, removals, "Delete selection");
+    engine.resolve();
+    assert!(engine.graph.get_by_id(NodeId::intern("b")).is_none());
+
+    assert_eq!(stack.undo(&mut engine).as_deref(), Some("Delete selection"));
+    assert!(!stack.can_undo(), "the batch should be a single undo step");
+    engine.resolve();
+    assert_eq!(engine.current_text(), before);
+
+    stack.redo(&mut engine);
+    for id in ["a", "b", "c"] {
+        assert!(engine.graph.get_by_id(NodeId::intern(id)).is_none());
+    }
+}
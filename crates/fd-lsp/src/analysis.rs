@@ -0,0 +1,214 @@
+//! Background diagnostics: debounced, cancellable parse + lint per document.
+//!
+//! `did_change` hands every version to the [`Scheduler`], together with
+//! the tree-sitter syntax errors of the reparsed tree. The `fd-core` parse
+//! always runs; tree-sitter errors only ride along as hints that pin down
+//! ranges its error message can't. Each burst of changes is
+//! coalesced behind a short debounce; a newer version cancels the pending
+//! run for that document, and a run that is already executing on the
+//! blocking pool has its result dropped instead of published. Diagnostics
+//! for the latest version therefore never wait behind stale work.
+
+use crate::diagnostics;
+use crate::document::Document;
+use crate::imports::FileLoader;
+use fd_core::SceneGraph;
+use fd_core::resolve::ImportCache;
+use std::collections::HashMap;
+use std::path::Path;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::{Duration, Instant};
+use tokio::task::JoinHandle;
+use tower_lsp::Client;
+use tower_lsp::lsp_types::*;
+
+/// Quiet period after the last change before analysis starts.
+pub const DEBOUNCE: Duration = Duration::from_millis(150);
+
+pub type Documents = Arc<Mutex<HashMap<Url, Document>>>;
+
+/// Outcome of one full analysis pass.
+pub struct Analysis {
+    pub diagnostics: Vec<Diagnostic>,
+    pub graph: Option<SceneGraph>,
+}
+
+/// Parse with `fd-core` and lint the result. Pure; runs off the async runtime.
+pub fn analyze(text: &str) -> Analysis {
+    match fd_core::parser::parse_document(text) {
+        Ok(graph) => Analysis {
+            diagnostics: diagnostics::lint_diagnostics(text, &graph),
+            graph: Some(graph),
+        },
+        Err(err) => Analysis {
+            diagnostics: vec![diagnostics::parse_error_diagnostic(text, err)],
+            graph: None,
+        },
+    }
+}
+
+/// [`analyze`], then resolve the document's imports relative to `dir`
+/// (if it is a file on disk) through the server's long-lived cache.
+pub fn analyze_with_imports(text: &str, dir: Option<&Path>, imports: &ImportCache) -> Analysis {
+    let mut analysis = analyze(text);
+    if let (Some(dir), Some(graph)) = (dir, &analysis.graph) {
+        let loader = FileLoader::verifying(dir, imports);
+        analysis
+            .diagnostics
+            .extend(crate::imports::import_diagnostic(text, graph, &loader));
+    }
+    analysis
+}
+
+struct Pending {
+    generation: u64,
+    task: JoinHandle<()>,
+}
+
+/// Per-document analysis scheduler.
+#[derive(Clone)]
+pub struct Scheduler {
+    client: Client,
+    documents: Documents,
+    /// Parsed imports, shared by every document's analysis.
+    imports: Arc<ImportCache>,
+    pending: Arc<Mutex<HashMap<Url, Pending>>>,
+    next_generation: Arc<AtomicU64>,
+}
+
+impl Scheduler {
+    pub fn new(client: Client, documents: Documents, imports: Arc<ImportCache>) -> Self {
+        Self {
+            client,
+            documents,
+            imports,
+            pending: Arc::default(),
+            next_generation: Arc::default(),
+        }
+    }
+
+    /// Analyze `text` (document `version`) after `delay`, superseding any
+    /// earlier request for `uri`, and publish the result with `hints`
+    /// appended. `edited_at` is when the triggering change arrived;
+    /// edit→publish latency is logged from it.
+    pub fn schedule(
+        &self,
+        uri: Url,
+        version: i32,
+        text: String,
+        hints: Vec<Diagnostic>,
+        delay: Duration,
+        edited_at: Instant,
+    ) {
+        let generation = self.next_generation.fetch_add(1, Ordering::Relaxed) + 1;
+
+        // Held until the new entry is in place so `finish` can't look for
+        // it first.
+        let mut pending = self.pending.lock().unwrap();
+        let this = self.clone();
+        let task_uri = uri.clone();
+        let dir = uri
+            .to_file_path()
+            .ok()
+            .and_then(|path| path.parent().map(Path::to_path_buf));
+        let task = tokio::spawn(async move {
+            if !delay.is_zero() {
+                tokio::time::sleep(delay).await;
+            }
+            let started = Instant::now();
+            let imports = this.imports.clone();
+            let Ok(mut analysis) = tokio::task::spawn_blocking(move || {
+                analyze_with_imports(&text, dir.as_deref(), &imports)
+            })
+            .await
+            else {
+                return;
+            };
+            analysis.diagnostics.extend(hints);
+            let analysis_time = started.elapsed();
+            this.finish(task_uri, generation, version, analysis, analysis_time, edited_at)
+                .await;
+        });
+
+        if let Some(previous) = pending.insert(uri, Pending { generation, task }) {
+            previous.task.abort();
+        }
+    }
+
+    /// Drop any pending analysis for `uri` (the document was closed).
+    pub fn cancel(&self, uri: &Url) {
+        if let Some(previous) = self.pending.lock().unwrap().remove(uri) {
+            previous.task.abort();
+        }
+    }
+
+    async fn finish(
+        &self,
+        uri: Url,
+        generation: u64,
+        version: i32,
+        analysis: Analysis,
+        analysis_time: Duration,
+        edited_at: Instant,
+    ) {
+        {
+            let mut pending = self.pending.lock().unwrap();
+            match pending.get(&uri) {
+                Some(p) if p.generation == generation => {
+                    pending.remove(&uri);
+                }
+                _ => return, // superseded while running
+            }
+        }
+        {
+            let mut docs = self.documents.lock().unwrap();
+            match docs.get_mut(&uri) {
+                Some(doc) if doc.version() == version => doc.set_graph(analysis.graph),
+                _ => return,
+            }
+        }
+
+        self.client
+            .publish_diagnostics(uri, analysis.diagnostics, Some(version))
+            .await;
+        self.client
+            .log_message(
+                MessageType::LOG,
+                format!(
+                    "diagnostics v{version}: analysis {:.1}ms, edit→publish {:.1}ms",
+                    analysis_time.as_secs_f64() * 1e3,
+                    edited_at.elapsed().as_secs_f64() * 1e3,
+                ),
+            )
+            .await;
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn analyze_valid_document() {
+        let analysis = analyze("rect @box { w: 100 h: 50 fill: #FF0000 }");
+        assert!(analysis.graph.is_some());
+        assert!(
+            analysis
+                .diagnostics
+                .iter()
+                .all(|d| d.severity != Some(DiagnosticSeverity::ERROR))
+        );
+    }
+
+    #[test]
+    fn analyze_reports_parse_errors() {
+        let analysis = analyze("rect @box { w: }}}");
+        assert!(analysis.graph.is_none());
+        assert_eq!(analysis.diagnostics.len(), 1);
+        assert_eq!(
+            analysis.diagnostics[0].severity,
+            Some(DiagnosticSeverity::ERROR)
+        );
+    }
+}
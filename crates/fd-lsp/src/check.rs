@@ -0,0 +1,237 @@
+//! Batch checking: `fd-lsp --check <paths…>`.
+//!
+//! Walks the given files and directories for `.fd` files and checks them
+//! on all cores: the `fd-core` parse, lint and import resolution, plus
+//! tree-sitter syntax errors as hints, the same passes the server runs per
+//! document.
+//! Workers pull the next file from a shared counter, so a few large files
+//! don't leave the other threads idle. Imported files are parsed once per
+//! run through a shared [`ImportCache`], however many files import them.
+
+use crate::analysis;
+use crate::document::{self, Document};
+use crate::imports::{self, FileLoader};
+use fd_core::perf;
+use fd_core::resolve::ImportCache;
+use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use tower_lsp::lsp_types::*;
+
+/// Directories never worth descending into.
+const SKIPPED_DIRS: &[&str] = &["node_modules", "target"];
+
+/// Diagnostics for one checked file.
+pub struct FileReport {
+    pub path: PathBuf,
+    pub diagnostics: Vec<Diagnostic>,
+}
+
+/// Run the check over `args` and print the findings. Returns the process
+/// exit code: 1 if any file has errors, 2 on bad usage.
+pub fn run(args: &[String]) -> i32 {
+    if args.is_empty() {
+        eprintln!("usage: fd-lsp --check <file-or-dir>...");
+        return 2;
+    }
+    let mut files = Vec::new();
+    for arg in args {
+        collect_fd_files(Path::new(arg), &mut files);
+    }
+
+    if let Err(err) = document::syntax_parser() {
+        eprintln!("warning: {err}; syntax hints are disabled");
+    }
+    let cache = ImportCache::new();
+    let reports = check_files(&files, &cache);
+
+    let (mut errors, mut warnings) = (0, 0);
+    for report in &reports {
+        for diag in &report.diagnostics {
+            let severity = match diag.severity {
+                Some(DiagnosticSeverity::ERROR) => {
+                    errors += 1;
+                    "error"
+                }
+                Some(DiagnosticSeverity::WARNING) => {
+                    warnings += 1;
+                    "warning"
+                }
+                Some(DiagnosticSeverity::HINT) => "hint",
+                _ => "info",
+            };
+            let rule = match &diag.code {
+                Some(NumberOrString::String(rule)) => format!(" [{rule}]"),
+                _ => String::new(),
+            };
+            println!(
+                "{}:{}:{}: {severity}: {}{rule}",
+                report.path.display(),
+                diag.range.start.line + 1,
+                diag.range.start.character + 1,
+                diag.message,
+            );
+        }
+    }
+    eprintln!(
+        "checked {} files ({} imported files parsed): {errors} errors, {warnings} warnings",
+        reports.len(),
+        cache.len(),
+    );
+    if perf::is_enabled() {
+        eprintln!(
+            "perf: {}",
+            serde_json::to_string(&perf::stats()).unwrap_or_default()
+        );
+    }
+    i32::from(errors > 0)
+}
+
+/// Check every file on a pool of worker threads. Reports come back in the
+/// order of `files`.
+pub fn check_files(files: &[PathBuf], cache: &ImportCache) -> Vec<FileReport> {
+    let workers = std::thread::available_parallelism()
+        .map_or(1, |n| n.get())
+        .min(files.len())
+        .max(1);
+    let next = AtomicUsize::new(0);
+
+    let mut results: Vec<(usize, FileReport)> = std::thread::scope(|scope| {
+        let handles: Vec<_> = (0..workers)
+            .map(|_| {
+                scope.spawn(|| {
+                    let mut done = Vec::new();
+                    loop {
+                        let i = next.fetch_add(1, Ordering::Relaxed);
+                        let Some(path) = files.get(i) else {
+                            break;
+                        };
+                        done.push((i, check_file(path, cache)));
+                    }
+                    done
+                })
+            })
+            .collect();
+        handles
+            .into_iter()
+            .flat_map(|h| h.join().expect("check worker panicked"))
+            .collect()
+    });
+    results.sort_by_key(|(i, _)| *i);
+    results.into_iter().map(|(_, report)| report).collect()
+}
+
+fn check_file(path: &Path, cache: &ImportCache) -> FileReport {
+    let text = match std::fs::read_to_string(path) {
+        Ok(text) => text,
+        Err(err) => {
+            return FileReport {
+                path: path.to_path_buf(),
+                diagnostics: vec![error_at(
+                    Range::default(),
+                    format!("cannot read file: {err}"),
+                )],
+            };
+        }
+    };
+
+    let analysis::Analysis {
+        mut diagnostics,
+        graph,
+    } = analysis::analyze(&text);
+    if let Some(graph) = &graph {
+        let dir = path.parent().unwrap_or(Path::new("."));
+        let loader = FileLoader::trusting(dir, cache);
+        diagnostics.extend(imports::import_diagnostic(&text, graph, &loader));
+    }
+    // Exact ranges for whatever tree-sitter's recovery found, in addition
+    diagnostics.extend(Document::new(&text, 0).syntax_diagnostics());
+    FileReport {
+        path: path.to_path_buf(),
+        diagnostics,
+    }
+}
+
+fn error_at(range: Range, message: String) -> Diagnostic {
+    Diagnostic {
+        range,
+        severity: Some(DiagnosticSeverity::ERROR),
+        source: Some("fd-lsp".to_string()),
+        message,
+        ..Default::default()
+    }
+}
+
+/// Append `path` if it is an `.fd` file, or every `.fd` file under it,
+/// in sorted order.
+fn collect_fd_files(path: &Path, out: &mut Vec<PathBuf>) {
+    if !path.is_dir() {
+        out.push(path.to_path_buf());
+        return;
+    }
+    let Ok(entries) = std::fs::read_dir(path) else {
+        return;
+    };
+    let mut entries: Vec<PathBuf> = entries.flatten().map(|e| e.path()).collect();
+    entries.sort();
+    for entry in entries {
+        if entry.is_dir() {
+            let name = entry.file_name().and_then(|n| n.to_str()).unwrap_or("");
+            if !name.starts_with('.') && !SKIPPED_DIRS.contains(&name) {
+                collect_fd_files(&entry, out);
+            }
+        } else if entry.extension().is_some_and(|ext| ext == "fd") {
+            out.push(entry);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn checks_tree_and_shares_imports() {
+        let dir = std::env::temp_dir().join(format!("fd-check-{}", std::process::id()));
+        let _ = std::fs::remove_dir_all(&dir);
+        std::fs::create_dir_all(dir.join("pages")).unwrap();
+        std::fs::write(
+            dir.join("kit.fd"),
+            "style accent { fill: #6C5CE7 }\nrect @chip { w: 10 h: 10 }\n",
+        )
+        .unwrap();
+        for page in ["a", "b", "c"] {
+            std::fs::write(
+                dir.join("pages").join(format!("{page}.fd")),
+                format!("import \"../kit.fd\" as kit\nrect @{page} {{ w: 10 h: 10 }}\n"),
+            )
+            .unwrap();
+        }
+        std::fs::write(dir.join("pages/broken.fd"), "rect @x { w: }}}\n").unwrap();
+        std::fs::write(dir.join("pages/orphan.fd"), "import \"nope.fd\" as n\n").unwrap();
+
+        let mut files = Vec::new();
+        collect_fd_files(&dir, &mut files);
+        assert_eq!(files.len(), 6);
+
+        let cache = ImportCache::new();
+        let reports = check_files(&files, &cache);
+        let errors = |name: &str| {
+            reports
+                .iter()
+                .find(|r| r.path.ends_with(name))
+                .unwrap()
+                .diagnostics
+                .iter()
+                .filter(|d| d.severity == Some(DiagnosticSeverity::ERROR))
+                .count()
+        };
+        assert_eq!(errors("pages/a.fd"), 0);
+        assert_eq!(errors("pages/c.fd"), 0);
+        assert!(errors("pages/broken.fd") > 0);
+        assert_eq!(errors("pages/orphan.fd"), 1);
+        // kit.fd and the missing import, each parsed (or tried) once
+        assert_eq!(cache.len(), 2);
+
+        std::fs::remove_dir_all(&dir).unwrap();
+    }
+}
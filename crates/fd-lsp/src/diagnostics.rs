@@ -1,5 +1,7 @@
 //! Diagnostics: parse FD text → LSP diagnostics.
 
+use fd_core::{LintSeverity, SceneGraph};
+use ropey::Rope;
 use tower_lsp::lsp_types::*;
 
 /// Compute diagnostics by parsing the document text.
@@ -7,30 +9,85 @@ use tower_lsp::lsp_types::*;
 /// On parse failure, extracts line/column from the error message and
 /// returns a single diagnostic. On success, returns an empty vec
 /// (clearing previous errors).
+#[cfg(test)]
 pub fn compute_diagnostics(text: &str) -> Vec<Diagnostic> {
     match fd_core::parser::parse_document(text) {
         Ok(_) => Vec::new(),
-        Err(err_msg) => {
-            let (line, col) = extract_error_position(text, &err_msg);
-            vec![Diagnostic {
-                range: Range {
-                    start: Position::new(line, col),
-                    end: Position::new(line, col + 1),
-                },
-                severity: Some(DiagnosticSeverity::ERROR),
-                source: Some("fd-lsp".to_string()),
-                message: err_msg,
+        Err(err_msg) => vec![parse_error_diagnostic(text, err_msg)],
+    }
+}
+
+/// Turn an `fd_core::parser` error message into a diagnostic.
+pub fn parse_error_diagnostic(text: &str, err_msg: String) -> Diagnostic {
+    let rope = Rope::from_str(text);
+    let offset = extract_error_offset(text, &err_msg);
+    let next = text[offset..].chars().next().map_or(0, char::len_utf8);
+    Diagnostic {
+        range: Range {
+            start: offset_to_position(&rope, offset),
+            end: offset_to_position(&rope, offset + next),
+        },
+        severity: Some(DiagnosticSeverity::ERROR),
+        source: Some("fd-lsp".to_string()),
+        message: err_msg,
+        ..Default::default()
+    }
+}
+
+/// Map `fd_core::lint_document` findings onto the source text.
+///
+/// Findings are anchored at the `@id` (or `style name`) declaration; nodes
+/// with generated IDs have no text of their own and sit at the top.
+pub fn lint_diagnostics(text: &str, graph: &SceneGraph) -> Vec<Diagnostic> {
+    let rope = Rope::from_str(text);
+    fd_core::lint_document(graph)
+        .into_iter()
+        .map(|lint| {
+            let id = lint.node_id.as_str();
+            let range = find_declaration(text, id)
+                .map(|(offset, len)| Range {
+                    start: offset_to_position(&rope, offset),
+                    end: offset_to_position(&rope, offset + len),
+                })
+                .unwrap_or_default();
+            Diagnostic {
+                range,
+                severity: Some(match lint.severity {
+                    LintSeverity::Warning => DiagnosticSeverity::WARNING,
+                    LintSeverity::Info => DiagnosticSeverity::INFORMATION,
+                }),
+                code: Some(NumberOrString::String(lint.rule.to_string())),
+                source: Some("fd-lint".to_string()),
+                message: lint.message,
                 ..Default::default()
-            }]
+            }
+        })
+        .collect()
+}
+
+/// Byte offset and length of the first `@id`, `style id` or `theme id`.
+fn find_declaration(text: &str, id: &str) -> Option<(usize, usize)> {
+    let is_ident = |c: char| c.is_alphanumeric() || c == '_';
+    for needle in [format!("@{id}"), format!("style {id}"), format!("theme {id}")] {
+        let mut from = 0;
+        while let Some(found) = text[from..].find(&needle) {
+            let start = from + found;
+            let end = start + needle.len();
+            if !text[end..].starts_with(is_ident) {
+                return Some((start, needle.len()));
+            }
+            from = end;
         }
     }
+    None
 }
 
-/// Best-effort extraction of error position from winnow error messages.
+/// Best-effort extraction of the error's byte offset from winnow error
+/// messages.
 ///
 /// Winnow errors typically contain the remaining unparsed text. We find
-/// where that text appears in the original input to compute line/col.
-fn extract_error_position(source: &str, error: &str) -> (u32, u32) {
+/// where that text appears in the original input.
+fn extract_error_offset(source: &str, error: &str) -> usize {
     // winnow errors often look like: "... at '...remaining...'"
     // Try to find the remaining text in the source
     if let Some(at_idx) = error.find("at '") {
@@ -39,37 +96,24 @@ fn extract_error_position(source: &str, error: &str) -> (u32, u32) {
             let snippet = &remaining[..end];
             // Find this snippet in the source
             if let Some(offset) = source.find(snippet) {
-                return offset_to_line_col(source, offset);
+                return offset;
             }
         }
     }
 
-    // Fallback: report at the end of the document
-    let line_count = source.lines().count();
-    if line_count == 0 {
-        return (0, 0);
-    }
-    let last_line = line_count.saturating_sub(1) as u32;
-    let last_col = source.lines().last().map_or(0, |l| l.len() as u32);
-    (last_line, last_col)
+    // Fallback: report at the end of the last line
+    let body = source.strip_suffix('\n').unwrap_or(source);
+    body.strip_suffix('\r').unwrap_or(body).len()
 }
 
-/// Convert a byte offset in source text to (line, col) zero-indexed.
-fn offset_to_line_col(source: &str, offset: usize) -> (u32, u32) {
-    let mut line = 0u32;
-    let mut col = 0u32;
-    for (i, ch) in source.char_indices() {
-        if i >= offset {
-            break;
-        }
-        if ch == '\n' {
-            line += 1;
-            col = 0;
-        } else {
-            col += 1;
-        }
-    }
-    (line, col)
+/// Convert a byte offset in source text to a zero-indexed LSP position,
+/// whose `character` counts UTF-16 code units.
+fn offset_to_position(rope: &Rope, offset: usize) -> Position {
+    let char_idx = rope.byte_to_char(offset.min(rope.len_bytes()));
+    let line = rope.char_to_line(char_idx);
+    let line_start = rope.line_to_char(line);
+    let character = rope.char_to_utf16_cu(char_idx) - rope.char_to_utf16_cu(line_start);
+    Position::new(line as u32, character as u32)
 }
 
 #[cfg(test)]
@@ -84,12 +128,45 @@ mod tests {
     }
 
     #[test]
-    fn offset_to_line_col_basic() {
+    fn lint_findings_point_at_declarations() {
+        let text = "style unused {\n  fill: #FFF\n}\nrect @box { w: 10 h: 10 }\n";
+        let graph = fd_core::parser::parse_document(text).unwrap();
+        let diags = lint_diagnostics(text, &graph);
+
+        let unused = diags
+            .iter()
+            .find(|d| d.code == Some(NumberOrString::String("unused-style".into())))
+            .expect("unused-style finding");
+        assert_eq!(unused.range.start, Position::new(0, 0));
+        assert_eq!(unused.severity, Some(DiagnosticSeverity::INFORMATION));
+    }
+
+    #[test]
+    fn find_declaration_respects_identifier_boundaries() {
+        let text = "rect @box_2 {}\nrect @box {}";
+        assert_eq!(find_declaration(text, "box"), Some((20, 4)));
+        assert_eq!(find_declaration(text, "missing"), None);
+    }
+
+    #[test]
+    fn offset_to_position_basic() {
         let src = "line0\nline1\nline2";
         //          01234 5 6789A B CDEF0
-        assert_eq!(offset_to_line_col(src, 0), (0, 0));
-        assert_eq!(offset_to_line_col(src, 5), (0, 5));
-        assert_eq!(offset_to_line_col(src, 6), (1, 0));
-        assert_eq!(offset_to_line_col(src, 12), (2, 0));
+        let rope = Rope::from_str(src);
+        assert_eq!(offset_to_position(&rope, 0), Position::new(0, 0));
+        assert_eq!(offset_to_position(&rope, 5), Position::new(0, 5));
+        assert_eq!(offset_to_position(&rope, 6), Position::new(1, 0));
+        assert_eq!(offset_to_position(&rope, 12), Position::new(2, 0));
+    }
+
+    #[test]
+    fn positions_count_utf16_code_units() {
+        // "é" is 2 bytes and 1 code unit, "🎨" is 4 bytes and 2 code units
+        let text = "# é 🎨\nstyle unused { fill: #FFF }\n# 🎨 rect @box { w: 1 }\n";
+        let rope = Rope::from_str(text);
+        let box_at = text.find("@box").unwrap();
+        assert_eq!(offset_to_position(&rope, box_at), Position::new(2, 10));
+        let after_emoji = text.find('🎨').unwrap() + 4;
+        assert_eq!(offset_to_position(&rope, after_emoji), Position::new(0, 6));
     }
 }
@@ -0,0 +1,374 @@
+//! Open-document state: rope text plus an incrementally edited syntax tree.
+//!
+//! Each `didChange` range edit is applied to the rope and mirrored onto the
+//! tree-sitter tree with `Tree::edit`, so the next parse reuses every
+//! subtree outside the edit. The full-text `String` and the `fd-core` scene
+//! graph are derived lazily instead of on every keystroke; the graph is
+//! normally filled in by the background analysis (see `analysis.rs`).
+//!
+//! If the bundled grammar can't be loaded by the linked tree-sitter runtime
+//! (an ABI mismatch), documents keep working without a syntax tree: the
+//! `fd-core` analysis still runs and the tree-based features fall back.
+
+use fd_core::SceneGraph;
+use fd_core::perf::{self, Counter};
+use ropey::Rope;
+use std::ops::Range as ByteRange;
+use tower_lsp::lsp_types::*;
+use tree_sitter::{InputEdit, LogType, Node, Parser, Point, Tree};
+
+pub struct Document {
+    version: i32,
+    rope: Rope,
+    /// `None` if tree-sitter-fd failed to load (see [`syntax_parser`]).
+    parser: Option<Parser>,
+    tree: Option<Tree>,
+    /// Materialized `rope` text; `None` after an edit.
+    text: Option<String>,
+    /// Cached `parse_document` result; `None` after an edit.
+    graph: Option<Option<SceneGraph>>,
+    /// Byte spans of the blocks behind the last folding response, moved
+    /// along by edits; spans an edit touches are dropped.
+    folds: Option<Vec<ByteRange<usize>>>,
+    /// Bytes edited or syntactically changed since `folds` was stored.
+    changed: Option<ByteRange<usize>>,
+}
+
+/// A parser for tree-sitter-fd, or why the grammar can't be loaded (its
+/// ABI version is outside what the linked tree-sitter runtime accepts).
+pub fn syntax_parser() -> Result<Parser, String> {
+    let mut parser = Parser::new();
+    parser
+        .set_language(&tree_sitter_fd::LANGUAGE.into())
+        .map_err(|err| format!("tree-sitter-fd grammar cannot be loaded: {err}"))?;
+    Ok(parser)
+}
+
+impl Document {
+    /// Falls back to no syntax tree if [`syntax_parser`] fails; the server
+    /// reports that error once at startup.
+    pub fn new(text: &str, version: i32) -> Self {
+        let mut doc = Self {
+            version,
+            rope: Rope::from_str(text),
+            parser: syntax_parser().ok(),
+            tree: None,
+            text: None,
+            graph: None,
+            folds: None,
+            changed: None,
+        };
+        doc.reparse();
+        doc
+    }
+
+    pub fn version(&self) -> i32 {
+        self.version
+    }
+
+    pub fn set_version(&mut self, version: i32) {
+        self.version = version;
+    }
+
+    /// Apply one `didChange` content change. Call [`Document::reparse`]
+    /// once after the whole batch.
+    pub fn apply_change(&mut self, change: &TextDocumentContentChangeEvent) {
+        self.text = None;
+        self.graph = None;
+
+        let Some(range) = change.range else {
+            // Whole-document replacement: nothing to reuse.
+            self.rope = Rope::from_str(&change.text);
+            self.tree = None;
+            self.folds = None;
+            self.changed = None;
+            return;
+        };
+
+        let start_char = self.position_to_char(range.start);
+        let end_char = self.position_to_char(range.end).max(start_char);
+        let start_byte = self.rope.char_to_byte(start_char);
+        let old_end_byte = self.rope.char_to_byte(end_char);
+        let start_position = self.byte_to_point(start_byte);
+        let old_end_position = self.byte_to_point(old_end_byte);
+
+        self.rope.remove(start_char..end_char);
+        self.rope.insert(start_char, &change.text);
+
+        let new_end_byte = start_byte + change.text.len();
+        let new_end_position = self.byte_to_point(new_end_byte);
+
+        // Bytes after the edit keep their text but move
+        let moved = |byte: usize| {
+            if byte >= old_end_byte {
+                byte - old_end_byte + new_end_byte
+            } else {
+                byte
+            }
+        };
+        if let Some(folds) = &mut self.folds {
+            folds.retain_mut(|span| {
+                if span.end <= start_byte {
+                    return true;
+                }
+                if span.start < old_end_byte {
+                    return false;
+                }
+                *span = moved(span.start)..moved(span.end);
+                true
+            });
+        }
+        self.changed = Some(match self.changed.take() {
+            Some(changed) => changed.start.min(start_byte)..moved(changed.end).max(new_end_byte),
+            None => start_byte..new_end_byte,
+        });
+
+        if let Some(tree) = &mut self.tree {
+            tree.edit(&InputEdit {
+                start_byte,
+                old_end_byte,
+                new_end_byte,
+                start_position,
+                old_end_position,
+                new_end_position,
+            });
+        }
+    }
+
+    /// Reparse against the edited tree, reading straight from rope chunks.
+    ///
+    /// While perf stats are on, the parser logs and its error recoveries
+    /// are counted; the logger is removed again when they're turned off.
+    pub fn reparse(&mut self) {
+        let Some(parser) = &mut self.parser else {
+            return;
+        };
+        let counting = perf::is_enabled();
+        if counting && parser.logger().is_none() {
+            parser.set_logger(Some(Box::new(count_recoveries)));
+        } else if !counting && parser.logger().is_some() {
+            parser.set_logger(None);
+        }
+        let rope = &self.rope;
+        let mut read = |byte: usize, _: Point| {
+            if byte >= rope.len_bytes() {
+                return &b""[..];
+            }
+            let (chunk, chunk_start, _, _) = rope.chunk_at_byte(byte);
+            &chunk.as_bytes()[byte - chunk_start..]
+        };
+        let tree = parser.parse_with(&mut read, self.tree.as_ref());
+
+        // An edit can change the syntax outside its own bytes (e.g. `{`
+        // typed ahead of a block)
+        if let (Some(old), Some(new)) = (&self.tree, &tree) {
+            let changed: Vec<_> = old.changed_ranges(new).collect();
+            for range in changed {
+                self.changed = Some(match self.changed.take() {
+                    Some(c) => c.start.min(range.start_byte)..c.end.max(range.end_byte),
+                    None => range.start_byte..range.end_byte,
+                });
+            }
+        }
+        self.tree = tree;
+    }
+
+    /// Full document text, materialized on first use after an edit.
+    pub fn text(&mut self) -> &str {
+        self.text.get_or_insert_with(|| self.rope.to_string())
+    }
+
+    /// Text and scene graph together (the graph is rebuilt on first use
+    /// after an edit).
+    pub fn snapshot(&mut self) -> (&str, Option<&SceneGraph>) {
+        let text = self.text.get_or_insert_with(|| self.rope.to_string());
+        let graph = self
+            .graph
+            .get_or_insert_with(|| fd_core::parser::parse_document(text).ok());
+        (text.as_str(), graph.as_ref())
+    }
+
+    /// The current syntax tree (`None` if the parser gave up or the grammar
+    /// couldn't be loaded).
+    pub fn tree(&self) -> Option<&Tree> {
+        self.tree.as_ref()
+    }
+
+    /// Source text of `node`, read from the rope.
+    pub fn node_text(&self, node: Node) -> String {
+        self.rope.byte_slice(node.byte_range()).to_string()
+    }
+
+    /// LSP range of `node`.
+    pub fn node_range(&self, node: Node) -> Range {
+        Range {
+            start: self.point_to_position(node.start_position()),
+            end: self.point_to_position(node.end_position()),
+        }
+    }
+
+    /// The fold spans stored by [`Document::store_folds`] (`None` before
+    /// the first, or after a full replacement), and the byte range that
+    /// changed since. Both are cleared.
+    pub fn take_folds(&mut self) -> (Option<Vec<ByteRange<usize>>>, Option<ByteRange<usize>>) {
+        (self.folds.take(), self.changed.take())
+    }
+
+    pub fn store_folds(&mut self, spans: Vec<ByteRange<usize>>) {
+        self.folds = Some(spans);
+        self.changed = None;
+    }
+
+    /// Zero-based line of `byte`.
+    pub fn line_of_byte(&self, byte: usize) -> u32 {
+        self.rope.byte_to_line(byte.min(self.rope.len_bytes())) as u32
+    }
+
+    /// Store the scene graph from a background analysis of this version.
+    pub fn set_graph(&mut self, graph: Option<SceneGraph>) {
+        self.graph = Some(graph);
+    }
+
+    /// Syntax errors from the tree-sitter tree, as hints.
+    ///
+    /// `fd-core`'s parser decides whether the document is valid; these only
+    /// mark the exact ranges tree-sitter's recovery found, next to its
+    /// diagnostics. Only subtrees flagged `has_error` are entered, so a
+    /// clean document costs one check at the root and an edit near an error
+    /// only walks the path down to it.
+    pub fn syntax_diagnostics(&self) -> Vec<Diagnostic> {
+        let mut diags = Vec::new();
+        if let Some(tree) = &self.tree {
+            self.collect_errors(tree.root_node(), &mut diags);
+        }
+        diags
+    }
+
+    fn collect_errors(&self, node: Node, diags: &mut Vec<Diagnostic>) {
+        if !node.has_error() {
+            return;
+        }
+        if node.is_error() || node.is_missing() {
+            let message = if node.is_missing() {
+                format!("missing `{}`", node.kind())
+            } else {
+                "syntax error".to_string()
+            };
+            diags.push(Diagnostic {
+                range: self.node_range(node),
+                severity: Some(DiagnosticSeverity::HINT),
+                source: Some("tree-sitter-fd".to_string()),
+                message,
+                ..Default::default()
+            });
+            return;
+        }
+        let mut cursor = node.walk();
+        for child in node.children(&mut cursor) {
+            self.collect_errors(child, diags);
+        }
+    }
+
+    // ─── Position conversion ─────────────────────────────────────────────
+    //
+    // LSP positions count UTF-16 code units; tree-sitter points count bytes.
+
+    fn position_to_char(&self, position: Position) -> usize {
+        let line = position.line as usize;
+        if line >= self.rope.len_lines() {
+            return self.rope.len_chars();
+        }
+        let line_start = self.rope.line_to_char(line);
+        let line_end = line_start + self.rope.line(line).len_chars();
+        let line_start_cu = self.rope.char_to_utf16_cu(line_start);
+        let target_cu = line_start_cu + position.character as usize;
+        let max_cu = self.rope.char_to_utf16_cu(line_end);
+        self.rope.utf16_cu_to_char(target_cu.min(max_cu))
+    }
+
+    fn byte_to_point(&self, byte: usize) -> Point {
+        let row = self.rope.byte_to_line(byte);
+        Point::new(row, byte - self.rope.line_to_byte(row))
+    }
+
+    fn point_to_position(&self, point: Point) -> Position {
+        let row = point.row.min(self.rope.len_lines().saturating_sub(1));
+        let line_start_byte = self.rope.line_to_byte(row);
+        let byte = (line_start_byte + point.column).min(self.rope.len_bytes());
+        let line_start_char = self.rope.byte_to_char(line_start_byte);
+        let char_idx = self.rope.byte_to_char(byte);
+        let character =
+            self.rope.char_to_utf16_cu(char_idx) - self.rope.char_to_utf16_cu(line_start_char);
+        Position::new(row as u32, character as u32)
+    }
+}
+
+/// Parser log hook: tree-sitter logs each error recovery strategy it
+/// applies (`recover_to_previous`, `recover_with_missing`, `recover_eof`).
+fn count_recoveries(log_type: LogType, message: &str) {
+    if matches!(log_type, LogType::Parse) && message.starts_with("recover") {
+        perf::add(Counter::SyntaxRecoveries, 1);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn edit(start: (u32, u32), end: (u32, u32), text: &str) -> TextDocumentContentChangeEvent {
+        TextDocumentContentChangeEvent {
+            range: Some(Range {
+                start: Position::new(start.0, start.1),
+                end: Position::new(end.0, end.1),
+            }),
+            range_length: None,
+            text: text.to_string(),
+        }
+    }
+
+    #[test]
+    fn apply_range_edits() {
+        let mut doc = Document::new("rect @box {\n  w: 100\n}\n", 0);
+        doc.apply_change(&edit((1, 5), (1, 8), "240"));
+        doc.apply_change(&edit((1, 8), (1, 8), " h: 50"));
+        doc.reparse();
+        assert_eq!(doc.text(), "rect @box {\n  w: 240 h: 50\n}\n");
+
+        let tree = doc.tree.as_ref().unwrap();
+        assert_eq!(tree.root_node().end_byte(), doc.rope.len_bytes());
+    }
+
+    #[test]
+    fn utf16_positions() {
+        // "→" is one UTF-16 unit but three UTF-8 bytes.
+        let mut doc = Document::new("text @t \"→ab\" {}\n", 0);
+        doc.apply_change(&edit((0, 10), (0, 11), "c"));
+        doc.reparse();
+        assert_eq!(doc.text(), "text @t \"→cb\" {}\n");
+    }
+
+    #[test]
+    fn full_replacement_and_graph_cache() {
+        let mut doc = Document::new("rect @a { w: 10 h: 10 }\n", 0);
+        assert!(doc.snapshot().1.unwrap().get_by_id(fd_core::NodeId::intern("a")).is_some());
+
+        doc.apply_change(&TextDocumentContentChangeEvent {
+            range: None,
+            range_length: None,
+            text: "rect @b { w: 10 h: 10 }\n".to_string(),
+        });
+        doc.reparse();
+        let (_, graph) = doc.snapshot();
+        assert!(graph.unwrap().get_by_id(fd_core::NodeId::intern("b")).is_some());
+    }
+
+    #[test]
+    fn syntax_errors_are_reported() {
+        let mut doc = Document::new("rect @box {\n  w: 100\n}\n", 0);
+        assert!(doc.syntax_diagnostics().is_empty());
+
+        doc.apply_change(&edit((2, 0), (2, 1), ""));
+        doc.reparse();
+        assert!(!doc.syntax_diagnostics().is_empty());
+    }
+}
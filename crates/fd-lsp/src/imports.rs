@@ -0,0 +1,122 @@
+//! Filesystem import loading shared by the server and `--check`.
+//!
+//! Imports resolve relative to the importing file's directory. Parsed
+//! imports are shared through an [`ImportCache`] keyed by canonical path:
+//! the batch check trusts an entry for the whole run, while the server
+//! re-reads the file and reparses only when its content hash changed, and
+//! drops entries for files the client reports as changed or deleted.
+
+use fd_core::SceneGraph;
+use fd_core::resolve::{ImportCache, ImportLoader, resolve_imports};
+use std::path::{Path, PathBuf};
+use std::sync::Arc;
+use tower_lsp::lsp_types::*;
+
+pub struct FileLoader<'a> {
+    dir: &'a Path,
+    cache: &'a ImportCache,
+    /// Check cached entries against the file's current content.
+    verify: bool,
+}
+
+impl<'a> FileLoader<'a> {
+    /// Loader for a one-shot run: files don't change underneath it.
+    pub fn trusting(dir: &'a Path, cache: &'a ImportCache) -> Self {
+        Self {
+            dir,
+            cache,
+            verify: false,
+        }
+    }
+
+    /// Loader for a long-lived cache: every use re-reads the file, and
+    /// only a content change costs a reparse.
+    pub fn verifying(dir: &'a Path, cache: &'a ImportCache) -> Self {
+        Self {
+            dir,
+            cache,
+            verify: true,
+        }
+    }
+}
+
+impl ImportLoader for FileLoader<'_> {
+    fn load(&self, path: &str) -> Result<String, String> {
+        std::fs::read_to_string(self.dir.join(path))
+            .map_err(|err| format!("Cannot read import \"{path}\": {err}"))
+    }
+
+    fn parse(&self, path: &str) -> Result<Arc<SceneGraph>, String> {
+        let key = cache_key(&self.dir.join(path));
+        if self.verify {
+            self.cache.get_or_parse_source(&key, path, self.load(path)?)
+        } else {
+            self.cache.get_or_parse(&key, path, || self.load(path))
+        }
+    }
+}
+
+/// Cache identity of a file: its canonical path, or the path as given if
+/// it can't be canonicalized (e.g. it was just deleted).
+pub fn cache_key(file: &Path) -> String {
+    let file = std::fs::canonicalize(file).unwrap_or_else(|_| PathBuf::from(file));
+    file.to_string_lossy().into_owned()
+}
+
+/// Resolve the imports of `graph` (the parse of `text`) on a copy, turning
+/// a failure into an error on the first `import` line.
+pub fn import_diagnostic(
+    text: &str,
+    graph: &SceneGraph,
+    loader: &dyn ImportLoader,
+) -> Option<Diagnostic> {
+    if graph.imports.is_empty() {
+        return None;
+    }
+    let err = resolve_imports(&mut graph.clone(), loader).err()?;
+    let range = text
+        .lines()
+        .position(|line| line.trim_start().starts_with("import "))
+        .map(|line| {
+            let line = line as u32;
+            Range::new(Position::new(line, 0), Position::new(line, 0))
+        })
+        .unwrap_or_default();
+    Some(Diagnostic {
+        range,
+        severity: Some(DiagnosticSeverity::ERROR),
+        source: Some("fd-lsp".to_string()),
+        message: err,
+        ..Default::default()
+    })
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn verifying_loader_follows_file_edits() {
+        let dir = std::env::temp_dir().join(format!("fd-imports-{}", std::process::id()));
+        let _ = std::fs::remove_dir_all(&dir);
+        std::fs::create_dir_all(&dir).unwrap();
+        std::fs::write(dir.join("kit.fd"), "style accent { fill: #6C5CE7 }\n").unwrap();
+        let text = "import \"kit.fd\" as kit\nrect @a { w: 10 h: 10 }\n";
+        let graph = fd_core::parser::parse_document(text).unwrap();
+
+        let cache = ImportCache::new();
+        let loader = FileLoader::verifying(&dir, &cache);
+        assert!(import_diagnostic(text, &graph, &loader).is_none());
+        let first = loader.parse("kit.fd").unwrap();
+        assert!(Arc::ptr_eq(&first, &loader.parse("kit.fd").unwrap()));
+
+        // An edit is picked up without any invalidation
+        std::fs::write(dir.join("kit.fd"), "rect @x { w: }}}\n").unwrap();
+        let diag = import_diagnostic(text, &graph, &loader).unwrap();
+        assert!(diag.message.contains("kit.fd"));
+        assert_eq!(diag.range.start.line, 0);
+
+        assert!(cache.invalidate(&cache_key(&dir.join("kit.fd"))));
+        std::fs::remove_dir_all(&dir).unwrap();
+    }
+}
@@ -3,58 +3,88 @@
 //! A `tower-lsp` based LSP server that wraps `fd-core` for real-time
 //! editor feedback in any LSP-compatible editor (Zed, Neovim, Helix, etc.).
 
+mod analysis;
+mod check;
 mod completion;
 mod diagnostics;
+mod document;
 mod hover;
+mod imports;
+mod outline;
 mod symbols;
 
-use std::sync::Mutex;
+use analysis::{DEBOUNCE, Documents, Scheduler};
+use document::Document;
+use fd_core::perf::{self, PerfStats};
+use fd_core::resolve::ImportCache;
+use std::sync::Arc;
+use std::time::{Duration, Instant};
 use tower_lsp::jsonrpc::Result;
 use tower_lsp::lsp_types::*;
 use tower_lsp::{Client, LanguageServer, LspService, Server};
 
-/// Cached parse state for a single document.
-struct DocumentState {
-    text: String,
-    graph: Option<fd_core::SceneGraph>,
-}
-
 /// The FD language server backend.
 struct FdLanguageServer {
     client: Client,
     /// Cached document state by URI.
-    documents: Mutex<std::collections::HashMap<Url, DocumentState>>,
+    documents: Documents,
+    /// Background parse + lint.
+    analysis: Scheduler,
+    /// Parsed imports shared by all documents; entries are dropped when
+    /// the client reports their file changed.
+    imports: Arc<ImportCache>,
 }
 
 impl FdLanguageServer {
     fn new(client: Client) -> Self {
+        let documents = Documents::default();
+        let imports = Arc::new(ImportCache::new());
         Self {
+            analysis: Scheduler::new(client.clone(), documents.clone(), imports.clone()),
             client,
-            documents: Mutex::new(std::collections::HashMap::new()),
+            documents,
+            imports,
         }
     }
 
-    /// Reparse a document and publish diagnostics.
-    async fn on_change(&self, uri: Url, text: String) {
-        let diags = diagnostics::compute_diagnostics(&text);
-        let graph = fd_core::parser::parse_document(&text).ok();
+    /// `fd/perfStats`: timings, counters and cache hit rates recorded since
+    /// startup (see [`perf`]). Recording is off unless the client passes
+    /// `{"perfStats": true}` as initialization options or `FD_PERF=1` is set.
+    async fn perf_stats(&self) -> Result<PerfStats> {
+        Ok(perf::stats())
+    }
 
-        {
+    /// Queue a full analysis of the current version, with the freshly
+    /// reparsed tree's syntax errors attached as hints.
+    async fn update_diagnostics(&self, uri: Url, delay: Duration, edited_at: Instant) {
+        let (version, hints, text) = {
             let mut docs = self.documents.lock().unwrap();
-            docs.insert(uri.clone(), DocumentState { text, graph });
-        }
-
-        self.client.publish_diagnostics(uri, diags, None).await;
+            let Some(doc) = docs.get_mut(&uri) else {
+                return;
+            };
+            let hints = doc.syntax_diagnostics();
+            (doc.version(), hints, doc.text().to_string())
+        };
+        self.analysis
+            .schedule(uri, version, text, hints, delay, edited_at);
     }
 }
 
 #[tower_lsp::async_trait]
 impl LanguageServer for FdLanguageServer {
-    async fn initialize(&self, _: InitializeParams) -> Result<InitializeResult> {
+    async fn initialize(&self, params: InitializeParams) -> Result<InitializeResult> {
+        let perf_stats = params
+            .initialization_options
+            .as_ref()
+            .and_then(|options| options.get("perfStats"))
+            .and_then(serde_json::Value::as_bool);
+        if perf_stats == Some(true) {
+            perf::enable(perf::monotonic_ms);
+        }
         Ok(InitializeResult {
             capabilities: ServerCapabilities {
                 text_document_sync: Some(TextDocumentSyncCapability::Kind(
-                    TextDocumentSyncKind::FULL,
+                    TextDocumentSyncKind::INCREMENTAL,
                 )),
                 completion_provider: Some(CompletionOptions {
                     trigger_characters: Some(vec![
@@ -66,6 +96,7 @@ impl LanguageServer for FdLanguageServer {
                 }),
                 hover_provider: Some(HoverProviderCapability::Simple(true)),
                 document_symbol_provider: Some(OneOf::Left(true)),
+                folding_range_provider: Some(FoldingRangeProviderCapability::Simple(true)),
                 ..Default::default()
             },
             ..Default::default()
@@ -76,6 +107,48 @@ impl LanguageServer for FdLanguageServer {
         self.client
             .log_message(MessageType::INFO, "fd-lsp initialized")
             .await;
+        if let Err(err) = document::syntax_parser() {
+            self.client
+                .log_message(
+                    MessageType::ERROR,
+                    format!("fd-lsp: {err}; syntax trees, outline and folds are disabled"),
+                )
+                .await;
+        }
+        for err in outline::query_errors() {
+            self.client
+                .log_message(MessageType::ERROR, format!("fd-lsp: {err}"))
+                .await;
+        }
+
+        // Watch `.fd` files so edits to imported files invalidate the cache
+        let watchers = DidChangeWatchedFilesRegistrationOptions {
+            watchers: vec![FileSystemWatcher {
+                glob_pattern: GlobPattern::String("**/*.fd".to_string()),
+                kind: None,
+            }],
+        };
+        let registration = Registration {
+            id: "fd-watch".to_string(),
+            method: "workspace/didChangeWatchedFiles".to_string(),
+            register_options: serde_json::to_value(watchers).ok(),
+        };
+        if let Err(err) = self.client.register_capability(vec![registration]).await {
+            self.client
+                .log_message(
+                    MessageType::WARNING,
+                    format!("fd-lsp: file watching unavailable: {err}"),
+                )
+                .await;
+        }
+    }
+
+    async fn did_change_watched_files(&self, params: DidChangeWatchedFilesParams) {
+        for change in params.changes {
+            if let Ok(path) = change.uri.to_file_path() {
+                self.imports.invalidate(&imports::cache_key(&path));
+            }
+        }
     }
 
     async fn shutdown(&self) -> Result<()> {
@@ -83,31 +156,44 @@ impl LanguageServer for FdLanguageServer {
     }
 
     async fn did_open(&self, params: DidOpenTextDocumentParams) {
+        let opened_at = Instant::now();
         let uri = params.text_document.uri;
-        let text = params.text_document.text;
-        self.on_change(uri, text).await;
+        let doc = Document::new(&params.text_document.text, params.text_document.version);
+        self.documents.lock().unwrap().insert(uri.clone(), doc);
+        self.update_diagnostics(uri, Duration::ZERO, opened_at).await;
     }
 
     async fn did_change(&self, params: DidChangeTextDocumentParams) {
+        let edited_at = Instant::now();
         let uri = params.text_document.uri;
-        if let Some(change) = params.content_changes.into_iter().next_back() {
-            self.on_change(uri, change.text).await;
+        {
+            let mut docs = self.documents.lock().unwrap();
+            let Some(doc) = docs.get_mut(&uri) else {
+                return;
+            };
+            // Changes apply in order, each relative to the previous one.
+            for change in &params.content_changes {
+                doc.apply_change(change);
+            }
+            doc.reparse();
+            doc.set_version(params.text_document.version);
         }
+        self.update_diagnostics(uri, DEBOUNCE, edited_at).await;
     }
 
     async fn did_close(&self, params: DidCloseTextDocumentParams) {
         let uri = params.text_document.uri;
-        let mut docs = self.documents.lock().unwrap();
-        docs.remove(&uri);
+        self.analysis.cancel(&uri);
+        self.documents.lock().unwrap().remove(&uri);
     }
 
     async fn completion(&self, params: CompletionParams) -> Result<Option<CompletionResponse>> {
         let uri = &params.text_document_position.text_document.uri;
         let pos = params.text_document_position.position;
 
-        let docs = self.documents.lock().unwrap();
-        let items = if let Some(doc) = docs.get(uri) {
-            completion::compute_completions(&doc.text, pos)
+        let mut docs = self.documents.lock().unwrap();
+        let items = if let Some(doc) = docs.get_mut(uri) {
+            completion::compute_completions(doc.text(), pos)
         } else {
             Vec::new()
         };
@@ -119,9 +205,10 @@ impl LanguageServer for FdLanguageServer {
         let uri = &params.text_document_position_params.text_document.uri;
         let pos = params.text_document_position_params.position;
 
-        let docs = self.documents.lock().unwrap();
-        if let Some(doc) = docs.get(uri) {
-            Ok(hover::compute_hover(&doc.text, pos, doc.graph.as_ref()))
+        let mut docs = self.documents.lock().unwrap();
+        if let Some(doc) = docs.get_mut(uri) {
+            let (text, graph) = doc.snapshot();
+            Ok(hover::compute_hover(text, pos, graph))
         } else {
             Ok(None)
         }
@@ -133,13 +220,23 @@ impl LanguageServer for FdLanguageServer {
     ) -> Result<Option<DocumentSymbolResponse>> {
         let uri = &params.text_document.uri;
 
-        let docs = self.documents.lock().unwrap();
-        if let Some(doc) = docs.get(uri) {
-            let syms = symbols::compute_symbols(&doc.text, doc.graph.as_ref());
-            Ok(Some(DocumentSymbolResponse::Flat(syms)))
-        } else {
-            Ok(Some(DocumentSymbolResponse::Flat(Vec::new())))
+        let mut docs = self.documents.lock().unwrap();
+        let Some(doc) = docs.get_mut(uri) else {
+            return Ok(Some(DocumentSymbolResponse::Flat(Vec::new())));
+        };
+        if let Some(syms) = outline::document_symbols(doc, None) {
+            return Ok(Some(DocumentSymbolResponse::Nested(syms)));
         }
+        let (text, graph) = doc.snapshot();
+        let syms = symbols::compute_symbols(text, graph);
+        Ok(Some(DocumentSymbolResponse::Flat(syms)))
+    }
+
+    async fn folding_range(&self, params: FoldingRangeParams) -> Result<Option<Vec<FoldingRange>>> {
+        let mut docs = self.documents.lock().unwrap();
+        Ok(docs
+            .get_mut(&params.text_document.uri)
+            .and_then(outline::changed_folding_ranges))
     }
 }
 
@@ -150,6 +247,12 @@ async fn main() {
     // Used by the VS Code extension's DocumentFormattingEditProvider so that
     // `Option+Shift+F` works without a full LSP handshake.
     let args: Vec<String> = std::env::args().collect();
+
+    // `FD_PERF=1` records timings and counters in every mode: served by
+    // `fd/perfStats`, and printed after a `--check` run.
+    if std::env::var_os("FD_PERF").is_some_and(|v| !v.is_empty() && v != "0") {
+        perf::enable(perf::monotonic_ms);
+    }
     if args.get(1).map(|s| s.as_str()) == Some("--format") {
         use std::io::Read;
         let mut text = String::new();
@@ -168,6 +271,14 @@ async fn main() {
         return;
     }
 
+    // ── `fd-lsp --check <paths…>` mode ──────────────────────────────────
+    // Parses, resolves imports and lints every `.fd` file under the given
+    // paths in parallel, prints `file:line:col: severity: message` lines,
+    // and exits non-zero if any file has errors. Meant for CI.
+    if args.get(1).map(|s| s.as_str()) == Some("--check") {
+        std::process::exit(check::run(&args[2..]));
+    }
+
     // ── `fd-lsp --view <mode>` mode ─────────────────────────────────────
     // Reads FD source from stdin, emits a filtered view on stdout.
     if args.get(1).map(|s| s.as_str()) == Some("--view") {
@@ -209,6 +320,8 @@ async fn main() {
     let stdin = tokio::io::stdin();
     let stdout = tokio::io::stdout();
 
-    let (service, socket) = LspService::new(FdLanguageServer::new);
+    let (service, socket) = LspService::build(FdLanguageServer::new)
+        .custom_method("fd/perfStats", FdLanguageServer::perf_stats)
+        .finish();
     Server::new(stdin, stdout, socket).serve(service).await;
 }
@@ -0,0 +1,257 @@
+//! Document symbols and folding ranges from tree-sitter-fd's queries.
+//!
+//! `queries/outline.scm` and `queries/folds.scm` are compiled once and run
+//! with a `QueryCursor` over the document's cached tree, so neither request
+//! needs a fresh parse or a scene graph. Both accept a byte range to limit
+//! the cursor to (e.g. the visible part of the document); the server's
+//! folding requests limit it to the bytes changed since the last one.
+
+use crate::document::Document;
+use std::cmp::Reverse;
+use std::ops::Range as ByteRange;
+use std::sync::LazyLock;
+use streaming_iterator::StreamingIterator;
+use tower_lsp::lsp_types::*;
+use tree_sitter::{Node, Query, QueryCursor};
+
+/// An error if the query doesn't match the compiled grammar (e.g. parser.c
+/// not regenerated); [`query_errors`] reports it, and callers fall back to
+/// `symbols.rs`.
+static OUTLINE: LazyLock<Result<Query, String>> =
+    LazyLock::new(|| compile("outline.scm", tree_sitter_fd::OUTLINE_QUERY));
+static FOLDS: LazyLock<Result<Query, String>> =
+    LazyLock::new(|| compile("folds.scm", tree_sitter_fd::FOLDS_QUERY));
+
+fn compile(name: &str, source: &str) -> Result<Query, String> {
+    Query::new(&tree_sitter_fd::LANGUAGE.into(), source)
+        .map_err(|err| format!("tree-sitter-fd {name} does not compile: {err}"))
+}
+
+/// Why the outline or folds query failed to compile, for the server to log
+/// at startup.
+pub fn query_errors() -> Vec<String> {
+    [&*OUTLINE, &*FOLDS]
+        .into_iter()
+        .filter_map(|query| query.as_ref().err().cloned())
+        .collect()
+}
+
+/// Node text for query predicates (`#eq?` and friends), read from the rope.
+fn text_provider(doc: &Document) -> impl FnMut(Node) -> std::vec::IntoIter<String> + '_ {
+    move |node| vec![doc.node_text(node)].into_iter()
+}
+
+/// Nested outline of `doc`, optionally limited to `range`.
+pub fn document_symbols(
+    doc: &Document,
+    range: Option<ByteRange<usize>>,
+) -> Option<Vec<DocumentSymbol>> {
+    let query = OUTLINE.as_ref().ok()?;
+    let tree = doc.tree()?;
+    let item_idx = query.capture_index_for_name("item")?;
+    let name_idx = query.capture_index_for_name("name")?;
+    let context_idx = query.capture_index_for_name("context");
+
+    let mut cursor = QueryCursor::new();
+    if let Some(range) = range {
+        cursor.set_byte_range(range);
+    }
+
+    // (start, end, symbol) in document order
+    let mut flat: Vec<(usize, usize, DocumentSymbol)> = Vec::new();
+    let mut matches = cursor.matches(query, tree.root_node(), text_provider(doc));
+    while let Some(m) = matches.next() {
+        let capture = |idx| m.captures.iter().find(|c| c.index == idx).map(|c| c.node);
+        let (Some(item), Some(name)) = (capture(item_idx), capture(name_idx)) else {
+            continue;
+        };
+        let context = context_idx.and_then(capture).map(|n| doc.node_text(n));
+        let is_style = item.kind() == "style_block";
+
+        #[allow(deprecated)] // DocumentSymbol::deprecated is deprecated but required
+        let symbol = DocumentSymbol {
+            name: if is_style {
+                doc.node_text(name)
+            } else {
+                format!("@{}", doc.node_text(name))
+            },
+            kind: symbol_kind(item.kind(), context.as_deref()),
+            detail: context,
+            tags: None,
+            deprecated: None,
+            range: doc.node_range(item),
+            selection_range: doc.node_range(name),
+            children: None,
+        };
+        flat.push((item.start_byte(), item.end_byte(), symbol));
+    }
+    flat.sort_by_key(|(start, end, _)| (*start, std::cmp::Reverse(*end)));
+
+    Some(nest(flat))
+}
+
+/// Build the hierarchy from range containment.
+fn nest(flat: Vec<(usize, usize, DocumentSymbol)>) -> Vec<DocumentSymbol> {
+    let mut roots = Vec::new();
+    let mut stack: Vec<(usize, DocumentSymbol)> = Vec::new();
+
+    fn close(stack: &mut Vec<(usize, DocumentSymbol)>, roots: &mut Vec<DocumentSymbol>) {
+        let (_, symbol) = stack.pop().expect("non-empty stack");
+        match stack.last_mut() {
+            Some((_, parent)) => parent.children.get_or_insert_with(Vec::new).push(symbol),
+            None => roots.push(symbol),
+        }
+    }
+
+    for (start, end, symbol) in flat {
+        while stack.last().is_some_and(|(parent_end, _)| start >= *parent_end) {
+            close(&mut stack, &mut roots);
+        }
+        stack.push((end, symbol));
+    }
+    while !stack.is_empty() {
+        close(&mut stack, &mut roots);
+    }
+    roots
+}
+
+fn symbol_kind(item_kind: &str, context: Option<&str>) -> SymbolKind {
+    match (item_kind, context) {
+        ("style_block", _) => SymbolKind::CLASS,
+        ("edge_block", _) => SymbolKind::EVENT,
+        (_, Some("group" | "frame")) => SymbolKind::NAMESPACE,
+        (_, Some("text")) => SymbolKind::STRING,
+        _ => SymbolKind::OBJECT,
+    }
+}
+
+/// Folding ranges for every multi-line block, optionally within `range`.
+///
+/// Each fold ends on the line before its closing `}` so the brace stays
+/// visible.
+pub fn folding_ranges(
+    doc: &Document,
+    range: Option<ByteRange<usize>>,
+) -> Option<Vec<FoldingRange>> {
+    Some(to_folds(doc, &fold_spans(doc, range)?))
+}
+
+/// Folding ranges for the whole document, running the query only over the
+/// bytes changed since the previous call; folds outside them are reused
+/// from the spans `doc` kept in step with its edits.
+pub fn changed_folding_ranges(doc: &mut Document) -> Option<Vec<FoldingRange>> {
+    let spans = match doc.take_folds() {
+        (Some(spans), None) => spans,
+        (Some(mut spans), Some(changed)) => {
+            // The cursor returns exactly the blocks intersecting `changed`
+            spans.retain(|span| span.end <= changed.start || span.start >= changed.end);
+            spans.extend(fold_spans(doc, Some(changed))?);
+            spans.sort_by_key(|span| (span.start, Reverse(span.end)));
+            spans.dedup();
+            spans
+        }
+        (None, _) => fold_spans(doc, None)?,
+    };
+    let folds = to_folds(doc, &spans);
+    doc.store_folds(spans);
+    Some(folds)
+}
+
+/// Byte spans of the foldable blocks intersecting `range`, in document
+/// order.
+fn fold_spans(doc: &Document, range: Option<ByteRange<usize>>) -> Option<Vec<ByteRange<usize>>> {
+    let query = FOLDS.as_ref().ok()?;
+    let tree = doc.tree()?;
+
+    let mut cursor = QueryCursor::new();
+    if let Some(range) = range {
+        cursor.set_byte_range(range);
+    }
+
+    let mut spans = Vec::new();
+    let mut captures = cursor.captures(query, tree.root_node(), text_provider(doc));
+    while let Some((m, idx)) = captures.next() {
+        spans.push(m.captures[*idx].node.byte_range());
+    }
+    Some(spans)
+}
+
+fn to_folds(doc: &Document, spans: &[ByteRange<usize>]) -> Vec<FoldingRange> {
+    spans
+        .iter()
+        .filter_map(|span| {
+            let start_line = doc.line_of_byte(span.start);
+            let end_line = doc.line_of_byte(span.end).saturating_sub(1);
+            (end_line > start_line).then(|| FoldingRange {
+                start_line,
+                end_line,
+                ..Default::default()
+            })
+        })
+        .collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const SOURCE: &str = "style accent {\n  fill: #6C5CE7\n}\n\
+                          group @card {\n  rect @bg {\n    w: 10 h: 10\n  }\n}\n\
+                          edge @link {\n  from: @card\n  to: @bg\n}\n";
+
+    #[test]
+    fn outline_is_nested() {
+        let doc = Document::new(SOURCE, 0);
+        let symbols = document_symbols(&doc, None).expect("outline query");
+
+        let names: Vec<&str> = symbols.iter().map(|s| s.name.as_str()).collect();
+        assert_eq!(names, ["accent", "@card", "@link"]);
+        let card_children = symbols[1].children.as_ref().unwrap();
+        assert_eq!(card_children[0].name, "@bg");
+        assert_eq!(symbols[1].kind, SymbolKind::NAMESPACE);
+    }
+
+    #[test]
+    fn folds_keep_closing_brace_visible() {
+        let doc = Document::new(SOURCE, 0);
+        let folds = folding_ranges(&doc, None).expect("folds query");
+        // group @card spans lines 3..=7
+        assert!(folds.iter().any(|f| f.start_line == 3 && f.end_line == 6));
+    }
+
+    #[test]
+    fn changed_folds_match_a_full_query() {
+        let mut doc = Document::new(SOURCE, 0);
+        assert_eq!(changed_folding_ranges(&mut doc), folding_ranges(&doc, None));
+
+        let at = |needle: &str| {
+            let line = SOURCE[..SOURCE.find(needle).unwrap()].lines().count() as u32;
+            Position::new(line, 0)
+        };
+        // Insert a multi-line block, fold, then open a block ahead of it
+        let edits = [
+            (at("edge"), "rect @new {\n  w: 1\n}\n"),
+            (at("group"), "frame @wrap {\n"),
+            (Position::new(0, 0), "\n\n"),
+        ];
+        for (position, text) in edits {
+            doc.apply_change(&TextDocumentContentChangeEvent {
+                range: Some(Range::new(position, position)),
+                range_length: None,
+                text: text.to_string(),
+            });
+            doc.reparse();
+            let changed = changed_folding_ranges(&mut doc);
+            assert_eq!(changed, folding_ranges(&doc, None), "after {text:?}");
+        }
+    }
+
+    #[test]
+    fn byte_range_limits_outline() {
+        let doc = Document::new(SOURCE, 0);
+        let edge_start = SOURCE.find("edge").unwrap();
+        let symbols = document_symbols(&doc, Some(edge_start..SOURCE.len())).unwrap();
+        assert_eq!(symbols.len(), 1);
+        assert_eq!(symbols[0].name, "@link");
+    }
+}
@@ -1,23 +1,21 @@
 //! Hit testing: point → node lookup.
 //!
 //! Reverse-walks the render tree (front-to-back) to find which node
-//! is at a given (x, y) canvas position.
+//! is at a given (x, y) canvas position. The `_indexed` variants ask a
+//! [`SpatialIndex`] for the candidates first and only order those, which
+//! is what the interactive paths use.
 
+use crate::spatial::SpatialIndex;
 use fd_core::NodeIndex;
-use fd_core::ResolvedBounds;
 use fd_core::SceneGraph;
 use fd_core::id::NodeId;
 use fd_core::model::*;
-use std::collections::HashMap;
+use fd_core::perf::{self, Span};
 
 /// Find the topmost node at position (px, py).
 /// Returns `None` if no node is hit (background).
-pub fn hit_test(
-    graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
-    px: f32,
-    py: f32,
-) -> Option<NodeId> {
+pub fn hit_test(graph: &SceneGraph, bounds: &BoundsMap, px: f32, py: f32) -> Option<NodeId> {
+    let _span = perf::span(Span::HitTest);
     // Walk children in reverse order (last painted = topmost)
     hit_test_node(graph, graph.root, bounds, px, py)
 }
@@ -25,7 +23,7 @@ pub fn hit_test(
 fn hit_test_node(
     graph: &SceneGraph,
     idx: NodeIndex,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     px: f32,
     py: f32,
 ) -> Option<NodeId> {
@@ -57,7 +55,7 @@ fn hit_test_node(
 /// Used for marquee (box) selection.
 pub fn hit_test_rect(
     graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     rx: f32,
     ry: f32,
     rw: f32,
@@ -72,7 +70,7 @@ pub fn hit_test_rect(
 fn collect_intersecting(
     graph: &SceneGraph,
     idx: NodeIndex,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     rx: f32,
     ry: f32,
     rw: f32,
@@ -93,6 +91,67 @@ fn collect_intersecting(
     }
 }
 
+// ─── Indexed queries ─────────────────────────────────────────────────────
+
+/// [`hit_test`] over a spatial index of the same bounds.
+pub fn hit_test_indexed(
+    graph: &SceneGraph,
+    index: &SpatialIndex,
+    px: f32,
+    py: f32,
+) -> Option<NodeId> {
+    let _span = perf::span(Span::HitTest);
+    index
+        .query_point(px, py)
+        .into_iter()
+        .filter_map(|idx| paint_order(graph, idx).map(|order| (order, idx)))
+        .max_by(|a, b| a.0.cmp(&b.0))
+        .map(|(_, idx)| graph.graph[idx].id)
+}
+
+/// [`hit_test_rect`] over a spatial index of the same bounds. Results are
+/// in document order, like `hit_test_rect`.
+pub fn hit_test_rect_indexed(
+    graph: &SceneGraph,
+    index: &SpatialIndex,
+    rx: f32,
+    ry: f32,
+    rw: f32,
+    rh: f32,
+) -> Vec<NodeId> {
+    let mut hits: Vec<(Vec<usize>, NodeIndex)> = index
+        .query_rect(rx, ry, rw, rh)
+        .into_iter()
+        .filter_map(|idx| paint_order(graph, idx).map(|order| (order, idx)))
+        .collect();
+    hits.sort();
+    hits.into_iter()
+        .map(|(_, idx)| graph.graph[idx].id)
+        .collect()
+}
+
+/// Sort key for paint order: sibling positions from the root down.
+///
+/// Ancestors compare before descendants and earlier siblings before later
+/// ones, so the largest key is the topmost node. `None` for the root and
+/// for nodes no longer attached to it (stale index entries).
+fn paint_order(graph: &SceneGraph, idx: NodeIndex) -> Option<Vec<usize>> {
+    if !graph.graph.contains_node(idx) || matches!(graph.graph[idx].kind, NodeKind::Root) {
+        return None;
+    }
+    let mut path = Vec::new();
+    let mut node = idx;
+    while let Some(parent) = graph.parent(node) {
+        path.push(graph.children(parent).iter().position(|&c| c == node)?);
+        node = parent;
+    }
+    if node != graph.root {
+        return None;
+    }
+    path.reverse();
+    Some(path)
+}
+
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -171,4 +230,38 @@ group @outer {
         let result = hit_test(&graph, &bounds, 700.0, 500.0);
         assert_eq!(result, None);
     }
+
+    #[test]
+    fn indexed_matches_linear() {
+        let input = r#"
+group @board {
+  frame @column {
+    w: 200 h: 300
+    layout: column gap=10 pad=10
+    rect @card1 { w: 180 h: 60 }
+    rect @card2 { w: 180 h: 60 }
+  }
+  rect @sticky { w: 80 h: 80 x: 150 y: 40 }
+}
+rect @overlay { w: 60 h: 60 x: 20 y: 20 }
+"#;
+        let graph = parse_document(input).unwrap();
+        let bounds = resolve_layout(&graph, Viewport::default());
+        let index = SpatialIndex::from_bounds(&bounds);
+
+        for y in (0..400).step_by(7) {
+            for x in (0..400).step_by(7) {
+                let (x, y) = (x as f32, y as f32);
+                assert_eq!(
+                    hit_test_indexed(&graph, &index, x, y),
+                    hit_test(&graph, &bounds, x, y),
+                    "point ({x}, {y})"
+                );
+            }
+        }
+        assert_eq!(
+            hit_test_rect_indexed(&graph, &index, 0.0, 0.0, 160.0, 90.0),
+            hit_test_rect(&graph, &bounds, 0.0, 0.0, 160.0, 90.0)
+        );
+    }
 }
@@ -1,3 +1,4 @@
 pub mod canvas;
 pub mod hit;
 pub mod paint;
+pub mod spatial;
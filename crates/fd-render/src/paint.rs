@@ -6,33 +6,23 @@
 use fd_core::NodeIndex;
 use fd_core::ResolvedBounds;
 use fd_core::SceneGraph;
-use fd_core::model::{NodeKind, Paint, PathCmd, StrokeCap, StrokeJoin, Style};
+use fd_core::model::{BoundsMap, NodeKind, Paint, PathCmd, StrokeCap, StrokeJoin, Style};
 use kurbo::{
     Affine, BezPath, Cap, Ellipse as KurboEllipse, Join, Point, Rect, RoundedRect,
     Stroke as KurboStroke,
 };
 use peniko::{Color, Fill};
-use std::collections::HashMap;
 use vello::Scene;
 
 /// Paint the entire scene graph to a Vello scene.
 ///
 /// Call once per frame with a freshly-cleared `Scene`.
 /// The caller presents the scene via wgpu.
-pub fn paint_scene(
-    scene: &mut Scene,
-    graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
-) {
+pub fn paint_scene(scene: &mut Scene, graph: &SceneGraph, bounds: &BoundsMap) {
     paint_node(scene, graph, graph.root, bounds);
 }
 
-fn paint_node(
-    scene: &mut Scene,
-    graph: &SceneGraph,
-    idx: fd_core::NodeIndex,
-    bounds: &HashMap<fd_core::NodeIndex, ResolvedBounds>,
-) {
+fn paint_node(scene: &mut Scene, graph: &SceneGraph, idx: NodeIndex, bounds: &BoundsMap) {
     let node = &graph.graph[idx];
     let nb = match bounds.get(&idx) {
         Some(b) => b,
@@ -0,0 +1,253 @@
+//! Uniform-grid spatial index over resolved bounds.
+//!
+//! Buckets nodes by the grid cells their bounds overlap, so a point query
+//! only looks at the nodes in one cell and a marquee query at the cells
+//! under the rectangle. Entries are updated one node at a time as bounds
+//! change. Nodes spanning many cells (backgrounds, large frames) live in a
+//! short list that every query checks, instead of in every cell they cover.
+//!
+//! The index is purely geometric: paint order is resolved from the scene
+//! graph by the callers in `hit.rs`, so z-order changes need no update.
+
+use fd_core::NodeIndex;
+use fd_core::{BoundsMap, ResolvedBounds};
+use std::collections::{HashMap, HashSet};
+
+/// Default cell edge length in canvas pixels.
+pub const DEFAULT_CELL_SIZE: f32 = 128.0;
+
+/// Nodes covering more cells than this go into the large-node list.
+const MAX_CELLS_PER_NODE: i64 = 64;
+
+type Cell = (i32, i32);
+
+/// Cell range covered by a node: inclusive `(min, max)` corners, or `None`
+/// for the large-node list.
+type Span = Option<(Cell, Cell)>;
+
+#[derive(Debug, Clone)]
+pub struct SpatialIndex {
+    cell_size: f32,
+    cells: HashMap<Cell, Vec<NodeIndex>>,
+    large: Vec<NodeIndex>,
+    entries: BoundsMap,
+}
+
+impl Default for SpatialIndex {
+    fn default() -> Self {
+        Self::new(DEFAULT_CELL_SIZE)
+    }
+}
+
+impl SpatialIndex {
+    /// Create an empty index with the given cell size.
+    pub fn new(cell_size: f32) -> Self {
+        Self {
+            cell_size,
+            cells: HashMap::new(),
+            large: Vec::new(),
+            entries: BoundsMap::new(),
+        }
+    }
+
+    /// Index every entry of a bounds map.
+    pub fn from_bounds(bounds: &BoundsMap) -> Self {
+        let mut index = Self::default();
+        for (&idx, &b) in bounds {
+            index.insert(idx, b);
+        }
+        index
+    }
+
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Bounds currently indexed for `idx`.
+    pub fn get(&self, idx: NodeIndex) -> Option<&ResolvedBounds> {
+        self.entries.get(&idx)
+    }
+
+    /// Insert or move a node.
+    pub fn insert(&mut self, idx: NodeIndex, bounds: ResolvedBounds) {
+        if let Some(old) = self.entries.get(&idx).copied() {
+            if old == bounds {
+                return;
+            }
+            if self.span(&old) == self.span(&bounds) {
+                self.entries.insert(idx, bounds);
+                return;
+            }
+            self.unlink(idx, &old);
+        }
+        match self.span(&bounds) {
+            Some(((x0, y0), (x1, y1))) => {
+                for cx in x0..=x1 {
+                    for cy in y0..=y1 {
+                        self.cells.entry((cx, cy)).or_default().push(idx);
+                    }
+                }
+            }
+            None => self.large.push(idx),
+        }
+        self.entries.insert(idx, bounds);
+    }
+
+    /// Remove a node; no-op if it isn't indexed.
+    pub fn remove(&mut self, idx: NodeIndex) {
+        if let Some(old) = self.entries.remove(&idx) {
+            self.unlink(idx, &old);
+        }
+    }
+
+    /// Bring the index in line with `bounds`, touching only entries that
+    /// differ. Returns the number of nodes inserted, moved or removed.
+    pub fn sync(&mut self, bounds: &BoundsMap) -> usize {
+        let stale: Vec<NodeIndex> = self
+            .entries
+            .keys()
+            .copied()
+            .filter(|idx| !bounds.contains_key(idx))
+            .collect();
+        let mut changed = stale.len();
+        for idx in stale {
+            self.remove(idx);
+        }
+        for (&idx, &b) in bounds {
+            if self.entries.get(&idx) != Some(&b) {
+                self.insert(idx, b);
+                changed += 1;
+            }
+        }
+        changed
+    }
+
+    /// Nodes whose bounds contain (px, py), in no particular order.
+    pub fn query_point(&self, px: f32, py: f32) -> Vec<NodeIndex> {
+        let cell = (self.coord(px), self.coord(py));
+        self.cells
+            .get(&cell)
+            .into_iter()
+            .flatten()
+            .chain(&self.large)
+            .copied()
+            .filter(|idx| self.entries[idx].contains(px, py))
+            .collect()
+    }
+
+    /// Nodes whose bounds intersect the rectangle, in no particular order.
+    pub fn query_rect(&self, rx: f32, ry: f32, rw: f32, rh: f32) -> Vec<NodeIndex> {
+        let (x0, y0) = (self.coord(rx), self.coord(ry));
+        let (x1, y1) = (self.coord(rx + rw), self.coord(ry + rh));
+        let hits = |idx: &NodeIndex| self.entries[idx].intersects_rect(rx, ry, rw, rh);
+
+        // A marquee bigger than the populated grid is cheaper as a scan.
+        let cell_count = (i64::from(x1) - i64::from(x0) + 1) * (i64::from(y1) - i64::from(y0) + 1);
+        if cell_count > self.cells.len() as i64 {
+            return self.entries.keys().copied().filter(hits).collect();
+        }
+
+        let mut seen = HashSet::new();
+        let mut out: Vec<NodeIndex> = self.large.iter().copied().filter(hits).collect();
+        for cx in x0..=x1 {
+            for cy in y0..=y1 {
+                for &idx in self.cells.get(&(cx, cy)).into_iter().flatten() {
+                    if seen.insert(idx) && hits(&idx) {
+                        out.push(idx);
+                    }
+                }
+            }
+        }
+        out
+    }
+
+    // ─── Cells ───────────────────────────────────────────────────────────
+
+    fn coord(&self, v: f32) -> i32 {
+        // `as` saturates, and maps NaN to 0
+        (v / self.cell_size).floor() as i32
+    }
+
+    fn span(&self, b: &ResolvedBounds) -> Span {
+        if !(b.x.is_finite() && b.y.is_finite() && b.width.is_finite() && b.height.is_finite()) {
+            return None;
+        }
+        let min = (self.coord(b.x), self.coord(b.y));
+        let max = (self.coord(b.x + b.width), self.coord(b.y + b.height));
+        let count =
+            (i64::from(max.0) - i64::from(min.0) + 1) * (i64::from(max.1) - i64::from(min.1) + 1);
+        (count <= MAX_CELLS_PER_NODE).then_some((min, max))
+    }
+
+    fn unlink(&mut self, idx: NodeIndex, old: &ResolvedBounds) {
+        match self.span(old) {
+            Some(((x0, y0), (x1, y1))) => {
+                for cx in x0..=x1 {
+                    for cy in y0..=y1 {
+                        if let Some(cell) = self.cells.get_mut(&(cx, cy)) {
+                            cell.retain(|&i| i != idx);
+                            if cell.is_empty() {
+                                self.cells.remove(&(cx, cy));
+                            }
+                        }
+                    }
+                }
+            }
+            None => self.large.retain(|&i| i != idx),
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn rect(x: f32, y: f32, width: f32, height: f32) -> ResolvedBounds {
+        ResolvedBounds {
+            x,
+            y,
+            width,
+            height,
+        }
+    }
+
+    #[test]
+    fn point_and_rect_queries() {
+        let mut index = SpatialIndex::new(100.0);
+        let a = NodeIndex::new(1);
+        let b = NodeIndex::new(2);
+        let bg = NodeIndex::new(3);
+        index.insert(a, rect(10.0, 10.0, 50.0, 50.0));
+        index.insert(b, rect(250.0, -40.0, 30.0, 30.0));
+        index.insert(bg, rect(-5000.0, -5000.0, 10000.0, 10000.0));
+
+        assert_eq!(index.query_point(20.0, 20.0).len(), 2); // a + bg
+        assert!(index.query_point(260.0, -30.0).contains(&b));
+        assert!(!index.query_point(200.0, 200.0).contains(&a));
+
+        let mut hits = index.query_rect(0.0, -50.0, 300.0, 100.0);
+        hits.sort();
+        assert_eq!(hits, [a, b, bg]);
+    }
+
+    #[test]
+    fn moves_and_removals_update_cells() {
+        let mut index = SpatialIndex::new(100.0);
+        let a = NodeIndex::new(1);
+        index.insert(a, rect(10.0, 10.0, 20.0, 20.0));
+        index.insert(a, rect(510.0, 510.0, 20.0, 20.0));
+        assert!(index.query_point(15.0, 15.0).is_empty());
+        assert_eq!(index.query_point(515.0, 515.0), [a]);
+
+        let mut bounds = BoundsMap::new();
+        bounds.insert(NodeIndex::new(2), rect(0.0, 0.0, 5.0, 5.0));
+        assert_eq!(index.sync(&bounds), 2);
+        assert!(index.query_point(515.0, 515.0).is_empty());
+        assert_eq!(index.len(), 1);
+        assert_eq!(index.sync(&bounds), 0);
+    }
+}
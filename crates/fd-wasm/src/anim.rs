@@ -0,0 +1,186 @@
+//! Trigger-driven animation state for the canvas renderer.
+//!
+//! The renderer only animates what a trigger has started: a hover envelope
+//! is created when the pointer enters a node with a `when :hover` scale, and
+//! its easing curve is sampled into a lookup table at that moment. Frames
+//! outside the envelope (and without edge flows) have nothing to animate,
+//! which is what lets the webview stop requesting frames when idle.
+
+use fd_core::id::NodeId;
+use fd_core::model::{AnimTrigger, Easing, SceneGraph};
+
+/// Samples per easing table (plus the endpoint).
+const EASING_SAMPLES: usize = 64;
+
+/// How long a hover scale holds at its target before easing back.
+const HOVER_HOLD_MS: f64 = 300.0;
+
+// ─── Easing ──────────────────────────────────────────────────────────────
+
+/// Exact easing curve, matching the webview's tween easings.
+fn ease_exact(easing: &Easing, t: f32) -> f32 {
+    match *easing {
+        Easing::Linear => t,
+        Easing::EaseIn => t * t * t,
+        Easing::EaseOut => 1.0 - (1.0 - t).powi(3),
+        Easing::EaseInOut => {
+            if t < 0.5 {
+                4.0 * t * t * t
+            } else {
+                1.0 - (-2.0 * t + 2.0).powi(3) / 2.0
+            }
+        }
+        Easing::Spring => {
+            if t <= 0.0 {
+                0.0
+            } else if t >= 1.0 {
+                1.0
+            } else {
+                let c4 = std::f32::consts::TAU / 3.0;
+                2f32.powf(-10.0 * t) * ((t * 10.0 - 0.75) * c4).sin() + 1.0
+            }
+        }
+        Easing::CubicBezier(x1, y1, x2, y2) => cubic_bezier(x1, y1, x2, y2, t),
+    }
+}
+
+/// CSS-style `cubic-bezier(x1, y1, x2, y2)` at progress `t`.
+fn cubic_bezier(x1: f32, y1: f32, x2: f32, y2: f32, t: f32) -> f32 {
+    let bezier = |a: f32, b: f32, s: f32| {
+        let inv = 1.0 - s;
+        3.0 * inv * inv * s * a + 3.0 * inv * s * s * b + s * s * s
+    };
+    // x(s) is monotonic for x1, x2 in [0, 1]: bisect for x(s) = t
+    let (mut lo, mut hi) = (0.0f32, 1.0f32);
+    for _ in 0..24 {
+        let mid = (lo + hi) / 2.0;
+        if bezier(x1, x2, mid) < t {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    bezier(y1, y2, (lo + hi) / 2.0)
+}
+
+/// An easing curve sampled at fixed steps, interpolated linearly.
+#[derive(Debug, Clone)]
+pub struct EasingTable {
+    samples: [f32; EASING_SAMPLES + 1],
+}
+
+impl EasingTable {
+    pub fn new(easing: &Easing) -> Self {
+        let mut samples = [0.0; EASING_SAMPLES + 1];
+        for (i, sample) in samples.iter_mut().enumerate() {
+            *sample = ease_exact(easing, i as f32 / EASING_SAMPLES as f32);
+        }
+        Self { samples }
+    }
+
+    /// Eased value at progress `t`, clamped to [0, 1].
+    pub fn sample(&self, t: f32) -> f32 {
+        let pos = t.clamp(0.0, 1.0) * EASING_SAMPLES as f32;
+        let i = (pos as usize).min(EASING_SAMPLES - 1);
+        let frac = pos - i as f32;
+        self.samples[i] + (self.samples[i + 1] - self.samples[i]) * frac
+    }
+}
+
+// ─── Hover envelope ──────────────────────────────────────────────────────
+
+/// A running hover scale animation: ease in over the keyframe's duration,
+/// hold, then ease back to rest.
+#[derive(Debug, Clone)]
+pub struct HoverEnvelope {
+    pub node: NodeId,
+    start_ms: f64,
+    ease_ms: f64,
+    table: EasingTable,
+}
+
+impl HoverEnvelope {
+    /// Start the envelope for `node` if it has a hover keyframe with a
+    /// scale; `None` if hovering it animates nothing.
+    pub fn start(graph: &SceneGraph, node: NodeId, start_ms: f64) -> Option<Self> {
+        let anim = graph.get_by_id(node)?.animations.iter().find(|a| {
+            a.trigger == AnimTrigger::Hover
+                && a.properties
+                    .scale
+                    .is_some_and(|s| (s - 1.0).abs() > f32::EPSILON)
+        })?;
+        Some(Self {
+            node,
+            start_ms,
+            ease_ms: f64::from(anim.duration_ms.max(1)),
+            table: EasingTable::new(&anim.easing),
+        })
+    }
+
+    /// Time at which the envelope is back at rest.
+    pub fn end_ms(&self) -> f64 {
+        self.start_ms + self.ease_ms * 2.0 + HOVER_HOLD_MS
+    }
+
+    /// How far toward the target scale the node is at `time_ms`:
+    /// 0 at rest, 1 at the target.
+    pub fn weight(&self, time_ms: f64) -> f32 {
+        let elapsed = time_ms - self.start_ms;
+        if elapsed < 0.0 || time_ms > self.end_ms() {
+            0.0
+        } else if elapsed < self.ease_ms {
+            self.table.sample((elapsed / self.ease_ms) as f32)
+        } else if elapsed < self.ease_ms + HOVER_HOLD_MS {
+            1.0
+        } else {
+            let t = (elapsed - self.ease_ms - HOVER_HOLD_MS) / self.ease_ms;
+            1.0 - self.table.sample(t as f32)
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use fd_core::parser::parse_document;
+
+    #[test]
+    fn tables_track_exact_curves() {
+        let curves = [
+            Easing::Linear,
+            Easing::EaseIn,
+            Easing::EaseOut,
+            Easing::EaseInOut,
+            Easing::Spring,
+            Easing::CubicBezier(0.25, 0.1, 0.25, 1.0),
+        ];
+        for easing in &curves {
+            let table = EasingTable::new(easing);
+            for i in 0..=200 {
+                let t = i as f32 / 200.0;
+                let err = (table.sample(t) - ease_exact(easing, t)).abs();
+                assert!(err < 0.01, "{easing:?} at {t}: off by {err}");
+            }
+            assert_eq!(table.sample(0.0), ease_exact(easing, 0.0));
+            assert!((table.sample(1.0) - 1.0).abs() < 1e-3);
+        }
+    }
+
+    #[test]
+    fn hover_envelope_follows_keyframe() {
+        let graph = parse_document(
+            "rect @btn {\n  w: 10 h: 10\n  when :hover {\n    scale: 1.1\n    ease: linear 200ms\n  }\n}\n\
+             rect @plain {\n  w: 10 h: 10\n}\n",
+        )
+        .unwrap();
+        assert!(HoverEnvelope::start(&graph, NodeId::intern("plain"), 0.0).is_none());
+
+        let env = HoverEnvelope::start(&graph, NodeId::intern("btn"), 1000.0).unwrap();
+        assert_eq!(env.weight(900.0), 0.0);
+        assert!((env.weight(1100.0) - 0.5).abs() < 1e-3);
+        assert_eq!(env.weight(1350.0), 1.0);
+        assert!((env.weight(1600.0) - 0.5).abs() < 1e-3);
+        assert_eq!(env.end_ms(), 1700.0);
+        assert_eq!(env.weight(1701.0), 0.0);
+    }
+}
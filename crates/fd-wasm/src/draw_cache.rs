@@ -0,0 +1,367 @@
+//! Retained per-node drawing objects for the Canvas2D renderer.
+//!
+//! Shape outlines are built once as `Path2D` objects in node-local
+//! coordinates (origin at the node's top-left corner), together with the
+//! node's gradient fill if it has one. The painter translates to the
+//! node's position and reuses them, so moving or panning never rebuilds
+//! anything; an entry is rebuilt only when the node's size, geometry or
+//! fill paint changes (tracked by a hash key).
+//!
+//! Sketchy-mode outlines are retained the same way, seeded per node, so the
+//! hand-drawn look costs no more per frame than the plain one.
+
+use crate::render2d::{self, SketchyOutline};
+use fd_core::NodeIndex;
+use fd_core::model::{Paint, PathCmd};
+use fd_core::perf::{self, Cache};
+use std::cell::RefCell;
+use std::collections::HashMap;
+use std::hash::{DefaultHasher, Hash, Hasher};
+use web_sys::{CanvasGradient, CanvasRenderingContext2d, Path2d};
+
+/// Node-local shape geometry.
+#[derive(Debug, Clone, Copy)]
+pub enum Geometry<'a> {
+    RoundedRect {
+        w: f64,
+        h: f64,
+        radius: f64,
+    },
+    Ellipse {
+        w: f64,
+        h: f64,
+    },
+    Path {
+        w: f64,
+        h: f64,
+        commands: &'a [PathCmd],
+    },
+    /// Hand-drawn rectangle; `seed` picks the wobble.
+    SketchyRect {
+        w: f64,
+        h: f64,
+        seed: f64,
+    },
+    /// Hand-drawn ellipse; `seed` picks the wobble.
+    SketchyEllipse {
+        w: f64,
+        h: f64,
+        seed: f64,
+    },
+}
+
+impl Geometry<'_> {
+    fn size(&self) -> (f64, f64) {
+        match *self {
+            Geometry::RoundedRect { w, h, .. }
+            | Geometry::Ellipse { w, h }
+            | Geometry::Path { w, h, .. }
+            | Geometry::SketchyRect { w, h, .. }
+            | Geometry::SketchyEllipse { w, h, .. } => (w, h),
+        }
+    }
+
+    fn hash_into(&self, state: &mut impl Hasher) {
+        match *self {
+            Geometry::RoundedRect { w, h, radius } => {
+                0u8.hash(state);
+                for v in [w, h, radius] {
+                    v.to_bits().hash(state);
+                }
+            }
+            Geometry::Ellipse { w, h } => {
+                1u8.hash(state);
+                w.to_bits().hash(state);
+                h.to_bits().hash(state);
+            }
+            Geometry::Path { w, h, commands } => {
+                2u8.hash(state);
+                w.to_bits().hash(state);
+                h.to_bits().hash(state);
+                for cmd in commands {
+                    hash_path_cmd(cmd, state);
+                }
+            }
+            Geometry::SketchyRect { w, h, seed } => {
+                3u8.hash(state);
+                for v in [w, h, seed] {
+                    v.to_bits().hash(state);
+                }
+            }
+            Geometry::SketchyEllipse { w, h, seed } => {
+                4u8.hash(state);
+                for v in [w, h, seed] {
+                    v.to_bits().hash(state);
+                }
+            }
+        }
+    }
+
+    /// The second, offset stroke pass of sketchy shapes.
+    fn build_overlay(&self) -> Option<Path2d> {
+        match *self {
+            Geometry::SketchyRect { w, h, seed } => {
+                sketchy_path(&render2d::sketchy_rect_outline(w, h, seed, 1))
+            }
+            Geometry::SketchyEllipse { w, h, seed } => {
+                sketchy_path(&render2d::sketchy_ellipse_outline(w, h, seed, 1))
+            }
+            _ => None,
+        }
+    }
+
+    fn build_path(&self) -> Option<Path2d> {
+        let path = Path2d::new().ok()?;
+        match *self {
+            Geometry::RoundedRect { w, h, radius } => {
+                let r = radius.min(w / 2.0).min(h / 2.0);
+                path.move_to(r, 0.0);
+                path.line_to(w - r, 0.0);
+                path.arc_to(w, 0.0, w, r, r).ok()?;
+                path.line_to(w, h - r);
+                path.arc_to(w, h, w - r, h, r).ok()?;
+                path.line_to(r, h);
+                path.arc_to(0.0, h, 0.0, h - r, r).ok()?;
+                path.line_to(0.0, r);
+                path.arc_to(0.0, 0.0, r, 0.0, r).ok()?;
+                path.close_path();
+            }
+            Geometry::Ellipse { w, h } => {
+                let (rx, ry) = (w / 2.0, h / 2.0);
+                path.ellipse(rx, ry, rx, ry, 0.0, 0.0, std::f64::consts::TAU)
+                    .ok()?;
+            }
+            Geometry::Path { commands, .. } => {
+                for cmd in commands {
+                    match *cmd {
+                        PathCmd::MoveTo(x, y) => path.move_to(x as f64, y as f64),
+                        PathCmd::LineTo(x, y) => path.line_to(x as f64, y as f64),
+                        PathCmd::QuadTo(cx, cy, ex, ey) => {
+                            path.quadratic_curve_to(cx as f64, cy as f64, ex as f64, ey as f64)
+                        }
+                        PathCmd::CubicTo(c1x, c1y, c2x, c2y, ex, ey) => path.bezier_curve_to(
+                            c1x as f64, c1y as f64, c2x as f64, c2y as f64, ex as f64, ey as f64,
+                        ),
+                        PathCmd::Close => path.close_path(),
+                    }
+                }
+            }
+            Geometry::SketchyRect { w, h, seed } => {
+                return sketchy_path(&render2d::sketchy_rect_outline(w, h, seed, 0));
+            }
+            Geometry::SketchyEllipse { w, h, seed } => {
+                return sketchy_path(&render2d::sketchy_ellipse_outline(w, h, seed, 0));
+            }
+        }
+        Some(path)
+    }
+}
+
+fn sketchy_path(outline: &SketchyOutline) -> Option<Path2d> {
+    let path = Path2d::new().ok()?;
+    path.move_to(outline.start.0, outline.start.1);
+    for &[cx, cy, x, y] in &outline.quads {
+        path.quadratic_curve_to(cx, cy, x, y);
+    }
+    path.close_path();
+    Some(path)
+}
+
+fn hash_path_cmd(cmd: &PathCmd, state: &mut impl Hasher) {
+    let (tag, coords): (u8, &[f32]) = match cmd {
+        PathCmd::MoveTo(x, y) => (0, &[*x, *y]),
+        PathCmd::LineTo(x, y) => (1, &[*x, *y]),
+        PathCmd::QuadTo(cx, cy, ex, ey) => (2, &[*cx, *cy, *ex, *ey]),
+        PathCmd::CubicTo(c1x, c1y, c2x, c2y, ex, ey) => (3, &[*c1x, *c1y, *c2x, *c2y, *ex, *ey]),
+        PathCmd::Close => (4, &[]),
+    };
+    tag.hash(state);
+    for v in coords {
+        v.to_bits().hash(state);
+    }
+}
+
+fn hash_paint(paint: Option<&Paint>, state: &mut impl Hasher) {
+    let (tag, angle, stops) = match paint {
+        Some(Paint::LinearGradient { angle, stops }) => (1u8, *angle, stops.as_slice()),
+        Some(Paint::RadialGradient { stops }) => (2u8, 0.0, stops.as_slice()),
+        // Solid fills are plain style strings, nothing retained
+        _ => (0u8, 0.0, &[][..]),
+    };
+    tag.hash(state);
+    angle.to_bits().hash(state);
+    for stop in stops {
+        for v in [
+            stop.offset,
+            stop.color.r,
+            stop.color.g,
+            stop.color.b,
+            stop.color.a,
+        ] {
+            v.to_bits().hash(state);
+        }
+    }
+}
+
+/// Cache key for a node's retained objects.
+pub fn shape_key(geometry: &Geometry<'_>, fill: Option<&Paint>) -> u64 {
+    let mut state = DefaultHasher::new();
+    geometry.hash_into(&mut state);
+    hash_paint(fill, &mut state);
+    state.finish()
+}
+
+/// Retained objects for one node, in node-local coordinates.
+#[derive(Clone)]
+pub struct Shape {
+    pub path: Path2d,
+    /// Second stroke pass, for sketchy shapes.
+    pub overlay: Option<Path2d>,
+    /// Gradient fill, if the fill paint is a gradient.
+    pub gradient: Option<CanvasGradient>,
+}
+
+impl Shape {
+    /// Build the objects for `geometry` without caching them.
+    pub fn build(
+        ctx: &CanvasRenderingContext2d,
+        geometry: Geometry<'_>,
+        fill: Option<&Paint>,
+    ) -> Option<Self> {
+        let (w, h) = geometry.size();
+        Some(Self {
+            path: geometry.build_path()?,
+            overlay: geometry.build_overlay(),
+            gradient: fill.and_then(|paint| render2d::build_gradient(ctx, paint, 0.0, 0.0, w, h)),
+        })
+    }
+}
+
+struct Entry {
+    key: u64,
+    shape: Shape,
+}
+
+/// Per-node cache of [`Shape`]s.
+///
+/// Interior mutability keeps `FdCanvas::render` a `&self` method.
+#[derive(Default)]
+pub struct DrawCache {
+    entries: RefCell<HashMap<NodeIndex, Entry>>,
+}
+
+impl DrawCache {
+    /// The retained shape for `idx`, rebuilt if its geometry or fill changed.
+    /// `None` if the browser refused to create a `Path2D`.
+    pub fn shape(
+        &self,
+        ctx: &CanvasRenderingContext2d,
+        idx: NodeIndex,
+        geometry: Geometry<'_>,
+        fill: Option<&Paint>,
+    ) -> Option<Shape> {
+        let key = shape_key(&geometry, fill);
+        let mut entries = self.entries.borrow_mut();
+        if let Some(entry) = entries.get(&idx)
+            && entry.key == key
+        {
+            perf::cache(Cache::Draw, true);
+            return Some(entry.shape.clone());
+        }
+        perf::cache(Cache::Draw, false);
+
+        let shape = Shape::build(ctx, geometry, fill)?;
+        entries.insert(
+            idx,
+            Entry {
+                key,
+                shape: shape.clone(),
+            },
+        );
+        Some(shape)
+    }
+
+    /// Drop entries for nodes that no longer exist. Entries of a reused
+    /// index are harmless either way: their key won't match the new node.
+    pub fn retain(&self, mut keep: impl FnMut(NodeIndex) -> bool) {
+        self.entries.borrow_mut().retain(|idx, _| keep(*idx));
+    }
+
+    pub fn len(&self) -> usize {
+        self.entries.borrow().len()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use fd_core::model::{Color, GradientStop};
+
+    fn gradient(angle: f32) -> Paint {
+        Paint::LinearGradient {
+            angle,
+            stops: vec![GradientStop {
+                offset: 0.0,
+                color: Color {
+                    r: 1.0,
+                    g: 0.0,
+                    b: 0.0,
+                    a: 1.0,
+                },
+            }],
+        }
+    }
+
+    #[test]
+    fn key_tracks_size_and_fill_only() {
+        let rect = |w| Geometry::RoundedRect {
+            w,
+            h: 40.0,
+            radius: 6.0,
+        };
+        let solid = Paint::Solid(Color {
+            r: 0.0,
+            g: 0.0,
+            b: 1.0,
+            a: 1.0,
+        });
+
+        assert_eq!(shape_key(&rect(100.0), None), shape_key(&rect(100.0), None));
+        assert_ne!(shape_key(&rect(100.0), None), shape_key(&rect(120.0), None));
+        // Solid fills aren't retained, so they don't invalidate
+        assert_eq!(
+            shape_key(&rect(100.0), None),
+            shape_key(&rect(100.0), Some(&solid))
+        );
+        assert_ne!(
+            shape_key(&rect(100.0), Some(&gradient(0.0))),
+            shape_key(&rect(100.0), Some(&gradient(90.0)))
+        );
+    }
+
+    #[test]
+    fn key_distinguishes_geometry_kinds() {
+        let cmds = [PathCmd::MoveTo(0.0, 0.0), PathCmd::LineTo(10.0, 10.0)];
+        let moved = [PathCmd::MoveTo(0.0, 0.0), PathCmd::LineTo(10.0, 12.0)];
+        let path = |commands| Geometry::Path {
+            w: 10.0,
+            h: 10.0,
+            commands,
+        };
+        assert_ne!(
+            shape_key(&Geometry::Ellipse { w: 10.0, h: 10.0 }, None),
+            shape_key(
+                &Geometry::RoundedRect {
+                    w: 10.0,
+                    h: 10.0,
+                    radius: 0.0
+                },
+                None
+            )
+        );
+        assert_ne!(
+            shape_key(&path(&cmds), None),
+            shape_key(&path(&moved), None)
+        );
+    }
+}
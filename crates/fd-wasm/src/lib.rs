@@ -2,6 +2,8 @@
 //!
 //! Compiled via `wasm-pack build --target web` and loaded in VS Code webview.
 
+mod anim;
+mod draw_cache;
 mod render2d;
 mod svg;
 
@@ -11,6 +13,7 @@ use fd_core::model::{
     Annotation, ArrowKind, Color, Constraint, CurveKind, Edge, EdgeAnchor, LayoutMode, NodeKind,
     Paint, SceneNode, Stroke, StrokeCap, StrokeJoin, TextAlign, TextVAlign,
 };
+use fd_core::perf::{self, Span};
 use fd_editor::commands::CommandStack;
 use fd_editor::input::{InputEvent, Modifiers};
 use fd_editor::shortcuts::{ShortcutAction, ShortcutMap};
@@ -19,7 +22,7 @@ use fd_editor::tools::{
     ArrowTool, EllipseTool, EraserTool, PenTool, RectTool, ResizeHandle, SelectTool, TextTool,
     Tool, ToolKind,
 };
-use fd_render::hit::hit_test_rect;
+use fd_render::hit::{hit_test_indexed, hit_test_rect_indexed};
 use wasm_bindgen::prelude::*;
 use web_sys::CanvasRenderingContext2d;
 
@@ -51,10 +54,12 @@ pub struct FdCanvas {
     sketchy_mode: bool,
     hovered_id: Option<fd_core::id::NodeId>,
     pressed_id: Option<fd_core::id::NodeId>,
-    /// Timestamp (ms) when hover started on the current node.
-    hover_start_ms: f64,
+    /// Running hover animation of the hovered node, if it has one.
+    hover_anim: Option<anim::HoverEnvelope>,
     /// Pointer-down scene position — used to detect click vs drag.
     pointer_down_pos: Option<(f32, f32)>,
+    /// Retained per-node canvas paths, reused across frames.
+    draw_cache: draw_cache::DrawCache,
 }
 
 #[wasm_bindgen]
@@ -90,8 +95,9 @@ impl FdCanvas {
             sketchy_mode: false,
             hovered_id: None,
             pressed_id: None,
-            hover_start_ms: 0.0,
+            hover_anim: None,
             pointer_down_pos: None,
+            draw_cache: draw_cache::DrawCache::default(),
         }
     }
 
@@ -105,13 +111,52 @@ impl FdCanvas {
         result.is_ok()
     }
 
+    /// Set the FD source text, restoring the scene graph and layout from
+    /// `snapshot` (from [`FdCanvas::snapshot`]) when it was taken of this
+    /// exact text, and parsing otherwise.
+    /// Returns `true` on success, `false` on parse error.
+    pub fn set_text_with_snapshot(&mut self, text: &str, snapshot: &[u8]) -> bool {
+        self.suppress_sync = true;
+        let result = self.engine.set_text_from_snapshot(text, snapshot);
+        self.engine.resolve();
+        self.suppress_sync = false;
+        result.is_ok()
+    }
+
+    /// Binary snapshot of the parsed, laid-out document (returned to JS as
+    /// a `Uint8Array`) for a fast reopen with `set_text_with_snapshot`.
+    /// Empty if the document could not be encoded.
+    pub fn snapshot(&mut self) -> Vec<u8> {
+        self.engine.snapshot().unwrap_or_default()
+    }
+
     /// Get the current FD source text (synced from graph).
     pub fn get_text(&mut self) -> String {
         self.engine.current_text().to_string()
     }
 
+    /// The edit turning the text as of the previous call (or the last
+    /// `set_text`) into the current text, as JSON
+    /// `{"start", "suffix", "text"}`: replace everything from UTF-16 offset
+    /// `start` up to the last `suffix` UTF-16 units with `text`.
+    /// Returns an empty string when the text must be sent in full.
+    pub fn take_text_edit(&mut self) -> String {
+        let Some(patch) = self.engine.take_text_patch() else {
+            return String::new();
+        };
+        let text = self.engine.current_text();
+        let end = patch.range.start + patch.text.len();
+        serde_json::json!({
+            "start": text[..patch.range.start].encode_utf16().count(),
+            "suffix": text[end..].encode_utf16().count(),
+            "text": patch.text,
+        })
+        .to_string()
+    }
+
     /// Render the scene to a Canvas2D context.
     pub fn render(&self, ctx: &CanvasRenderingContext2d, time_ms: f64) {
+        let _span = perf::span(Span::Render);
         let selected_ids: Vec<String> = self
             .select_tool
             .selected
@@ -141,8 +186,26 @@ impl FdCanvas {
             self.pressed_id.as_ref().map(|id| id.as_str()),
             &guides,
             self.sketchy_mode,
-            self.hover_start_ms,
+            self.hover_anim.as_ref(),
+            self.engine.spatial_index(),
+            &self.draw_cache,
         );
+
+        // Drop shapes of removed nodes once they pile up
+        let graph = &self.engine.graph.graph;
+        if self.draw_cache.len() > graph.node_count() * 2 {
+            self.draw_cache.retain(|idx| graph.contains_node(idx));
+        }
+    }
+
+    /// Whether a frame at `time_ms` would differ from the last one without
+    /// any input: a hover animation is still running, or an edge has a flow
+    /// animation. The webview's frame loop idles while this is false.
+    pub fn needs_animation_frame(&self, time_ms: f64) -> bool {
+        self.hover_anim
+            .as_ref()
+            .is_some_and(|env| time_ms <= env.end_ms())
+            || self.engine.graph.edges.iter().any(|e| e.flow.is_some())
     }
 
     /// Set the canvas theme.
@@ -213,9 +276,7 @@ impl FdCanvas {
         self.pressed_id = hit;
         let pressed_changed = prev_pressed != self.pressed_id;
 
-        let prev_hovered = self.hovered_id;
-        self.hovered_id = hit;
-        let hovered_changed = prev_hovered != self.hovered_id;
+        let hovered_changed = self.set_hovered(hit);
 
         // Check for resize handle hit on currently selected node
         if self.active_tool == ToolKind::Select
@@ -272,12 +333,7 @@ impl FdCanvas {
                 .effective_target(id, &self.select_tool.selected)
         });
 
-        let prev_hovered = self.hovered_id;
-        self.hovered_id = hit;
-        let hovered_changed = prev_hovered != self.hovered_id;
-        if hovered_changed && self.hovered_id.is_some() {
-            self.hover_start_ms = js_sys::Date::now();
-        }
+        let hovered_changed = self.set_hovered(hit);
 
         let mutations = match self.active_tool {
             ToolKind::Select => self.select_tool.handle(&event, hit),
@@ -323,9 +379,9 @@ impl FdCanvas {
         // Finalize marquee selection before handling pointer-up
         let marquee_changed = if let Some((rx, ry, rw, rh)) = self.select_tool.marquee_rect {
             if rw > 2.0 || rh > 2.0 {
-                let hits = hit_test_rect(
+                let hits = hit_test_rect_indexed(
                     &self.engine.graph,
-                    self.engine.current_bounds(),
+                    self.engine.spatial_index(),
                     rx,
                     ry,
                     rw,
@@ -373,9 +429,7 @@ impl FdCanvas {
                 .effective_target(id, &self.select_tool.selected)
         });
 
-        let prev_hovered = self.hovered_id;
-        self.hovered_id = hit;
-        let hovered_changed = prev_hovered != self.hovered_id;
+        let hovered_changed = self.set_hovered(hit);
 
         let mutations = match self.active_tool {
             ToolKind::Select => self.select_tool.handle(&event, hit),
@@ -386,6 +440,9 @@ impl FdCanvas {
             ToolKind::Arrow => self.arrow_tool.handle(&event, hit),
             ToolKind::Eraser => self.eraser_tool.handle(&event, hit),
         };
+        // The release edit and the z-order raise below share one layout
+        // pass and one text flush
+        self.engine.begin_batch();
         let changed = self.apply_mutations(mutations);
         // Flush text after gesture ends
         if changed {
@@ -414,6 +471,8 @@ impl FdCanvas {
                 } else {
                     let raised = self.engine.graph.bring_forward(idx);
                     if raised {
+                        self.engine.mark_layout_dirty(idx);
+                        self.engine.mark_text_stale();
                         self.engine.flush_to_text();
                     }
                     raised
@@ -424,6 +483,7 @@ impl FdCanvas {
         } else {
             false
         };
+        self.engine.commit_batch();
 
         self.pointer_down_pos = None;
 
@@ -747,14 +807,11 @@ impl FdCanvas {
             }
         }
 
-        // Apply ungroup mutations
-        let mut changed = false;
-        for gid in group_ids {
-            let mutation = GraphMutation::UngroupNode { id: gid };
-            if self.apply_mutations(vec![mutation]) {
-                changed = true;
-            }
-        }
+        let mutations = group_ids
+            .into_iter()
+            .map(|id| GraphMutation::UngroupNode { id })
+            .collect();
+        let changed = self.apply_mutations(mutations);
 
         if changed {
             // Select the promoted children + any non-group items that were selected
@@ -869,6 +926,7 @@ impl FdCanvas {
             }
         }
         if !edge_id_str.is_empty() {
+            self.engine.mark_text_stale();
             self.engine.flush_to_text();
         }
         edge_id_str
@@ -925,6 +983,7 @@ impl FdCanvas {
         } else {
             return false;
         }
+        self.engine.reindex_bounds(idx);
 
         old_bounds != self.engine.bounds.get(&idx).copied()
     }
@@ -1092,7 +1151,7 @@ impl FdCanvas {
         #[allow(clippy::too_many_arguments)]
         fn expand_bounds(
             graph: &fd_core::model::SceneGraph,
-            bounds_map: &std::collections::HashMap<fd_core::NodeIndex, fd_core::ResolvedBounds>,
+            bounds_map: &fd_core::BoundsMap,
             idx: fd_core::NodeIndex,
             min_x: &mut f32,
             min_y: &mut f32,
@@ -1744,8 +1803,21 @@ impl FdCanvas {
 // ─── Private helpers ─────────────────────────────────────────────────────
 
 impl FdCanvas {
+    /// Update the hovered node, starting its hover animation if it has one.
+    /// Returns whether the hovered node changed.
+    fn set_hovered(&mut self, hit: Option<NodeId>) -> bool {
+        if self.hovered_id == hit {
+            return false;
+        }
+        self.hovered_id = hit;
+        let now = performance_now();
+        self.hover_anim =
+            hit.and_then(|id| anim::HoverEnvelope::start(&self.engine.graph, id, now));
+        true
+    }
+
     fn hit_test(&self, x: f32, y: f32) -> Option<NodeId> {
-        fd_render::hit::hit_test(&self.engine.graph, self.engine.current_bounds(), x, y)
+        hit_test_indexed(&self.engine.graph, self.engine.spatial_index(), x, y)
     }
 
     fn apply_mutations(&mut self, mutations: Vec<GraphMutation>) -> bool {
@@ -1755,10 +1827,9 @@ impl FdCanvas {
         let all_moves = mutations
             .iter()
             .all(|m| matches!(m, GraphMutation::MoveNode { .. }));
-        for mutation in mutations {
-            self.commands
-                .execute(&mut self.engine, mutation, "canvas edit");
-        }
+        // One undo step and one layout pass for the whole set
+        self.commands
+            .execute_batch(&mut self.engine, mutations, "canvas edit");
         // Skip full layout resolve for move-only batches — bounds already updated in-place.
         // Re-resolving would recalculate from constraints and fight with the in-place update.
         if !all_moves {
@@ -1960,6 +2031,10 @@ impl FdCanvas {
                 if let Some(id) = self.select_tool.first_selected() {
                     if let Some(idx) = self.engine.graph.index_of(id) {
                         let changed = self.engine.graph.send_backward(idx);
+                        if changed {
+                            self.engine.mark_layout_dirty(idx);
+                            self.engine.mark_text_stale();
+                        }
                         (changed, false)
                     } else {
                         (false, false)
@@ -1972,6 +2047,10 @@ impl FdCanvas {
                 if let Some(id) = self.select_tool.first_selected() {
                     if let Some(idx) = self.engine.graph.index_of(id) {
                         let changed = self.engine.graph.bring_forward(idx);
+                        if changed {
+                            self.engine.mark_layout_dirty(idx);
+                            self.engine.mark_text_stale();
+                        }
                         (changed, false)
                     } else {
                         (false, false)
@@ -1984,6 +2063,10 @@ impl FdCanvas {
                 if let Some(id) = self.select_tool.first_selected() {
                     if let Some(idx) = self.engine.graph.index_of(id) {
                         let changed = self.engine.graph.send_to_back(idx);
+                        if changed {
+                            self.engine.mark_layout_dirty(idx);
+                            self.engine.mark_text_stale();
+                        }
                         (changed, false)
                     } else {
                         (false, false)
@@ -1996,6 +2079,10 @@ impl FdCanvas {
                 if let Some(id) = self.select_tool.first_selected() {
                     if let Some(idx) = self.engine.graph.index_of(id) {
                         let changed = self.engine.graph.bring_to_front(idx);
+                        if changed {
+                            self.engine.mark_layout_dirty(idx);
+                            self.engine.mark_text_stale();
+                        }
                         (changed, false)
                     } else {
                         (false, false)
@@ -2086,6 +2173,40 @@ fn console_error_panic_hook_setup() {
     }
 }
 
+/// Milliseconds on the same clock as the `requestAnimationFrame`
+/// timestamps passed to `render`; `Date.now()` where there's no window.
+fn performance_now() -> f64 {
+    web_sys::window()
+        .and_then(|w| w.performance())
+        .map_or_else(js_sys::Date::now, |p| p.now())
+}
+
+// ─── Performance stats ───────────────────────────────────────────────────
+
+/// Start or stop recording timings and counters for [`get_perf_stats`].
+/// Off by default; while off the probes cost one flag check each.
+#[wasm_bindgen]
+pub fn set_perf_enabled(enabled: bool) {
+    if enabled {
+        perf::enable(performance_now);
+    } else {
+        perf::disable();
+    }
+}
+
+/// Timings of parse, layout, sync, hit testing and rendering, node count
+/// and cache hit rates recorded since enabling (or the last
+/// [`reset_perf_stats`]), as JSON `{"enabled", "spans", "counters", "caches"}`.
+#[wasm_bindgen]
+pub fn get_perf_stats() -> String {
+    serde_json::to_string(&perf::stats()).unwrap_or_default()
+}
+
+#[wasm_bindgen]
+pub fn reset_perf_stats() {
+    perf::reset();
+}
+
 // ─── Standalone validation functions (no canvas needed) ──────────────────
 
 /// Validate FD source text. Returns JSON: `{"ok":true}` or `{"ok":false,"error":"..."}`.
@@ -2100,6 +2221,20 @@ pub fn validate(source: &str) -> String {
     }
 }
 
+/// Parse and lay out FD source against a `width`×`height` viewport, and
+/// return the result as a snapshot for [`FdCanvas::set_text_with_snapshot`].
+///
+/// Meant for a Web Worker: the page hands the bytes to its canvas as a
+/// transferable buffer, so typing never waits on the parser or the layout
+/// solver. Throws the parse error.
+#[wasm_bindgen]
+pub fn layout_snapshot(source: &str, width: f32, height: f32) -> Result<Vec<u8>, String> {
+    let graph = fd_core::parser::parse_document(source)?;
+    let viewport = Viewport { width, height };
+    let bounds = fd_core::resolve_layout(&graph, viewport);
+    fd_core::snapshot::write_snapshot(&graph, &bounds, viewport, source)
+}
+
 /// Parse FD source and return the scene graph as JSON for the tree preview.
 /// Returns JSON `{"ok":true,"nodes":[...]}` or `{"ok":false,"error":"..."}`.
 #[wasm_bindgen]
@@ -2,11 +2,18 @@
 //!
 //! Walks the resolved scene graph and draws to an HTML `<canvas>` via
 //! `CanvasRenderingContext2d`. Used as MVP renderer before Vello/wgpu.
+//!
+//! Nodes outside the visible part of the canvas are culled through the
+//! engine's spatial index, and shape outlines are reused from a
+//! [`DrawCache`] instead of being re-traced every frame.
 
+use crate::anim::HoverEnvelope;
+use crate::draw_cache::{DrawCache, Geometry, Shape};
 use fd_core::model::*;
 use fd_core::{NodeIndex, ResolvedBounds, SceneGraph};
-use std::collections::HashMap;
-use web_sys::CanvasRenderingContext2d;
+use fd_render::spatial::SpatialIndex;
+use std::collections::HashSet;
+use web_sys::{CanvasGradient, CanvasRenderingContext2d};
 
 /// Theme-dependent colors for the canvas renderer.
 pub struct CanvasTheme {
@@ -46,7 +53,7 @@ impl CanvasTheme {
 pub fn render_scene(
     ctx: &CanvasRenderingContext2d,
     graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     canvas_width: f64,
     canvas_height: f64,
     selected_ids: &[String],
@@ -57,8 +64,12 @@ pub fn render_scene(
     pressed_id: Option<&str>,
     smart_guides: &[(f64, f64, f64, f64)],
     sketchy: bool,
-    hover_start_ms: f64,
+    hover: Option<&HoverEnvelope>,
+    spatial: &SpatialIndex,
+    cache: &DrawCache,
 ) {
+    let cull = canvas_view_rect(ctx).map(|view| Culling::new(graph, spatial, view));
+
     // Clear canvas
     ctx.set_fill_style_str(theme.bg);
     ctx.fill_rect(0.0, 0.0, canvas_width, canvas_height);
@@ -78,11 +89,22 @@ pub fn render_scene(
         pressed_id,
         sketchy,
         time_ms,
-        hover_start_ms,
+        hover,
+        Some(cache),
+        cull.as_ref(),
     );
 
     // Draw edges between nodes
-    draw_edges(ctx, graph, bounds, time_ms, hovered_id, pressed_id, sketchy);
+    draw_edges(
+        ctx,
+        graph,
+        bounds,
+        time_ms,
+        hovered_id,
+        pressed_id,
+        sketchy,
+        cull.as_ref(),
+    );
 
     // Draw smart guides (alignment lines)
     draw_smart_guides(ctx, smart_guides);
@@ -98,7 +120,7 @@ pub fn render_scene(
 pub fn render_export(
     ctx: &CanvasRenderingContext2d,
     graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     selected_ids: &[String],
     _theme: &CanvasTheme,
     offset_x: f64,
@@ -141,7 +163,9 @@ pub fn render_export(
             None,
             sketchy,
             0.0,
-            0.0,
+            None,
+            None,
+            None,
         );
     }
 
@@ -153,15 +177,23 @@ fn render_node(
     ctx: &CanvasRenderingContext2d,
     graph: &SceneGraph,
     idx: NodeIndex,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     selected_ids: &[String],
     theme: &CanvasTheme,
     hovered_id: Option<&str>,
     pressed_id: Option<&str>,
     sketchy: bool,
     time_ms: f64,
-    hover_start_ms: f64,
+    hover: Option<&HoverEnvelope>,
+    cache: Option<&DrawCache>,
+    cull: Option<&Culling>,
 ) {
+    if cull.is_some_and(|c| !c.walk.contains(&idx)) {
+        return;
+    }
+    // Ancestors of visible nodes are walked but not painted.
+    let visible = cull.is_none_or(|c| c.visible.contains(&idx));
+
     let node = &graph.graph[idx];
     let node_bounds = match bounds.get(&idx) {
         Some(b) => b,
@@ -179,32 +211,14 @@ fn render_node(
     let style = graph.resolve_style(node, &triggers);
     let is_selected = selected_ids.iter().any(|sel| sel == node.id.as_str());
 
-    // Apply scale transform from node center if animation set it
-    // For hover animations: limit to 500ms with ease-in/ease-out
+    // Apply scale transform from node center if animation set it.
+    // A hover scale eases in and back out along the running envelope.
     let raw_scale = style.scale.unwrap_or(1.0);
-    let effective_scale = if is_hovered && (raw_scale - 1.0).abs() > f32::EPSILON {
-        let elapsed = time_ms - hover_start_ms;
-        let ease_in_ms = 200.0;
-        let hold_ms = 300.0;
-        let ease_out_ms = 200.0;
-        let total_ms = ease_in_ms + hold_ms + ease_out_ms; // 700ms total
-        if elapsed < 0.0 || elapsed > total_ms {
-            1.0 // Past animation duration, revert to normal
-        } else if elapsed < ease_in_ms {
-            // Ease in: 1.0 → target
-            let t = (elapsed / ease_in_ms) as f32;
-            let t_smooth = t * t * (3.0 - 2.0 * t); // smoothstep
-            1.0 + (raw_scale - 1.0) * t_smooth
-        } else if elapsed < ease_in_ms + hold_ms {
-            raw_scale // Hold at target
-        } else {
-            // Ease out: target → 1.0
-            let t = ((elapsed - ease_in_ms - hold_ms) / ease_out_ms) as f32;
-            let t_smooth = t * t * (3.0 - 2.0 * t);
-            raw_scale + (1.0 - raw_scale) * t_smooth
+    let effective_scale = match hover {
+        Some(env) if is_hovered && env.node == node.id => {
+            1.0 + (raw_scale - 1.0) * env.weight(time_ms)
         }
-    } else {
-        raw_scale
+        _ => raw_scale,
     };
 
     let has_scale = (effective_scale - 1.0).abs() > f32::EPSILON;
@@ -218,23 +232,34 @@ fn render_node(
         ctx.translate(-cx, -cy).unwrap_or(());
     }
 
+    let shape_of = |geometry: Geometry<'_>| retained_shape(ctx, cache, idx, geometry, &style);
+    let (w, h) = (node_bounds.width as f64, node_bounds.height as f64);
+    let radius = style.corner_radius.unwrap_or(0.0) as f64;
+
     match &node.kind {
+        _ if !visible => {}
         NodeKind::Root => {}
         NodeKind::Generic => {
             draw_generic_placeholder(ctx, node_bounds, node.id.as_str(), theme);
         }
         NodeKind::Rect { .. } => {
             if sketchy {
-                draw_rect_sketchy(ctx, node_bounds, &style, is_selected);
-            } else {
-                draw_rect(ctx, node_bounds, &style, is_selected);
+                let seed = sketchy_seed(node.id.as_str());
+                if let Some(shape) = shape_of(Geometry::SketchyRect { w, h, seed }) {
+                    draw_rect_sketchy(ctx, node_bounds, &style, is_selected, &shape);
+                }
+            } else if let Some(shape) = shape_of(Geometry::RoundedRect { w, h, radius }) {
+                draw_rect(ctx, node_bounds, &style, is_selected, &shape);
             }
         }
         NodeKind::Ellipse { .. } => {
             if sketchy {
-                draw_ellipse_sketchy(ctx, node_bounds, &style, is_selected);
-            } else {
-                draw_ellipse(ctx, node_bounds, &style, is_selected);
+                let seed = sketchy_seed(node.id.as_str());
+                if let Some(shape) = shape_of(Geometry::SketchyEllipse { w, h, seed }) {
+                    draw_ellipse_sketchy(ctx, node_bounds, &style, is_selected, &shape);
+                }
+            } else if let Some(shape) = shape_of(Geometry::Ellipse { w, h }) {
+                draw_ellipse(ctx, node_bounds, &style, is_selected, &shape);
             }
         }
         NodeKind::Text { content } => {
@@ -304,10 +329,16 @@ fn render_node(
             }
         }
         NodeKind::Frame { .. } => {
-            draw_rect(ctx, node_bounds, &style, is_selected);
+            if let Some(shape) = shape_of(Geometry::RoundedRect { w, h, radius }) {
+                draw_rect(ctx, node_bounds, &style, is_selected, &shape);
+            }
         }
         NodeKind::Path { commands } => {
-            draw_path(ctx, node_bounds, commands, &style, is_selected);
+            if !commands.is_empty()
+                && let Some(shape) = shape_of(Geometry::Path { w, h, commands })
+            {
+                draw_path(ctx, node_bounds, &style, is_selected, &shape);
+            }
         }
     }
 
@@ -324,14 +355,16 @@ fn render_node(
             pressed_id,
             sketchy,
             time_ms,
-            hover_start_ms,
+            hover,
+            cache,
+            cull,
         );
     }
 
     // Annotation badge removed — user preference (bug #5)
 
     // Selection overlay (drawn after children so it's on top)
-    if is_selected {
+    if is_selected && visible {
         draw_selection_handles(ctx, node_bounds);
     }
 
@@ -343,7 +376,13 @@ fn render_node(
 
 // ─── Drawing primitives ─────────────────────────────────────────────────
 
-fn draw_rect(ctx: &CanvasRenderingContext2d, b: &ResolvedBounds, style: &Style, is_selected: bool) {
+fn draw_rect(
+    ctx: &CanvasRenderingContext2d,
+    b: &ResolvedBounds,
+    style: &Style,
+    is_selected: bool,
+    shape: &Shape,
+) {
     let (x, y, w, h) = (b.x as f64, b.y as f64, b.width as f64, b.height as f64);
     let radius = style.corner_radius.unwrap_or(0.0) as f64;
 
@@ -351,20 +390,19 @@ fn draw_rect(ctx: &CanvasRenderingContext2d, b: &ResolvedBounds, style: &Style,
     apply_opacity(ctx, style);
     apply_shadow(ctx, style);
 
-    // Fill
-    rounded_rect_path(ctx, x, y, w, h, radius);
-    apply_fill(ctx, style, x, y, w, h);
-    ctx.fill();
+    // Fill + stroke from the retained node-local path
+    ctx.translate(x, y).unwrap_or(());
+    set_fill(ctx, style, shape.gradient.as_ref());
+    ctx.fill_with_path_2d(&shape.path);
     clear_shadow(ctx);
 
-    // Stroke
     if let Some(ref stroke) = style.stroke {
         let stroke_color = resolve_paint_color(&stroke.paint);
         ctx.set_stroke_style_str(&stroke_color);
         ctx.set_line_width(stroke.width as f64);
-        rounded_rect_path(ctx, x, y, w, h, radius);
-        ctx.stroke();
+        ctx.stroke_with_path(&shape.path);
     }
+    ctx.translate(-x, -y).unwrap_or(());
 
     // Selection highlight
     if is_selected {
@@ -382,9 +420,9 @@ fn draw_ellipse(
     b: &ResolvedBounds,
     style: &Style,
     is_selected: bool,
+    shape: &Shape,
 ) {
-    let cx = b.x as f64 + b.width as f64 / 2.0;
-    let cy = b.y as f64 + b.height as f64 / 2.0;
+    let (x, y) = (b.x as f64, b.y as f64);
     let rx = b.width as f64 / 2.0;
     let ry = b.height as f64 / 2.0;
 
@@ -392,24 +430,23 @@ fn draw_ellipse(
     apply_opacity(ctx, style);
     apply_shadow(ctx, style);
 
-    ctx.begin_path();
-    let _ = ctx.ellipse(cx, cy, rx, ry, 0.0, 0.0, std::f64::consts::TAU);
-    apply_fill(ctx, style, cx - rx, cy - ry, rx * 2.0, ry * 2.0);
-    ctx.fill();
+    ctx.translate(x, y).unwrap_or(());
+    set_fill(ctx, style, shape.gradient.as_ref());
+    ctx.fill_with_path_2d(&shape.path);
     clear_shadow(ctx);
 
     if let Some(ref stroke) = style.stroke {
         let stroke_color = resolve_paint_color(&stroke.paint);
         ctx.set_stroke_style_str(&stroke_color);
         ctx.set_line_width(stroke.width as f64);
-        ctx.stroke();
+        ctx.stroke_with_path(&shape.path);
     }
 
     if is_selected {
         ctx.set_stroke_style_str("#4FC3F7");
         ctx.set_line_width(2.0);
         ctx.begin_path();
-        let _ = ctx.ellipse(cx, cy, rx + 1.0, ry + 1.0, 0.0, 0.0, std::f64::consts::TAU);
+        let _ = ctx.ellipse(rx, ry, rx + 1.0, ry + 1.0, 0.0, 0.0, std::f64::consts::TAU);
         ctx.stroke();
     }
 
@@ -529,53 +566,23 @@ fn pick_label_color(style: &Style) -> String {
     }
 }
 
-/// Draw a freehand path from its PathCmd commands.
+/// Draw a freehand path from its retained node-local `Path2D`.
 fn draw_path(
     ctx: &CanvasRenderingContext2d,
     b: &ResolvedBounds,
-    commands: &[PathCmd],
     style: &Style,
     is_selected: bool,
+    shape: &Shape,
 ) {
-    if commands.is_empty() {
-        return;
-    }
-
-    let dx = b.x as f64;
-    let dy = b.y as f64;
-    let (w, h) = (b.width as f64, b.height as f64);
-
     ctx.save();
     apply_opacity(ctx, style);
     apply_shadow(ctx, style);
-
-    ctx.begin_path();
-    for cmd in commands {
-        match *cmd {
-            PathCmd::MoveTo(x, y) => ctx.move_to(dx + x as f64, dy + y as f64),
-            PathCmd::LineTo(x, y) => ctx.line_to(dx + x as f64, dy + y as f64),
-            PathCmd::QuadTo(cx, cy, ex, ey) => ctx.quadratic_curve_to(
-                dx + cx as f64,
-                dy + cy as f64,
-                dx + ex as f64,
-                dy + ey as f64,
-            ),
-            PathCmd::CubicTo(c1x, c1y, c2x, c2y, ex, ey) => ctx.bezier_curve_to(
-                dx + c1x as f64,
-                dy + c1y as f64,
-                dx + c2x as f64,
-                dy + c2y as f64,
-                dx + ex as f64,
-                dy + ey as f64,
-            ),
-            PathCmd::Close => ctx.close_path(),
-        }
-    }
+    ctx.translate(b.x as f64, b.y as f64).unwrap_or(());
 
     // Fill
     if style.fill.is_some() {
-        apply_fill(ctx, style, dx, dy, w, h);
-        ctx.fill();
+        set_fill(ctx, style, shape.gradient.as_ref());
+        ctx.fill_with_path_2d(&shape.path);
     }
     clear_shadow(ctx);
 
@@ -588,12 +595,12 @@ fn draw_path(
     let stroke_width = style.stroke.as_ref().map_or(1.5, |s| s.width as f64);
     ctx.set_stroke_style_str(&stroke_color);
     ctx.set_line_width(stroke_width);
-    ctx.stroke();
+    ctx.stroke_with_path(&shape.path);
 
     if is_selected {
         ctx.set_stroke_style_str("#4FC3F7");
         ctx.set_line_width(2.0);
-        ctx.stroke();
+        ctx.stroke_with_path(&shape.path);
     }
 
     ctx.restore();
@@ -727,14 +734,16 @@ fn draw_smart_guides(ctx: &CanvasRenderingContext2d, guides: &[(f64, f64, f64, f
 
 // ─── Edge rendering ─────────────────────────────────────────────────────────
 
+#[allow(clippy::too_many_arguments)]
 fn draw_edges(
     ctx: &CanvasRenderingContext2d,
     graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     time_ms: f64,
     hovered_id: Option<&str>,
     pressed_id: Option<&str>,
     sketchy: bool,
+    cull: Option<&Culling>,
 ) {
     use fd_core::model::{ArrowKind, CurveKind, EdgeAnchor};
 
@@ -767,6 +776,9 @@ fn draw_edges(
             }
             EdgeAnchor::Point(x, y) => (*x, *y),
         };
+        if cull.is_some_and(|c| !c.edge_visible(x1, y1, x2, y2)) {
+            continue;
+        }
 
         // Resolve stroke
         let mut triggers = Vec::new();
@@ -1007,8 +1019,33 @@ fn rounded_rect_path(ctx: &CanvasRenderingContext2d, x: f64, y: f64, w: f64, h:
 
 /// Set the fill style — creates a CanvasGradient for gradient paints.
 fn apply_fill(ctx: &CanvasRenderingContext2d, style: &Style, x: f64, y: f64, w: f64, h: f64) {
-    match &style.fill {
-        Some(Paint::LinearGradient { angle, stops }) => {
+    let gradient = style
+        .fill
+        .as_ref()
+        .and_then(|paint| build_gradient(ctx, paint, x, y, w, h));
+    set_fill(ctx, style, gradient.as_ref());
+}
+
+/// Set the fill style to `gradient`, or to the style's flat fill color.
+fn set_fill(ctx: &CanvasRenderingContext2d, style: &Style, gradient: Option<&CanvasGradient>) {
+    match gradient {
+        Some(grad) => ctx.set_fill_style_canvas_gradient(grad),
+        // Solid fills, and gradients the canvas refused, use a flat color
+        None => ctx.set_fill_style_str(&resolve_fill_color(style)),
+    }
+}
+
+/// Gradient for a paint spanning the given box, `None` for solid paints.
+pub(crate) fn build_gradient(
+    ctx: &CanvasRenderingContext2d,
+    paint: &Paint,
+    x: f64,
+    y: f64,
+    w: f64,
+    h: f64,
+) -> Option<CanvasGradient> {
+    let (grad, stops) = match paint {
+        Paint::LinearGradient { angle, stops } => {
             let rad = (*angle as f64).to_radians();
             let (sin_a, cos_a) = (rad.sin(), rad.cos());
             let cx = x + w / 2.0;
@@ -1016,34 +1053,37 @@ fn apply_fill(ctx: &CanvasRenderingContext2d, style: &Style, x: f64, y: f64, w:
             let len = (w * cos_a.abs() + h * sin_a.abs()) / 2.0;
             let (x0, y0) = (cx - len * cos_a, cy - len * sin_a);
             let (x1, y1) = (cx + len * cos_a, cy + len * sin_a);
-            let grad = ctx.create_linear_gradient(x0, y0, x1, y1);
-            for stop in stops {
-                let _ = grad.add_color_stop(stop.offset, &stop.color.to_hex());
-            }
-            ctx.set_fill_style_canvas_gradient(&grad);
+            (ctx.create_linear_gradient(x0, y0, x1, y1), stops)
         }
-        Some(Paint::RadialGradient { stops }) => {
+        Paint::RadialGradient { stops } => {
             let cx = x + w / 2.0;
             let cy = y + h / 2.0;
             let r = w.min(h) / 2.0;
-            match ctx.create_radial_gradient(cx, cy, 0.0, cx, cy, r) {
-                Ok(grad) => {
-                    for stop in stops {
-                        let _ = grad.add_color_stop(stop.offset, &stop.color.to_hex());
-                    }
-                    ctx.set_fill_style_canvas_gradient(&grad);
-                }
-                Err(_) => {
-                    let fallback = stops
-                        .first()
-                        .map(|s| s.color.to_hex())
-                        .unwrap_or_else(|| "#CCC".to_string());
-                    ctx.set_fill_style_str(&fallback);
-                }
-            }
+            (
+                ctx.create_radial_gradient(cx, cy, 0.0, cx, cy, r).ok()?,
+                stops,
+            )
         }
-        Some(Paint::Solid(c)) => ctx.set_fill_style_str(&c.to_hex()),
-        None => ctx.set_fill_style_str("#CCCCCC"),
+        Paint::Solid(_) => return None,
+    };
+    for stop in stops {
+        let _ = grad.add_color_stop(stop.offset, &stop.color.to_hex());
+    }
+    Some(grad)
+}
+
+/// The node's retained shape from `cache`, or a one-off shape when there's
+/// no cache (export).
+fn retained_shape(
+    ctx: &CanvasRenderingContext2d,
+    cache: Option<&DrawCache>,
+    idx: NodeIndex,
+    geometry: Geometry<'_>,
+    style: &Style,
+) -> Option<Shape> {
+    match cache {
+        Some(cache) => cache.shape(ctx, idx, geometry, style.fill.as_ref()),
+        None => Shape::build(ctx, geometry, style.fill.as_ref()),
     }
 }
 
@@ -1091,6 +1131,113 @@ fn apply_opacity(ctx: &CanvasRenderingContext2d, style: &Style) {
     }
 }
 
+// ─── Viewport culling ────────────────────────────────────────────────────
+
+/// Extra scene-space margin around the view, so shadows, strokes, selection
+/// handles and group badges of nodes just off-screen still paint.
+const CULL_MARGIN: f32 = 64.0;
+
+/// Scene-space rectangle `(x, y, w, h)` covered by the context's canvas
+/// under its current transform. `None` if it can't be determined (no
+/// canvas, degenerate transform), in which case nothing is culled.
+fn canvas_view_rect(ctx: &CanvasRenderingContext2d) -> Option<(f32, f32, f32, f32)> {
+    let canvas = ctx.canvas()?;
+    let m = ctx.get_transform().ok()?;
+    view_rect_from_transform(
+        [m.a(), m.b(), m.c(), m.d(), m.e(), m.f()],
+        canvas.width() as f64,
+        canvas.height() as f64,
+    )
+}
+
+/// Map the device rectangle `(0, 0)..(width, height)` back through the
+/// affine transform `[a, b, c, d, e, f]` and return its scene-space
+/// bounding box.
+fn view_rect_from_transform(
+    [a, b, c, d, e, f]: [f64; 6],
+    width: f64,
+    height: f64,
+) -> Option<(f32, f32, f32, f32)> {
+    let det = a * d - b * c;
+    if !det.is_finite() || det.abs() < 1e-12 {
+        return None;
+    }
+    let invert = |px: f64, py: f64| {
+        let (dx, dy) = (px - e, py - f);
+        ((d * dx - c * dy) / det, (a * dy - b * dx) / det)
+    };
+    let corners = [
+        invert(0.0, 0.0),
+        invert(width, 0.0),
+        invert(0.0, height),
+        invert(width, height),
+    ];
+    let (mut x0, mut y0) = (f64::INFINITY, f64::INFINITY);
+    let (mut x1, mut y1) = (f64::NEG_INFINITY, f64::NEG_INFINITY);
+    for (x, y) in corners {
+        x0 = x0.min(x);
+        y0 = y0.min(y);
+        x1 = x1.max(x);
+        y1 = y1.max(y);
+    }
+    Some((x0 as f32, y0 as f32, (x1 - x0) as f32, (y1 - y0) as f32))
+}
+
+/// Which nodes a frame paints.
+struct Culling {
+    /// Scene-space view, already inflated by [`CULL_MARGIN`].
+    view: (f32, f32, f32, f32),
+    /// Nodes intersecting the view.
+    visible: HashSet<NodeIndex>,
+    /// `visible` plus their ancestors — the part of the tree to walk.
+    walk: HashSet<NodeIndex>,
+}
+
+impl Culling {
+    fn new(graph: &SceneGraph, spatial: &SpatialIndex, view: (f32, f32, f32, f32)) -> Self {
+        let (x, y, w, h) = view;
+        let view = (
+            x - CULL_MARGIN,
+            y - CULL_MARGIN,
+            w + CULL_MARGIN * 2.0,
+            h + CULL_MARGIN * 2.0,
+        );
+        let visible: HashSet<NodeIndex> = spatial
+            .query_rect(view.0, view.1, view.2, view.3)
+            .into_iter()
+            .collect();
+
+        let mut walk = HashSet::with_capacity(visible.len() + 1);
+        walk.insert(graph.root);
+        for &idx in &visible {
+            let mut cur = Some(idx);
+            while let Some(node) = cur {
+                if !walk.insert(node) {
+                    break;
+                }
+                cur = graph.parent(node);
+            }
+        }
+
+        Self {
+            view,
+            visible,
+            walk,
+        }
+    }
+
+    /// Whether an edge between two scene points can touch the view. Smooth
+    /// curves bow out by up to 0.3× their span, so pad by that much.
+    fn edge_visible(&self, x1: f32, y1: f32, x2: f32, y2: f32) -> bool {
+        let pad = (x2 - x1).abs().max((y2 - y1).abs()) * 0.3;
+        let (vx, vy, vw, vh) = self.view;
+        x1.min(x2) - pad <= vx + vw
+            && x1.max(x2) + pad >= vx
+            && y1.min(y2) - pad <= vy + vh
+            && y1.max(y2) + pad >= vy
+    }
+}
+
 // ─── Sketchy / hand-drawn rendering ──────────────────────────────────────
 
 /// Deterministic pseudo-random jitter seeded by position.
@@ -1116,59 +1263,106 @@ fn sketchy_line(ctx: &CanvasRenderingContext2d, x1: f64, y1: f64, x2: f64, y2: f
     ctx.quadratic_curve_to(mx2, my2, x2, y2);
 }
 
-/// Draw a hand-drawn rectangle with wobbly edges.
-fn draw_rect_sketchy(
-    ctx: &CanvasRenderingContext2d,
-    b: &ResolvedBounds,
-    style: &Style,
-    is_selected: bool,
-) {
-    let (x, y, w, h) = (b.x as f64, b.y as f64, b.width as f64, b.height as f64);
-    let seed = x * 0.31 + y * 0.79;
-    let jitter = 1.5; // px wobble
+/// Sketchy-mode seed for a node. Derived from its id rather than its
+/// position, so the wobble stays put while the node is dragged and its
+/// cached outline stays valid.
+fn sketchy_seed(id: &str) -> f64 {
+    // FNV-1a, folded into a range where `sketchy_jitter`'s `sin` stays precise
+    let hash = id.bytes().fold(0xcbf2_9ce4_8422_2325_u64, |h, b| {
+        (h ^ b as u64).wrapping_mul(0x0100_0000_01b3)
+    });
+    (hash % 10_000) as f64
+}
 
-    ctx.save();
-    apply_opacity(ctx, style);
-    apply_shadow(ctx, style);
+/// Hand-drawn outline in node-local coordinates: a start point followed by
+/// quadratic segments `[cx, cy, x, y]`, closed back to the start.
+#[derive(Debug, Clone, PartialEq)]
+pub(crate) struct SketchyOutline {
+    pub start: (f64, f64),
+    pub quads: Vec<[f64; 4]>,
+}
 
-    // Build a wobbly rect path
-    let wobble_rect = |ctx: &CanvasRenderingContext2d, pass: u32| {
-        let s = seed + pass as f64 * 17.0;
-        let corners = [
-            (
-                x + sketchy_jitter(s, 0, jitter),
-                y + sketchy_jitter(s, 1, jitter),
-            ),
-            (
-                x + w + sketchy_jitter(s, 2, jitter),
-                y + sketchy_jitter(s, 3, jitter),
-            ),
-            (
-                x + w + sketchy_jitter(s, 4, jitter),
-                y + h + sketchy_jitter(s, 5, jitter),
-            ),
-            (
-                x + sketchy_jitter(s, 6, jitter),
-                y + h + sketchy_jitter(s, 7, jitter),
-            ),
-        ];
-        ctx.begin_path();
-        ctx.move_to(corners[0].0, corners[0].1);
-        for i in 0..4 {
+/// Wobbly rectangle outline of size `w`×`h`. `pass` 1 is the offset
+/// double-stroke drawn over pass 0.
+pub(crate) fn sketchy_rect_outline(w: f64, h: f64, seed: f64, pass: u32) -> SketchyOutline {
+    let jitter = 1.5; // px wobble
+    let s = seed + pass as f64 * 17.0;
+    let corners = [
+        (sketchy_jitter(s, 0, jitter), sketchy_jitter(s, 1, jitter)),
+        (
+            w + sketchy_jitter(s, 2, jitter),
+            sketchy_jitter(s, 3, jitter),
+        ),
+        (
+            w + sketchy_jitter(s, 4, jitter),
+            h + sketchy_jitter(s, 5, jitter),
+        ),
+        (
+            sketchy_jitter(s, 6, jitter),
+            h + sketchy_jitter(s, 7, jitter),
+        ),
+    ];
+    let quads = (0..4)
+        .map(|i| {
             let (cx, cy) = corners[i];
             let (nx, ny) = corners[(i + 1) % 4];
             // Add a tiny midpoint wobble to each edge
             let mx = (cx + nx) / 2.0 + sketchy_jitter(s, 8 + i as u32, jitter * 0.6);
             let my = (cy + ny) / 2.0 + sketchy_jitter(s, 12 + i as u32, jitter * 0.6);
-            ctx.quadratic_curve_to(mx, my, nx, ny);
-        }
-        ctx.close_path();
+            [mx, my, nx, ny]
+        })
+        .collect();
+    SketchyOutline {
+        start: corners[0],
+        quads,
+    }
+}
+
+/// Wobbly ellipse outline inscribed in `w`×`h`, approximated with jittery
+/// quadratic segments.
+pub(crate) fn sketchy_ellipse_outline(w: f64, h: f64, seed: f64, pass: u32) -> SketchyOutline {
+    let (rx, ry) = (w / 2.0, h / 2.0);
+    let (cx, cy) = (rx, ry);
+    let s = seed + pass as f64 * 23.0;
+    let jitter = 2.0;
+    let segments = 8;
+    let point = |angle: f64, i: u32| {
+        (
+            cx + rx * angle.cos() + sketchy_jitter(s, i, jitter),
+            cy + ry * angle.sin() + sketchy_jitter(s, i + 1, jitter),
+        )
     };
+    let quads = (0..segments)
+        .map(|i| {
+            let angle0 = (i as f64) * std::f64::consts::TAU / segments as f64;
+            let angle1 = ((i + 1) as f64) * std::f64::consts::TAU / segments as f64;
+            let (px1, py1) = point(angle1, i * 4 + 2);
+            // Use a control point slightly outside the ellipse for curvature
+            let mid_angle = (angle0 + angle1) / 2.0;
+            let cpx = cx + rx * 1.12 * mid_angle.cos() + sketchy_jitter(s, 32 + i, jitter * 0.5);
+            let cpy = cy + ry * 1.12 * mid_angle.sin() + sketchy_jitter(s, 40 + i, jitter * 0.5);
+            [cpx, cpy, px1, py1]
+        })
+        .collect();
+    SketchyOutline {
+        start: point(0.0, 0),
+        quads,
+    }
+}
+
+/// Draw a hand-drawn rect or ellipse from its retained outlines: fill and
+/// stroke the first pass, then a faint second stroke for the double-line
+/// look.
+fn draw_sketchy(ctx: &CanvasRenderingContext2d, b: &ResolvedBounds, style: &Style, shape: &Shape) {
+    let (x, y) = (b.x as f64, b.y as f64);
+
+    apply_opacity(ctx, style);
+    apply_shadow(ctx, style);
+    ctx.translate(x, y).unwrap_or(());
 
     // Fill with first pass
-    wobble_rect(ctx, 0);
-    apply_fill(ctx, style, x, y, w, h);
-    ctx.fill();
+    set_fill(ctx, style, shape.gradient.as_ref());
+    ctx.fill_with_path_2d(&shape.path);
     clear_shadow(ctx);
 
     // Stroke — draw two passes with slight offset for hand-drawn feel
@@ -1184,16 +1378,31 @@ fn draw_rect_sketchy(
     ctx.set_line_join("round");
 
     // Pass 1
-    wobble_rect(ctx, 0);
-    ctx.stroke();
+    ctx.stroke_with_path(&shape.path);
 
     // Pass 2 (slightly different wobble for hand-drawn double-stroke)
-    ctx.set_global_alpha(ctx.global_alpha() * 0.3);
-    wobble_rect(ctx, 1);
-    ctx.stroke();
-    ctx.set_global_alpha(ctx.global_alpha() / 0.3);
+    if let Some(ref overlay) = shape.overlay {
+        ctx.set_global_alpha(ctx.global_alpha() * 0.3);
+        ctx.stroke_with_path(overlay);
+        ctx.set_global_alpha(ctx.global_alpha() / 0.3);
+    }
+
+    ctx.translate(-x, -y).unwrap_or(());
+}
+
+/// Draw a hand-drawn rectangle with wobbly edges.
+fn draw_rect_sketchy(
+    ctx: &CanvasRenderingContext2d,
+    b: &ResolvedBounds,
+    style: &Style,
+    is_selected: bool,
+    shape: &Shape,
+) {
+    ctx.save();
+    draw_sketchy(ctx, b, style, shape);
 
     if is_selected {
+        let (x, y, w, h) = (b.x as f64, b.y as f64, b.width as f64, b.height as f64);
         ctx.set_stroke_style_str("#4FC3F7");
         ctx.set_line_width(2.0);
         rounded_rect_path(ctx, x - 1.0, y - 1.0, w + 2.0, h + 2.0, 0.0);
@@ -1203,78 +1412,21 @@ fn draw_rect_sketchy(
     ctx.restore();
 }
 
-/// Draw a hand-drawn ellipse with multiple jittery overlapping arcs.
+/// Draw a hand-drawn ellipse with jittery overlapping arcs.
 fn draw_ellipse_sketchy(
     ctx: &CanvasRenderingContext2d,
     b: &ResolvedBounds,
     style: &Style,
     is_selected: bool,
+    shape: &Shape,
 ) {
-    let cx = b.x as f64 + b.width as f64 / 2.0;
-    let cy = b.y as f64 + b.height as f64 / 2.0;
-    let rx = b.width as f64 / 2.0;
-    let ry = b.height as f64 / 2.0;
-    let seed = cx * 0.43 + cy * 0.67;
-
     ctx.save();
-    apply_opacity(ctx, style);
-    apply_shadow(ctx, style);
-
-    // Approximate ellipse with multiple cubic bezier segments + jitter
-    let draw_wobbly_ellipse = |ctx: &CanvasRenderingContext2d, pass: u32| {
-        let s = seed + pass as f64 * 23.0;
-        let jitter = 2.0;
-        let segments = 8;
-        ctx.begin_path();
-        for i in 0..segments {
-            let angle0 = (i as f64) * std::f64::consts::TAU / segments as f64;
-            let angle1 = ((i + 1) as f64) * std::f64::consts::TAU / segments as f64;
-            let px0 = cx + rx * angle0.cos() + sketchy_jitter(s, i * 4, jitter);
-            let py0 = cy + ry * angle0.sin() + sketchy_jitter(s, i * 4 + 1, jitter);
-            let px1 = cx + rx * angle1.cos() + sketchy_jitter(s, i * 4 + 2, jitter);
-            let py1 = cy + ry * angle1.sin() + sketchy_jitter(s, i * 4 + 3, jitter);
-
-            if i == 0 {
-                ctx.move_to(px0, py0);
-            }
-            // Use a control point slightly outside the ellipse for curvature
-            let mid_angle = (angle0 + angle1) / 2.0;
-            let cpx = cx + rx * 1.12 * mid_angle.cos() + sketchy_jitter(s, 32 + i, jitter * 0.5);
-            let cpy = cy + ry * 1.12 * mid_angle.sin() + sketchy_jitter(s, 40 + i, jitter * 0.5);
-            ctx.quadratic_curve_to(cpx, cpy, px1, py1);
-        }
-        ctx.close_path();
-    };
-
-    // Fill
-    draw_wobbly_ellipse(ctx, 0);
-    apply_fill(ctx, style, cx - rx, cy - ry, rx * 2.0, ry * 2.0);
-    ctx.fill();
-    clear_shadow(ctx);
-
-    // Stroke
-    let stroke_color = style
-        .stroke
-        .as_ref()
-        .map(|s| resolve_paint_color(&s.paint))
-        .unwrap_or_else(|| "#1C1C1E".to_string());
-    let stroke_width = style.stroke.as_ref().map_or(1.0, |s| s.width as f64);
-
-    ctx.set_stroke_style_str(&stroke_color);
-    ctx.set_line_width(stroke_width);
-    ctx.set_line_join("round");
-
-    // Pass 1
-    draw_wobbly_ellipse(ctx, 0);
-    ctx.stroke();
-
-    // Pass 2 (overlapping for hand-drawn look)
-    ctx.set_global_alpha(ctx.global_alpha() * 0.3);
-    draw_wobbly_ellipse(ctx, 1);
-    ctx.stroke();
-    ctx.set_global_alpha(ctx.global_alpha() / 0.3);
+    draw_sketchy(ctx, b, style, shape);
 
     if is_selected {
+        let rx = b.width as f64 / 2.0;
+        let ry = b.height as f64 / 2.0;
+        let (cx, cy) = (b.x as f64 + rx, b.y as f64 + ry);
         ctx.set_stroke_style_str("#4FC3F7");
         ctx.set_line_width(2.0);
         ctx.begin_path();
@@ -1475,6 +1627,34 @@ mod tests {
         assert_eq!(resolve_paint_color(&paint), "#CCCCCC");
     }
 
+    // ─── Viewport culling ───────────────────────────────────────────────
+
+    #[test]
+    fn view_rect_inverts_zoom_and_pan() {
+        // 2× zoom, panned 100px right and 50px down, on a 800×600 canvas
+        let view = view_rect_from_transform([2.0, 0.0, 0.0, 2.0, 100.0, 50.0], 800.0, 600.0);
+        assert_eq!(view, Some((-50.0, -25.0, 400.0, 300.0)));
+    }
+
+    #[test]
+    fn view_rect_degenerate_transform() {
+        let view = view_rect_from_transform([0.0, 0.0, 0.0, 0.0, 0.0, 0.0], 800.0, 600.0);
+        assert_eq!(view, None);
+    }
+
+    #[test]
+    fn edge_culling_pads_for_curves() {
+        let cull = Culling {
+            view: (0.0, 0.0, 100.0, 100.0),
+            visible: HashSet::new(),
+            walk: HashSet::new(),
+        };
+        assert!(cull.edge_visible(50.0, 50.0, 500.0, 500.0));
+        assert!(!cull.edge_visible(300.0, 300.0, 400.0, 310.0));
+        // Spans 0..=100 below the view, but a smooth curve may bow up into it
+        assert!(cull.edge_visible(0.0, 130.0, 100.0, 130.0));
+    }
+
     // ─── Sketchy rendering ──────────────────────────────────────────────
 
     #[test]
@@ -1497,6 +1677,26 @@ mod tests {
         }
     }
 
+    #[test]
+    fn sketchy_outline_is_deterministic_per_node() {
+        let seed = sketchy_seed("card");
+        assert_eq!(seed, sketchy_seed("card"));
+        assert_ne!(seed, sketchy_seed("card2"));
+
+        let a = sketchy_rect_outline(120.0, 80.0, seed, 0);
+        assert_eq!(a, sketchy_rect_outline(120.0, 80.0, seed, 0));
+        assert_ne!(a, sketchy_rect_outline(120.0, 80.0, seed, 1));
+        assert_eq!(a.quads.len(), 4);
+        // Local coordinates: the last segment closes near the origin
+        let [_, _, ex, ey] = a.quads[3];
+        assert_eq!((ex, ey), a.start);
+        assert!(ex.abs() <= 1.5 && ey.abs() <= 1.5);
+
+        let e = sketchy_ellipse_outline(100.0, 50.0, seed, 0);
+        assert_eq!(e.quads.len(), 8);
+        assert!((e.start.0 - 100.0).abs() <= 2.0 && (e.start.1 - 25.0).abs() <= 2.0);
+    }
+
     #[test]
     fn sketchy_jitter_varies_with_index() {
         let a = sketchy_jitter(42.0, 0, 2.0);
@@ -1,8 +1,6 @@
 use crate::render2d::CanvasTheme;
 use fd_core::NodeIndex;
-use fd_core::model::ResolvedBounds;
-use fd_core::model::{NodeKind, SceneGraph};
-use std::collections::HashMap;
+use fd_core::model::{BoundsMap, NodeKind, SceneGraph};
 
 fn paint_to_svg_color(p: &fd_core::model::Paint) -> String {
     match p {
@@ -42,7 +40,7 @@ fn paint_to_svg_color(p: &fd_core::model::Paint) -> String {
 
 pub fn render_svg(
     graph: &SceneGraph,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     selected_ids: &[String],
     theme: &CanvasTheme,
 ) -> String {
@@ -83,7 +81,7 @@ pub fn render_svg(
     #[allow(clippy::too_many_arguments)]
     fn expand_bounds(
         graph: &SceneGraph,
-        bounds_map: &HashMap<NodeIndex, ResolvedBounds>,
+        bounds_map: &BoundsMap,
         idx: NodeIndex,
         min_x: &mut f32,
         min_y: &mut f32,
@@ -151,7 +149,7 @@ fn render_node_svg(
     out: &mut String,
     graph: &SceneGraph,
     idx: NodeIndex,
-    bounds: &HashMap<NodeIndex, ResolvedBounds>,
+    bounds: &BoundsMap,
     theme: &CanvasTheme,
 ) {
     let node = &graph.graph[idx];
@@ -10,7 +10,7 @@ local parser_config = require("nvim-treesitter.parsers").get_parser_configs()
 parser_config.fd = {
   install_info = {
     url = "https://github.com/khangnghiem/fast-draft",
-    files = { "tree-sitter-fd/src/parser.c" },
+    files = { "tree-sitter-fd/src/parser.c", "tree-sitter-fd/src/scanner.c" },
     branch = "main",
     generate_requires_npm = false,
     requires_generate_from_grammar = false,
@@ -7,7 +7,13 @@
 ; ─── Keywords ──────────────────────────────────────────────
 (node_kind) @keyword
 "style" @keyword
+"theme" @keyword
 "anim" @keyword
+"when" @keyword
+"edge" @keyword
+"import" @keyword
+"as" @keyword
+"spec" @keyword
 
 ; ─── Node IDs ──────────────────────────────────────────────
 (node_id
@@ -16,9 +22,8 @@
 ; ─── Properties ────────────────────────────────────────────
 (property_name) @property
 
-; ─── Annotations ───────────────────────────────────────────
-"##" @attribute
-(annotation_keyword) @attribute
+; ─── Spec Blocks ───────────────────────────────────────────
+(spec_keyword) @attribute
 
 ; ─── Animation trigger ─────────────────────────────────────
 (anim_trigger
@@ -34,7 +39,11 @@
 
 ; ─── Key-value pairs ───────────────────────────────────────
 (key_value_pair
-  (identifier) @property)
+  key: (identifier) @property)
+
+; ─── Gradients ─────────────────────────────────────────────
+(gradient
+  function: (identifier) @function)
 
 ; ─── Identifiers in property values ────────────────────────
 (property
@@ -43,5 +52,9 @@
 ; ─── Punctuation ───────────────────────────────────────────
 "{" @punctuation.bracket
 "}" @punctuation.bracket
+"(" @punctuation.bracket
+")" @punctuation.bracket
 ":" @punctuation.delimiter
+"," @punctuation.delimiter
+";" @punctuation.delimiter
 "=" @operator
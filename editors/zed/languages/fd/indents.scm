@@ -1,6 +1,8 @@
 ; FD (Fast Draft) — Zed indentation queries
 
-; Indent inside node declarations and style blocks
+; Indent inside node declarations, edges, and style blocks
 (node_declaration "{" @indent "}" @outdent)
 (style_block "{" @indent "}" @outdent)
 (anim_block "{" @indent "}" @outdent)
+(edge_block "{" @indent "}" @outdent)
+(spec_block "{" @indent "}" @outdent)
@@ -1,10 +1,17 @@
 import * as vscode from "vscode";
 import { parseDocumentSymbols, FdSymbol } from "./fd-parse";
+import type { FdLspClient } from "./fd-lsp-client";
 
 export class FdDocumentSymbolProvider implements vscode.DocumentSymbolProvider {
-  provideDocumentSymbols(
+  constructor(private readonly lsp?: FdLspClient) {}
+
+  async provideDocumentSymbols(
     document: vscode.TextDocument
-  ): vscode.DocumentSymbol[] {
+  ): Promise<vscode.DocumentSymbol[]> {
+    // Incremental tree-sitter outline from fd-lsp; full TS reparse otherwise
+    const fromServer = await this.lsp?.documentSymbols(document);
+    if (fromServer) return fromServer;
+
     const lines: string[] = [];
     for (let i = 0; i < document.lineCount; i++) {
       lines.push(document.lineAt(i).text);
@@ -19,6 +26,7 @@ export class FdDocumentSymbolProvider implements vscode.DocumentSymbolProvider {
   ): vscode.DocumentSymbol {
     const kindMap: Record<string, vscode.SymbolKind> = {
       group: vscode.SymbolKind.Module,
+      frame: vscode.SymbolKind.Module,
       rect: vscode.SymbolKind.Struct,
       ellipse: vscode.SymbolKind.Struct,
       path: vscode.SymbolKind.Struct,
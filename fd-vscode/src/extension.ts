@@ -15,6 +15,7 @@ import { FdDiagnosticsProvider } from "./diagnostics";
 import { FdTreePreviewPanel } from "./panels/tree-preview";
 import { FdSpecViewPanel } from "./panels/spec-view";
 import { FdDocumentSymbolProvider } from "./document-symbol";
+import { FdLspClient } from "./fd-lsp-client";
 import { FdReadOnlyProvider, FD_READONLY_SCHEME, VIEW_MODE_LABELS, FdViewMode } from "./panels/readonly-provider";
 import { getNonce, HTML_TEMPLATE, VIEW_TYPE_CANVAS, COMMAND_AI_REFINE, COMMAND_AI_REFINE_ALL, COMMAND_EXPORT_SPEC, COMMAND_OPEN_CANVAS, COMMAND_SHOW_PREVIEW, COMMAND_SHOW_SPEC_VIEW, COMMAND_TOGGLE_VIEW_MODE, COMMAND_OPEN_READONLY_VIEW, COMMAND_CHANGE_VIEW_MODE, COMMAND_RENAMIFY } from "./webview-html";
 
@@ -75,7 +76,7 @@ class FdEditorProvider implements vscode.CustomTextEditorProvider {
       });
 
     // ─── Webview → Extension: canvas mutations ─────────────────────
-    webviewPanel.webview.onDidReceiveMessage(async (message: { type: string; text?: string; id?: string; nodeIds?: string[] }) => {
+    webviewPanel.webview.onDidReceiveMessage(async (message: { type: string; text?: string; edit?: TextEditMessage; id?: string; nodeIds?: string[] }) => {
       switch (message.type) {
         case "textChanged": {
           const incoming = message.text ?? "";
@@ -89,12 +90,21 @@ class FdEditorProvider implements vscode.CustomTextEditorProvider {
           const lastLineRange = document.lineAt(lastLine).range;
           const fullRange = new vscode.Range(0, 0, lastLine, lastLineRange.end.character);
 
+          // Prefer the minimal edit from the canvas engine, so only the
+          // touched node blocks are rewritten (keeps cursor, undo and LSP
+          // sync incremental). Fall back to a full replacement if it doesn't
+          // line up with the current document.
           const edit = new vscode.WorkspaceEdit();
-          edit.replace(
-            document.uri,
-            fullRange,
-            incoming
-          );
+          const ranged = message.edit && rangeForEdit(document, message.edit, incoming);
+          if (ranged) {
+            edit.replace(document.uri, ranged, message.edit!.text);
+          } else {
+            edit.replace(
+              document.uri,
+              fullRange,
+              incoming
+            );
+          }
           await vscode.workspace.applyEdit(edit);
           suppressEchoBack = false;
           // Delay re-enabling cursor sync — selection events fire asynchronously
@@ -417,6 +427,39 @@ class FdEditorProvider implements vscode.CustomTextEditorProvider {
   }
 }
 
+// ─── Canvas → text edits ─────────────────────────────────────────────────
+
+/**
+ * Minimal edit from the canvas engine (`FdCanvas.take_text_edit`): replace
+ * from UTF-16 offset `start` up to the last `suffix` units with `text`.
+ */
+interface TextEditMessage {
+  start: number;
+  suffix: number;
+  text: string;
+}
+
+/**
+ * Document range an edit replaces, or `undefined` unless applying it gives
+ * exactly `incoming`: the text the edit keeps on either side must match the
+ * canvas text, or the document changed meanwhile (e.g. a same-length
+ * overtype) and the edit would splice into the wrong content.
+ */
+function rangeForEdit(
+  document: vscode.TextDocument,
+  edit: TextEditMessage,
+  incoming: string
+): vscode.Range | undefined {
+  const text = document.getText();
+  const end = text.length - edit.suffix;
+  if (edit.start < 0 || end < edit.start) return undefined;
+  if (text.length - (end - edit.start) + edit.text.length !== incoming.length) return undefined;
+  if (text.slice(0, edit.start) !== incoming.slice(0, edit.start)) return undefined;
+  if (text.slice(end) !== incoming.slice(incoming.length - edit.suffix)) return undefined;
+  if (incoming.slice(edit.start, edit.start + edit.text.length) !== edit.text) return undefined;
+  return new vscode.Range(document.positionAt(edit.start), document.positionAt(end));
+}
+
 // ─── Spec Markdown Export ────────────────────────────────────────────────
 
 function exportSpecMarkdown(): void {
@@ -993,11 +1036,15 @@ export function activate(context: vscode.ExtensionContext) {
   const diagnostics = new FdDiagnosticsProvider();
   diagnostics.activate(context);
 
+  // Bundled fd-lsp: incremental outline and folds (if the binary runs here)
+  const lsp = new FdLspClient();
+  lsp.activate(context);
+
   // Register document symbol provider (Outline view)
   context.subscriptions.push(
     vscode.languages.registerDocumentSymbolProvider(
       "fd",
-      new FdDocumentSymbolProvider()
+      new FdDocumentSymbolProvider(lsp)
     )
   );
 
@@ -1026,9 +1073,10 @@ export function activate(context: vscode.ExtensionContext) {
     applyCodeSpecView();
   };
 
-  // ─── FoldingRangeProvider for Spec View ─────────────────────────────
+  // ─── FoldingRangeProvider ───────────────────────────────────────────
   // When spec mode is active, provide fold ranges for style/anim/property
-  // blocks so they collapse to zero height (no gaps).
+  // blocks so they collapse to zero height (no gaps). Otherwise fold the
+  // node, edge, style, anim and spec blocks from fd-lsp's syntax tree.
 
   const foldChangeEmitter = new vscode.EventEmitter<void>();
   context.subscriptions.push(foldChangeEmitter);
@@ -1037,8 +1085,10 @@ export function activate(context: vscode.ExtensionContext) {
     onDidChangeFoldingRanges: foldChangeEmitter.event,
     provideFoldingRanges(
       document: vscode.TextDocument
-    ): vscode.FoldingRange[] {
-      if (codeSpecMode !== "spec") return [];
+    ): vscode.ProviderResult<vscode.FoldingRange[]> {
+      if (codeSpecMode !== "spec") {
+        return lsp.foldingRanges(document).then((folds) => folds ?? []);
+      }
       const lines: string[] = [];
       for (let i = 0; i < document.lineCount; i++) {
         lines.push(document.lineAt(i).text);
@@ -0,0 +1,291 @@
+import * as vscode from "vscode";
+import * as fs from "fs";
+import * as path from "path";
+import { spawn, ChildProcess } from "child_process";
+import { LspConnection } from "./lsp-connection";
+
+/**
+ * Outline and folding from the bundled `fd-lsp` server.
+ *
+ * fd-lsp keeps a tree-sitter tree per document and applies each change
+ * incrementally (`tree.edit()` and a reparse that reuses every untouched
+ * subtree), so answering documentSymbol / foldingRange costs the size of
+ * the edit, not of the file. Documents are synced with incremental
+ * `didChange` notifications straight from VS Code's content changes.
+ *
+ * If the binary is missing, can't run on this platform, or stops
+ * responding, every query resolves to `undefined` and callers fall back to
+ * the TypeScript parser in fd-parse.ts.
+ */
+
+// ─── Minimal LSP result shapes ───────────────────────────────────────────
+
+interface LspPosition {
+  line: number;
+  character: number;
+}
+
+interface LspRange {
+  start: LspPosition;
+  end: LspPosition;
+}
+
+interface LspDocumentSymbol {
+  name: string;
+  detail?: string;
+  kind: number;
+  range: LspRange;
+  selectionRange: LspRange;
+  children?: LspDocumentSymbol[];
+}
+
+interface LspSymbolInformation {
+  name: string;
+  kind: number;
+  location: { uri: string; range: LspRange };
+  containerName?: string;
+}
+
+interface LspFoldingRange {
+  startLine: number;
+  endLine: number;
+  kind?: string;
+}
+
+/** How long `initialize` may take before the server is given up on. */
+const INITIALIZE_TIMEOUT_MS = 5000;
+
+/** Per-query budget; past it the caller falls back to the TS parser. */
+const REQUEST_TIMEOUT_MS = 1000;
+
+// ─── Client ──────────────────────────────────────────────────────────────
+
+export class FdLspClient {
+  private server: ChildProcess | undefined;
+  /** Set once `initialize` has succeeded; cleared when the server stops. */
+  private connection: LspConnection | undefined;
+  /** Connection to the running server, initialized or not. */
+  private rpc: LspConnection | undefined;
+  /** URIs the server has been sent `didOpen` for. */
+  private readonly opened = new Set<string>();
+
+  public activate(context: vscode.ExtensionContext): void {
+    const binName = process.platform === "win32" ? "fd-lsp.exe" : "fd-lsp";
+    const binPath = path.join(context.extensionPath, "bin", binName);
+    if (!fs.existsSync(binPath)) return;
+
+    let child: ChildProcess;
+    try {
+      child = spawn(binPath, [], { stdio: ["pipe", "pipe", "ignore"] });
+    } catch {
+      return;
+    }
+    if (!child.stdin || !child.stdout) {
+      child.kill();
+      return;
+    }
+    const connection = new LspConnection(child.stdout, child.stdin, (method) =>
+      // registerCapability, workDoneProgress/create, … need only an ack;
+      // workspace/configuration wants one (empty) item per request
+      method === "workspace/configuration" ? [] : null
+    );
+    this.server = child;
+    this.rpc = connection;
+    child.on("error", () => this.stop());
+    child.on("exit", () => this.stop());
+    child.stdin.on("error", () => this.stop());
+
+    connection
+      .request(
+        "initialize",
+        {
+          processId: process.pid,
+          clientInfo: { name: "fast-draft" },
+          rootUri: vscode.workspace.workspaceFolders?.[0]?.uri.toString() ?? null,
+          capabilities: {
+            textDocument: {
+              synchronization: { dynamicRegistration: false },
+              documentSymbol: { hierarchicalDocumentSymbolSupport: true },
+              foldingRange: { lineFoldingOnly: true },
+            },
+          },
+        },
+        INITIALIZE_TIMEOUT_MS
+      )
+      .then(() => {
+        if (this.server !== child) return;
+        connection.notify("initialized", {});
+        this.connection = connection;
+        for (const doc of vscode.workspace.textDocuments) {
+          this.didOpen(doc);
+        }
+      })
+      .catch(() => this.stop());
+
+    context.subscriptions.push(
+      vscode.workspace.onDidOpenTextDocument((doc: vscode.TextDocument) => this.didOpen(doc)),
+      vscode.workspace.onDidChangeTextDocument((e: vscode.TextDocumentChangeEvent) =>
+        this.didChange(e)
+      ),
+      vscode.workspace.onDidCloseTextDocument((doc: vscode.TextDocument) => this.didClose(doc)),
+      { dispose: () => this.shutdown() }
+    );
+  }
+
+  /** Outline from the server's syntax tree, or `undefined` to fall back. */
+  public async documentSymbols(
+    document: vscode.TextDocument
+  ): Promise<vscode.DocumentSymbol[] | undefined> {
+    const result = await this.query<(LspDocumentSymbol | LspSymbolInformation)[]>(
+      "textDocument/documentSymbol",
+      document
+    );
+    if (!result) return undefined;
+    // Nested symbols normally; flat ones if fd-lsp has no syntax tree
+    return result.map((symbol) =>
+      toDocumentSymbol("location" in symbol ? fromSymbolInformation(symbol) : symbol)
+    );
+  }
+
+  /** Block folds from the server, or `undefined` to fall back. */
+  public async foldingRanges(
+    document: vscode.TextDocument
+  ): Promise<vscode.FoldingRange[] | undefined> {
+    const result = await this.query<LspFoldingRange[]>("textDocument/foldingRange", document);
+    return result?.map(
+      (fold) => new vscode.FoldingRange(fold.startLine, fold.endLine, toFoldingKind(fold.kind))
+    );
+  }
+
+  private async query<T>(method: string, document: vscode.TextDocument): Promise<T | undefined> {
+    const connection = this.connection;
+    const uri = document.uri.toString();
+    if (!connection || !this.opened.has(uri)) return undefined;
+    try {
+      const result = await connection.request<T | null>(
+        method,
+        { textDocument: { uri } },
+        REQUEST_TIMEOUT_MS
+      );
+      return result ?? undefined;
+    } catch {
+      return undefined;
+    }
+  }
+
+  // ─── Document sync ─────────────────────────────────────────────────────
+
+  private didOpen(doc: vscode.TextDocument): void {
+    const uri = doc.uri.toString();
+    if (!this.connection || doc.languageId !== "fd" || this.opened.has(uri)) return;
+    this.opened.add(uri);
+    this.connection.notify("textDocument/didOpen", {
+      textDocument: { uri, languageId: "fd", version: doc.version, text: doc.getText() },
+    });
+  }
+
+  private didChange(e: vscode.TextDocumentChangeEvent): void {
+    const uri = e.document.uri.toString();
+    if (!this.connection || !this.opened.has(uri) || e.contentChanges.length === 0) return;
+    // VS Code orders one event's changes bottom to top, so applying them
+    // one after another, as LSP does, keeps every range valid.
+    this.connection.notify("textDocument/didChange", {
+      textDocument: { uri, version: e.document.version },
+      contentChanges: e.contentChanges.map((change) => ({
+        range: toLspRange(change.range),
+        rangeLength: change.rangeLength,
+        text: change.text,
+      })),
+    });
+  }
+
+  private didClose(doc: vscode.TextDocument): void {
+    const uri = doc.uri.toString();
+    if (!this.opened.delete(uri)) return;
+    this.connection?.notify("textDocument/didClose", { textDocument: { uri } });
+  }
+
+  // ─── Lifecycle ─────────────────────────────────────────────────────────
+
+  /** Forget the server after it exited or failed; callers fall back. */
+  private stop(): void {
+    const child = this.server;
+    if (!child) return;
+    this.server = undefined;
+    this.rpc?.close(new Error("fd-lsp stopped"));
+    this.rpc = undefined;
+    this.connection = undefined;
+    this.opened.clear();
+    child.kill();
+  }
+
+  private shutdown(): void {
+    const connection = this.connection;
+    if (!connection) {
+      this.stop();
+      return;
+    }
+    connection
+      .request("shutdown", null, REQUEST_TIMEOUT_MS)
+      .then(() => connection.notify("exit", null))
+      .catch(() => undefined)
+      .finally(() => this.stop());
+  }
+}
+
+// ─── Conversions ─────────────────────────────────────────────────────────
+
+function toLspRange(range: vscode.Range): LspRange {
+  return {
+    start: { line: range.start.line, character: range.start.character },
+    end: { line: range.end.line, character: range.end.character },
+  };
+}
+
+function toRange(range: LspRange): vscode.Range {
+  return new vscode.Range(
+    range.start.line,
+    range.start.character,
+    range.end.line,
+    range.end.character
+  );
+}
+
+function fromSymbolInformation(symbol: LspSymbolInformation): LspDocumentSymbol {
+  return {
+    name: symbol.name,
+    detail: symbol.containerName,
+    kind: symbol.kind,
+    range: symbol.location.range,
+    selectionRange: symbol.location.range,
+  };
+}
+
+function toDocumentSymbol(symbol: LspDocumentSymbol): vscode.DocumentSymbol {
+  const range = toRange(symbol.range);
+  const selection = toRange(symbol.selectionRange);
+  const dsym = new vscode.DocumentSymbol(
+    symbol.name,
+    symbol.detail ?? "",
+    // LSP SymbolKind is 1-based, vscode.SymbolKind 0-based
+    Math.max(0, symbol.kind - 1) as vscode.SymbolKind,
+    range,
+    // VS Code rejects a selection outside the full range
+    range.contains(selection) ? selection : range
+  );
+  dsym.children = (symbol.children ?? []).map(toDocumentSymbol);
+  return dsym;
+}
+
+function toFoldingKind(kind: string | undefined): vscode.FoldingRangeKind | undefined {
+  switch (kind) {
+    case "comment":
+      return vscode.FoldingRangeKind.Comment;
+    case "imports":
+      return vscode.FoldingRangeKind.Imports;
+    case "region":
+      return vscode.FoldingRangeKind.Region;
+    default:
+      return undefined;
+  }
+}
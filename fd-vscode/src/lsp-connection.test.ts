@@ -0,0 +1,64 @@
+import { describe, it, expect } from "vitest";
+import { PassThrough } from "stream";
+import { LspConnection, encodeMessage } from "./lsp-connection";
+
+/** A client and a fake server talking over in-memory pipes. */
+function connectedPair(onServerRequest: (method: string, params: unknown) => unknown) {
+  const toServer = new PassThrough();
+  const toClient = new PassThrough();
+  const client = new LspConnection(toClient, toServer, () => "from client");
+  const server = new LspConnection(toServer, toClient, onServerRequest);
+  return { client, server };
+}
+
+describe("LspConnection", () => {
+  it("frames bodies by byte length, not string length", () => {
+    const framed = encodeMessage({ text: "→" }).toString("utf8");
+    // "→" is one UTF-16 unit but three UTF-8 bytes
+    expect(framed).toBe('Content-Length: 14\r\n\r\n{"text":"→"}');
+  });
+
+  it("resolves requests with the other side's result", async () => {
+    const { client } = connectedPair((method, params) => ({ method, params }));
+    await expect(client.request("textDocument/documentSymbol", { n: 1 })).resolves.toEqual({
+      method: "textDocument/documentSymbol",
+      params: { n: 1 },
+    });
+  });
+
+  it("rejects on an error response", async () => {
+    const { client } = connectedPair(() => {
+      throw new Error("no tree");
+    });
+    await expect(client.request("textDocument/foldingRange", {})).rejects.toThrow("no tree");
+  });
+
+  it("answers requests from the server", async () => {
+    const { server } = connectedPair(() => null);
+    await expect(server.request("client/registerCapability", {})).resolves.toBe("from client");
+  });
+
+  it("reassembles messages split across chunks", async () => {
+    const input = new PassThrough();
+    const requests: string[] = [];
+    new LspConnection(input, new PassThrough(), (method) => requests.push(method));
+    const bytes = Buffer.concat([
+      encodeMessage({ jsonrpc: "2.0", id: 1, method: "a" }),
+      encodeMessage({ jsonrpc: "2.0", id: 2, method: "b→" }),
+    ]);
+    for (const byte of bytes) input.write(Buffer.from([byte]));
+    await new Promise((resolve) => setImmediate(resolve));
+    expect(requests).toEqual(["a", "b→"]);
+  });
+
+  it("times out and fails pending requests on close", async () => {
+    const output = new PassThrough();
+    const connection = new LspConnection(new PassThrough(), output);
+    await expect(connection.request("initialize", {}, 10)).rejects.toThrow("timed out");
+
+    const pending = connection.request("shutdown", null);
+    connection.close(new Error("fd-lsp stopped"));
+    await expect(pending).rejects.toThrow("fd-lsp stopped");
+    await expect(connection.request("shutdown", null)).rejects.toThrow("closed");
+  });
+});
@@ -0,0 +1,144 @@
+/**
+ * Minimal JSON-RPC 2.0 over `Content-Length` framed streams, the transport
+ * the Language Server Protocol uses on stdio.
+ *
+ * Just enough for the extension to drive `fd-lsp`: requests with an
+ * optional timeout, notifications, and answering the few requests the
+ * server sends back (e.g. `client/registerCapability`). Kept free of the
+ * `vscode` module so it can be unit-tested.
+ */
+
+interface Pending {
+  resolve(result: unknown): void;
+  reject(error: Error): void;
+  timer?: ReturnType<typeof setTimeout>;
+}
+
+interface Message {
+  jsonrpc: "2.0";
+  id?: number | string | null;
+  method?: string;
+  params?: unknown;
+  result?: unknown;
+  error?: { code: number; message: string };
+}
+
+/** Answers a request from the other side; the return value is the result. */
+export type RequestHandler = (method: string, params: unknown) => unknown;
+
+const HEADER_END = "\r\n\r\n";
+
+/** Frame `message` with its `Content-Length` header. */
+export function encodeMessage(message: object): Buffer {
+  const body = Buffer.from(JSON.stringify(message), "utf8");
+  return Buffer.concat([
+    Buffer.from(`Content-Length: ${body.length}${HEADER_END}`, "ascii"),
+    body,
+  ]);
+}
+
+export class LspConnection {
+  private buffer = Buffer.alloc(0);
+  private nextId = 1;
+  private readonly pending = new Map<number, Pending>();
+  private closed = false;
+
+  constructor(
+    input: NodeJS.ReadableStream,
+    private readonly output: NodeJS.WritableStream,
+    private readonly onRequest: RequestHandler = () => null
+  ) {
+    input.on("data", (chunk: Buffer) => this.receive(chunk));
+  }
+
+  /**
+   * Send a request. Rejects if the connection closes first or, with a
+   * non-zero `timeoutMs`, if no response arrives in time.
+   */
+  public request<T>(method: string, params: unknown, timeoutMs = 0): Promise<T> {
+    if (this.closed) return Promise.reject(new Error("connection closed"));
+    const id = this.nextId++;
+    return new Promise<T>((resolve, reject) => {
+      const pending: Pending = { resolve: resolve as (result: unknown) => void, reject };
+      if (timeoutMs > 0) {
+        pending.timer = setTimeout(() => {
+          this.pending.delete(id);
+          reject(new Error(`${method} timed out after ${timeoutMs} ms`));
+        }, timeoutMs);
+      }
+      this.pending.set(id, pending);
+      this.send({ jsonrpc: "2.0", id, method, params });
+    });
+  }
+
+  public notify(method: string, params: unknown): void {
+    if (this.closed) return;
+    this.send({ jsonrpc: "2.0", method, params });
+  }
+
+  /** Reject every outstanding request; later calls fail immediately. */
+  public close(reason: Error): void {
+    this.closed = true;
+    for (const pending of this.pending.values()) {
+      if (pending.timer) clearTimeout(pending.timer);
+      pending.reject(reason);
+    }
+    this.pending.clear();
+  }
+
+  private send(message: Message): void {
+    this.output.write(encodeMessage(message));
+  }
+
+  private receive(chunk: Buffer): void {
+    this.buffer = Buffer.concat([this.buffer, chunk]);
+    for (;;) {
+      const headerEnd = this.buffer.indexOf(HEADER_END);
+      if (headerEnd < 0) return;
+      const header = this.buffer.subarray(0, headerEnd).toString("ascii");
+      const match = /Content-Length: *(\d+)/i.exec(header);
+      const bodyStart = headerEnd + HEADER_END.length;
+      if (!match) {
+        // Not a frame we understand: drop the header and resync
+        this.buffer = this.buffer.subarray(bodyStart);
+        continue;
+      }
+      const bodyEnd = bodyStart + Number(match[1]);
+      if (this.buffer.length < bodyEnd) return;
+      const body = this.buffer.subarray(bodyStart, bodyEnd).toString("utf8");
+      this.buffer = this.buffer.subarray(bodyEnd);
+      try {
+        this.dispatch(JSON.parse(body) as Message);
+      } catch {
+        // Malformed body: skip it
+      }
+    }
+  }
+
+  private dispatch(message: Message): void {
+    if (message.method === undefined) {
+      // Response to one of our requests
+      if (typeof message.id !== "number") return;
+      const pending = this.pending.get(message.id);
+      if (!pending) return;
+      this.pending.delete(message.id);
+      if (pending.timer) clearTimeout(pending.timer);
+      if (message.error) {
+        pending.reject(new Error(message.error.message));
+      } else {
+        pending.resolve(message.result ?? null);
+      }
+      return;
+    }
+    if (message.id === undefined || message.id === null) return; // notification
+    let result: unknown;
+    try {
+      result = this.onRequest(message.method, message.params);
+    } catch (err) {
+      const error = { code: -32603, message: String(err) };
+      this.send({ jsonrpc: "2.0", id: message.id, error });
+      return;
+    }
+    this.send({ jsonrpc: "2.0", id: message.id, result: result ?? null });
+  }
+}
@@ -71,7 +71,7 @@ let cachedSceneBounds = null;
 let sceneBoundsGeneration = -1;
 
 /** Mark the canvas as needing a re-render on the next animation frame. */
-function markDirty() { renderDirty = true; }
+function markDirty() { renderDirty = true; startAnimLoop(); }
 /** Bump the scene generation counter (call on any data mutation). */
 function bumpGeneration() { sceneGeneration++; markDirty(); }
 
@@ -212,6 +212,7 @@ function startTween(nodeId, prop, from, to, duration, easeName) {
     duration: duration || 300,
     easeFn: EASE_FNS[easeName] || EASE_FNS.spring,
   });
+  startAnimLoop();
 }
 
 /** Evaluate all active tweens, returning a map of { nodeId → { prop → value } } */
@@ -291,7 +292,7 @@ function playDetachAnimation(nodeId) {
   } catch (_) { /* skip if bounds unavailable */ }
 
   // Force re-render to reflect tree structure change
-  renderDirty = true;
+  markDirty();
 }
 
 // ─── Initialization ──────────────────────────────────────────────────────
@@ -500,18 +501,24 @@ let animFrameId = null;
 
 /**
  * Start the dirty-checked animation loop.
- * The loop keeps running via rAF but only calls render() when:
+ * The loop calls render() while any of these hold:
  *   - renderDirty is true (user interaction, text change, resize, etc.)
  *   - activeTweens are in progress (spring/ease animations)
- * When idle, this loop is essentially free (no WASM calls, no DOM work).
+ *   - the engine has a running hover animation or flow edges
+ * Once none do, it stops requesting frames; markDirty() and startTween()
+ * restart it.
  */
 function startAnimLoop() {
   if (animFrameId !== null) return; // already running
-  function loop() {
-    if (renderDirty || activeTweens.length > 0) {
-      renderDirty = false;
-      render();
+  function loop(now) {
+    const animating = activeTweens.length > 0
+      || (fdCanvas !== null && fdCanvas.needs_animation_frame(now));
+    if (!renderDirty && !animating) {
+      animFrameId = null; // idle until the next markDirty()
+      return;
     }
+    renderDirty = false;
+    render();
     animFrameId = requestAnimationFrame(loop);
   }
   animFrameId = requestAnimationFrame(loop);
@@ -1307,6 +1314,8 @@ let lastSyncedText = "";
 function syncTextToExtension() {
   if (!fdCanvas || suppressTextSync) return;
   const text = fdCanvas.get_text();
+  // Minimal edit since the last sync ("" = send the whole text)
+  const editJson = fdCanvas.take_text_edit();
   // Skip if text hasn't changed — avoids full document replacement that destroys cursor
   if (text === lastSyncedText) return;
   lastSyncedText = text;
@@ -1314,6 +1323,7 @@ function syncTextToExtension() {
   vscode.postMessage({
     type: "textChanged",
     text: text,
+    edit: editJson ? JSON.parse(editJson) : undefined,
   });
 }
 
@@ -0,0 +1,28 @@
+// ─── FD Playground — parse + layout worker ───
+//
+// Runs the parser and layout solver off the main thread. Each request
+// `{ text, width, height }` is answered with `{ text, snapshot }`, the
+// snapshot's buffer transferred rather than copied, or `{ text, error }`.
+// The page restores the snapshot with `FdCanvas.set_text_with_snapshot`.
+// If the wasm module fails to load, the reply is `{ text, error, fatal }`
+// and the page parses on the main thread from then on.
+
+import init, { layout_snapshot } from './wasm/fd_wasm.js';
+
+const ready = init(new URL('./wasm/fd_wasm_bg.wasm', import.meta.url));
+
+self.onmessage = async (event) => {
+  const { text, width, height } = event.data;
+  try {
+    await ready;
+  } catch (err) {
+    self.postMessage({ text, error: String(err), fatal: true });
+    return;
+  }
+  try {
+    const snapshot = layout_snapshot(text, width, height);
+    self.postMessage({ text, snapshot }, [snapshot.buffer]);
+  } catch (err) {
+    self.postMessage({ text, error: String(err) });
+  }
+};
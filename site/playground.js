@@ -167,6 +167,77 @@ let fdCanvas = null;
 let isDark = true;
 let isSketchy = false;
 let animFrameId = null;
+let canvasSize = { width: 0, height: 0 };
+
+// ─── Off-main-thread layout ───
+
+/**
+ * Parse and lay out in a Web Worker (`fd-worker.js`) so typing never waits
+ * on them; the canvas only restores the finished snapshot. At most one
+ * request is in flight, and edits made meanwhile collapse into the next
+ * one. Falls back to parsing on the page if the worker can't start.
+ */
+function createTextUpdater() {
+  let worker = null;
+  try {
+    worker = new Worker(new URL('./fd-worker.js', import.meta.url), { type: 'module' });
+  } catch (_) {
+    worker = null;
+  }
+
+  let busy = false;
+  let inFlight = null;
+  let pending = null;
+
+  const send = (text) => {
+    busy = true;
+    inFlight = text;
+    worker.postMessage({ text, width: canvasSize.width, height: canvasSize.height });
+  };
+
+  const fallback = (text) => {
+    worker = null;
+    busy = false;
+    pending = null;
+    if (fdCanvas && text !== null) {
+      fdCanvas.set_text(text);
+    }
+  };
+
+  if (worker) {
+    worker.onmessage = (event) => {
+      const { text, snapshot, fatal } = event.data;
+      if (fatal) {
+        // wasm failed to load in the worker: parse here from now on
+        worker.terminate();
+        fallback(pending ?? text);
+        return;
+      }
+      busy = false;
+      // Parse errors leave the last good document on screen
+      if (snapshot && fdCanvas) {
+        fdCanvas.set_text_with_snapshot(text, snapshot);
+      }
+      if (pending !== null) {
+        const next = pending;
+        pending = null;
+        send(next);
+      }
+    };
+    // e.g. no module-worker support: parse the latest text here instead
+    worker.onerror = () => fallback(pending ?? inFlight);
+  }
+
+  return (text) => {
+    if (!worker) {
+      fallback(text);
+    } else if (busy) {
+      pending = text;
+    } else {
+      send(text);
+    }
+  };
+}
 
 async function initPlayground() {
   const editor = document.getElementById('fd-editor');
@@ -190,6 +261,7 @@ async function initPlayground() {
       canvas.height = rect.height * dpr;
       canvas.style.width = rect.width + 'px';
       canvas.style.height = rect.height + 'px';
+      canvasSize = { width: rect.width, height: rect.height };
 
       if (fdCanvas) {
         fdCanvas.resize(rect.width, rect.height);
@@ -203,6 +275,7 @@ async function initPlayground() {
     fdCanvas = new wasm.FdCanvas(rect.width, rect.height);
     fdCanvas.set_theme(isDark);
     fdCanvas.set_text(editor.value);
+    const updateText = createTextUpdater();
 
     // Get canvas 2D context
     const ctx = canvas.getContext('2d');
@@ -224,11 +297,7 @@ async function initPlayground() {
     let debounceTimer = null;
     editor.addEventListener('input', () => {
       clearTimeout(debounceTimer);
-      debounceTimer = setTimeout(() => {
-        if (fdCanvas) {
-          fdCanvas.set_text(editor.value);
-        }
-      }, 50);
+      debounceTimer = setTimeout(() => updateText(editor.value), 50);
     });
 
     // Resize observer
@@ -242,9 +311,7 @@ async function initPlayground() {
       const example = EXAMPLES[e.target.value];
       if (example) {
         editor.value = example;
-        if (fdCanvas) {
-          fdCanvas.set_text(example);
-        }
+        updateText(example);
       }
     });
 
@@ -0,0 +1,132 @@
+// Arena vs system-malloc benchmark for batch parsing.
+//
+// Models the lint-all-designs job: every input is parsed `--repeat` times
+// with a fresh parser, its tree walked once, and everything torn down.
+// The same loop runs with the default allocator and with an FdArena reset
+// after each document.
+//
+// Usage: fd-arena-bench [--repeat N] FILE...
+
+#include "tree-sitter-fd-arena.h"
+
+#include <tree_sitter/api.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+const TSLanguage *tree_sitter_fd(void);
+
+typedef struct {
+  char *data;
+  uint32_t length;
+} Document;
+
+static double now_seconds(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static Document read_file(const char *path) {
+  Document document = {0};
+  FILE *file = fopen(path, "rb");
+  if (!file) return document;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  rewind(file);
+  document.data = malloc(size > 0 ? (size_t)size : 1);
+  document.length = (uint32_t)fread(document.data, 1, (size_t)size, file);
+  fclose(file);
+  return document;
+}
+
+// Parse one document and visit every node, the way a lint pass would.
+static size_t parse_and_walk(const Document *document) {
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_fd());
+  TSTree *tree = ts_parser_parse_string(parser, NULL, document->data, document->length);
+
+  size_t nodes = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    nodes++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) goto done;
+    }
+  }
+done:
+  ts_tree_cursor_delete(&cursor);
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  return nodes;
+}
+
+static double run(const Document *documents, int count, int repeat, FdArena *arena,
+                  size_t *nodes, size_t *peak_arena_bytes) {
+  *nodes = 0;
+  double start = now_seconds();
+  for (int r = 0; r < repeat; r++) {
+    for (int i = 0; i < count; i++) {
+      if (arena) fd_arena_activate(arena);
+      *nodes += parse_and_walk(&documents[i]);
+      if (arena) {
+        fd_arena_activate(NULL);
+        size_t used = fd_arena_bytes_used(arena);
+        if (used > *peak_arena_bytes) *peak_arena_bytes = used;
+        fd_arena_reset(arena);
+      }
+    }
+  }
+  return now_seconds() - start;
+}
+
+int main(int argc, char **argv) {
+  int repeat = 200;
+  int first_file = 1;
+  if (argc > 2 && strcmp(argv[1], "--repeat") == 0) {
+    repeat = atoi(argv[2]);
+    first_file = 3;
+  }
+  if (first_file >= argc || repeat <= 0) {
+    fprintf(stderr, "usage: %s [--repeat N] FILE...\n", argv[0]);
+    return 2;
+  }
+
+  int count = argc - first_file;
+  Document *documents = calloc((size_t)count, sizeof(Document));
+  for (int i = 0; i < count; i++) {
+    documents[i] = read_file(argv[first_file + i]);
+    if (!documents[i].data) {
+      fprintf(stderr, "cannot read %s\n", argv[first_file + i]);
+      return 1;
+    }
+  }
+
+  size_t malloc_nodes = 0, arena_nodes = 0, peak = 0;
+  double malloc_seconds = run(documents, count, repeat, NULL, &malloc_nodes, &peak);
+
+  ts_set_allocator(fd_arena_malloc, fd_arena_calloc, fd_arena_realloc, fd_arena_free);
+  FdArena *arena = fd_arena_new(0);
+  double arena_seconds = run(documents, count, repeat, arena, &arena_nodes, &peak);
+  fd_arena_delete(arena);
+  ts_set_allocator(NULL, NULL, NULL, NULL);
+
+  double total = (double)count * repeat;
+  printf("%-14s %12s %12s\n", "allocator", "docs/s", "ms total");
+  printf("%-14s %12.0f %12.1f\n", "system malloc", total / malloc_seconds, malloc_seconds * 1e3);
+  printf("%-14s %12.0f %12.1f\n", "arena", total / arena_seconds, arena_seconds * 1e3);
+  printf("speedup %.2fx, peak arena bytes per document %zu\n", malloc_seconds / arena_seconds,
+         peak);
+
+  for (int i = 0; i < count; i++) free(documents[i].data);
+  free(documents);
+
+  if (malloc_nodes != arena_nodes) {
+    fprintf(stderr, "node count mismatch (%zu vs %zu)\n", malloc_nodes, arena_nodes);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,159 @@
+// Lexer-only microbenchmark for tree-sitter-fd.
+//
+// Drives `lex_fn` directly with an in-memory TSLexer (no tree-sitter
+// runtime needed) and compares the generated linear-scan ADVANCE_MAP
+// against the jump-table dispatch from src/advance_map.h. Both builds of
+// the parser are linked into this binary under different names by CMake.
+//
+// Usage: fd-lex-bench [--iterations N] FILE...
+
+#include "tree_sitter/parser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+const TSLanguage *tree_sitter_fd_linear_map(void);
+const TSLanguage *tree_sitter_fd_jump_table(void);
+
+typedef struct {
+  TSLexer base;
+  const char *input;
+  size_t length;
+  size_t position;
+  size_t token_end;
+} BenchLexer;
+
+static void bench_advance(TSLexer *lexer, bool skip) {
+  BenchLexer *self = (BenchLexer *)lexer;
+  if (self->position < self->length) self->position++;
+  if (skip) self->token_end = self->position;
+  lexer->lookahead =
+    self->position < self->length ? (unsigned char)self->input[self->position] : 0;
+}
+
+static void bench_mark_end(TSLexer *lexer) {
+  BenchLexer *self = (BenchLexer *)lexer;
+  self->token_end = self->position;
+}
+
+static uint32_t bench_get_column(TSLexer *lexer) {
+  (void)lexer;
+  return 0;
+}
+
+static bool bench_is_at_included_range_start(const TSLexer *lexer) {
+  (void)lexer;
+  return false;
+}
+
+static bool bench_eof(const TSLexer *lexer) {
+  const BenchLexer *self = (const BenchLexer *)lexer;
+  return self->position >= self->length;
+}
+
+// Tokenize `input` from the error lex state (which accepts every token),
+// restarting after each token. Unlexable bytes are skipped one at a time.
+// Returns a checksum over the (symbol, end offset) stream.
+static uint64_t lex_all(const TSLanguage *language, const char *input, size_t length) {
+  BenchLexer lexer = {
+    .base = {
+      .advance = bench_advance,
+      .mark_end = bench_mark_end,
+      .get_column = bench_get_column,
+      .is_at_included_range_start = bench_is_at_included_range_start,
+      .eof = bench_eof,
+    },
+    .input = input,
+    .length = length,
+  };
+  TSStateId start_state = language->lex_modes[0].lex_state;
+  uint64_t checksum = 0;
+
+  while (lexer.position < length) {
+    size_t token_start = lexer.position;
+    lexer.token_end = token_start;
+    lexer.base.lookahead = (unsigned char)input[token_start];
+    if (language->lex_fn(&lexer.base, start_state) && lexer.token_end > token_start) {
+      checksum = checksum * 31 + lexer.base.result_symbol;
+      checksum = checksum * 31 + lexer.token_end;
+      lexer.position = lexer.token_end;
+    } else {
+      lexer.position = token_start + 1;
+    }
+  }
+  return checksum;
+}
+
+static double now_seconds(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static char *read_file(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  rewind(file);
+  char *buffer = malloc(size > 0 ? (size_t)size : 1);
+  *length = fread(buffer, 1, (size_t)size, file);
+  fclose(file);
+  return buffer;
+}
+
+static uint64_t run(const TSLanguage *language, const char *input, size_t length,
+                    int iterations, double *mb_per_sec) {
+  uint64_t checksum = 0;
+  double start = now_seconds();
+  for (int i = 0; i < iterations; i++) {
+    checksum = lex_all(language, input, length);
+  }
+  double elapsed = now_seconds() - start;
+  *mb_per_sec = elapsed > 0 ? (double)length * iterations / elapsed / 1e6 : 0;
+  return checksum;
+}
+
+int main(int argc, char **argv) {
+  int iterations = 200;
+  int first_file = 1;
+  if (argc > 2 && strcmp(argv[1], "--iterations") == 0) {
+    iterations = atoi(argv[2]);
+    first_file = 3;
+  }
+  if (first_file >= argc || iterations <= 0) {
+    fprintf(stderr, "usage: %s [--iterations N] FILE...\n", argv[0]);
+    return 2;
+  }
+
+  printf("%-28s %10s %14s %14s %8s\n", "file", "bytes", "linear MB/s", "table MB/s", "speedup");
+
+  int status = 0;
+  for (int i = first_file; i < argc; i++) {
+    size_t length = 0;
+    char *input = read_file(argv[i], &length);
+    if (!input) {
+      fprintf(stderr, "cannot read %s\n", argv[i]);
+      return 1;
+    }
+
+    double linear = 0, table = 0;
+    uint64_t linear_sum = run(tree_sitter_fd_linear_map(), input, length, iterations, &linear);
+    uint64_t table_sum = run(tree_sitter_fd_jump_table(), input, length, iterations, &table);
+
+    const char *name = strrchr(argv[i], '/');
+    name = name ? name + 1 : argv[i];
+    printf("%-28s %10zu %14.1f %14.1f %7.2fx\n", name, length, linear, table,
+           linear > 0 ? table / linear : 0);
+
+    // Both dispatch modes must produce the same token stream.
+    if (linear_sum != table_sum) {
+      fprintf(stderr, "%s: token stream mismatch between dispatch modes\n", name);
+      status = 1;
+    }
+    free(input);
+  }
+  return status;
+}
@@ -0,0 +1,343 @@
+// Parse-throughput benchmark for tree-sitter-fd.
+//
+// Links the tree-sitter runtime and `tree_sitter_fd()` and reports, for
+// every input file and for synthetic documents built by replicating them:
+//
+//   - cold full-parse throughput (MB/s, best of N runs)
+//   - incremental reparse latency after single-character edits (µs)
+//   - peak bytes held by the runtime allocator during a full parse
+//
+// Thresholds turn it into a regression gate for grammar upgrades:
+//
+//   fd-parse-bench --min-mbps 20 --max-reparse-us 500
+//                  --synthetic 1,10,100 examples/benchmarks/*.fd
+
+#include <tree_sitter/api.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+const TSLanguage *tree_sitter_fd(void);
+
+// ─── Allocation tracking ──────────────────────────────────────
+
+// Every block carries its size in a max-aligned header so `free` and
+// `realloc` can keep the running total exact.
+typedef union {
+  size_t size;
+  max_align_t align;
+} AllocHeader;
+
+static size_t current_bytes;
+static size_t peak_bytes;
+
+static void track(size_t added, size_t removed) {
+  current_bytes = current_bytes + added - removed;
+  if (current_bytes > peak_bytes) peak_bytes = current_bytes;
+}
+
+static void *tracked_malloc(size_t size) {
+  AllocHeader *header = malloc(sizeof(AllocHeader) + size);
+  if (!header) return NULL;
+  header->size = size;
+  track(size, 0);
+  return header + 1;
+}
+
+static void *tracked_calloc(size_t count, size_t size) {
+  void *result = tracked_malloc(count * size);
+  if (result) memset(result, 0, count * size);
+  return result;
+}
+
+static void *tracked_realloc(void *ptr, size_t size) {
+  if (!ptr) return tracked_malloc(size);
+  AllocHeader *header = (AllocHeader *)ptr - 1;
+  size_t old_size = header->size;
+  header = realloc(header, sizeof(AllocHeader) + size);
+  if (!header) return NULL;
+  header->size = size;
+  track(size, old_size);
+  return header + 1;
+}
+
+static void tracked_free(void *ptr) {
+  if (!ptr) return;
+  AllocHeader *header = (AllocHeader *)ptr - 1;
+  track(0, header->size);
+  free(header);
+}
+
+// ─── Helpers ──────────────────────────────────────────────────
+
+typedef struct {
+  char *data;
+  size_t length;
+} Buffer;
+
+static double now_seconds(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static Buffer read_file(const char *path) {
+  Buffer buffer = {0};
+  FILE *file = fopen(path, "rb");
+  if (!file) return buffer;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  rewind(file);
+  buffer.data = malloc(size > 0 ? (size_t)size : 1);
+  buffer.length = fread(buffer.data, 1, (size_t)size, file);
+  fclose(file);
+  return buffer;
+}
+
+// Concatenate `sources` round-robin until the result reaches `target` bytes.
+// Each copy ends on a newline so top-level declarations stay well-formed.
+static Buffer replicate(const Buffer *sources, int count, size_t target) {
+  Buffer buffer = {malloc(target + 1), 0};
+  size_t total = 0;
+  for (int i = 0; i < count; i++) total += sources[i].length;
+  if (total == 0) return buffer;
+  for (int i = 0; buffer.length < target; i = (i + 1) % count) {
+    size_t chunk = sources[i].length;
+    if (chunk == 0) continue;
+    if (buffer.length + chunk + 1 > target) break;
+    memcpy(buffer.data + buffer.length, sources[i].data, chunk);
+    buffer.length += chunk;
+    buffer.data[buffer.length++] = '\n';
+  }
+  return buffer;
+}
+
+static TSPoint point_at(const char *data, uint32_t offset) {
+  TSPoint point = {0, 0};
+  for (uint32_t i = 0; i < offset; i++) {
+    if (data[i] == '\n') {
+      point.row++;
+      point.column = 0;
+    } else {
+      point.column++;
+    }
+  }
+  return point;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// ─── Measurements ─────────────────────────────────────────────
+
+typedef struct {
+  double mb_per_sec;
+  size_t peak_bytes;
+  bool has_error;
+  double reparse_p50_us;
+  double reparse_p99_us;
+} Result;
+
+static TSTree *parse(TSParser *parser, const TSTree *old_tree, const Buffer *input) {
+  return ts_parser_parse_string(parser, old_tree, input->data, (uint32_t)input->length);
+}
+
+static void measure_full_parse(TSParser *parser, const Buffer *input, int runs, Result *result) {
+  double best = 0;
+  for (int i = 0; i < runs; i++) {
+    ts_parser_reset(parser);
+    size_t baseline = current_bytes;
+    peak_bytes = current_bytes;
+
+    double start = now_seconds();
+    TSTree *tree = parse(parser, NULL, input);
+    double elapsed = now_seconds() - start;
+
+    if (peak_bytes - baseline > result->peak_bytes) result->peak_bytes = peak_bytes - baseline;
+    result->has_error = ts_node_has_error(ts_tree_root_node(tree));
+    ts_tree_delete(tree);
+
+    double mb_per_sec = elapsed > 0 ? (double)input->length / elapsed / 1e6 : 0;
+    if (mb_per_sec > best) best = mb_per_sec;
+  }
+  result->mb_per_sec = best;
+}
+
+// Insert a space next to existing whitespace at `edits` pseudo-random
+// offsets, reparsing incrementally after each one. Whitespace is an
+// extra in the grammar, so the document stays valid and every edit is a
+// genuine one-byte change the parser has to reconcile.
+static void measure_reparse(TSParser *parser, Buffer *input, int edits, Result *result) {
+  if (edits <= 0 || input->length == 0) return;
+
+  Buffer document = {malloc(input->length + (size_t)edits + 1), input->length};
+  memcpy(document.data, input->data, input->length);
+
+  ts_parser_reset(parser);
+  TSTree *tree = parse(parser, NULL, &document);
+  double *latencies = malloc(sizeof(double) * (size_t)edits);
+  uint64_t seed = 0x9E3779B97F4A7C15ull;
+  int done = 0;
+
+  for (int attempt = 0; done < edits && attempt < edits * 64; attempt++) {
+    seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    uint32_t offset = (uint32_t)((seed >> 33) % document.length);
+    if (document.data[offset] != ' ' && document.data[offset] != '\n') continue;
+
+    memmove(document.data + offset + 1, document.data + offset, document.length - offset);
+    document.data[offset] = ' ';
+    document.length++;
+
+    TSPoint start_point = point_at(document.data, offset);
+    TSInputEdit edit = {
+      .start_byte = offset,
+      .old_end_byte = offset,
+      .new_end_byte = offset + 1,
+      .start_point = start_point,
+      .old_end_point = start_point,
+      .new_end_point = {start_point.row, start_point.column + 1},
+    };
+    ts_tree_edit(tree, &edit);
+
+    double start = now_seconds();
+    TSTree *new_tree = parse(parser, tree, &document);
+    latencies[done++] = (now_seconds() - start) * 1e6;
+
+    ts_tree_delete(tree);
+    tree = new_tree;
+  }
+
+  if (done > 0) {
+    qsort(latencies, (size_t)done, sizeof(double), compare_doubles);
+    result->reparse_p50_us = latencies[done / 2];
+    result->reparse_p99_us = latencies[(done * 99) / 100];
+  }
+
+  ts_tree_delete(tree);
+  free(latencies);
+  free(document.data);
+}
+
+// ─── Main ─────────────────────────────────────────────────────
+
+typedef struct {
+  int runs;
+  int edits;
+  double min_mbps;
+  double max_reparse_us;
+} Options;
+
+static int report(const char *name, Buffer *input, TSParser *parser, const Options *options) {
+  Result result = {0};
+  measure_full_parse(parser, input, options->runs, &result);
+  measure_reparse(parser, input, options->edits, &result);
+
+  printf("%-28s %12zu %10.1f %12.1f %12.1f %12zu%s\n", name, input->length, result.mb_per_sec,
+         result.reparse_p50_us, result.reparse_p99_us, result.peak_bytes,
+         result.has_error ? "  (has ERROR nodes)" : "");
+
+  int status = 0;
+  if (options->min_mbps > 0 && result.mb_per_sec < options->min_mbps) {
+    fprintf(stderr, "%s: %.1f MB/s is below --min-mbps %.1f\n", name, result.mb_per_sec,
+            options->min_mbps);
+    status = 1;
+  }
+  if (options->max_reparse_us > 0 && result.reparse_p99_us > options->max_reparse_us) {
+    fprintf(stderr, "%s: p99 reparse %.1f us exceeds --max-reparse-us %.1f\n", name,
+            result.reparse_p99_us, options->max_reparse_us);
+    status = 1;
+  }
+  return status;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [--runs N] [--edits N] [--synthetic MB[,MB...]]\n"
+          "       [--min-mbps X] [--max-reparse-us X] FILE...\n",
+          program);
+}
+
+int main(int argc, char **argv) {
+  Options options = {.runs = 5, .edits = 100};
+  const char *synthetic = NULL;
+  int first_file = argc;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (strcmp(arg, "--runs") == 0 && has_value) {
+      options.runs = atoi(argv[++i]);
+    } else if (strcmp(arg, "--edits") == 0 && has_value) {
+      options.edits = atoi(argv[++i]);
+    } else if (strcmp(arg, "--synthetic") == 0 && has_value) {
+      synthetic = argv[++i];
+    } else if (strcmp(arg, "--min-mbps") == 0 && has_value) {
+      options.min_mbps = atof(argv[++i]);
+    } else if (strcmp(arg, "--max-reparse-us") == 0 && has_value) {
+      options.max_reparse_us = atof(argv[++i]);
+    } else if (arg[0] == '-') {
+      usage(argv[0]);
+      return 2;
+    } else {
+      first_file = i;
+      break;
+    }
+  }
+  if (first_file >= argc || options.runs <= 0) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  ts_set_allocator(tracked_malloc, tracked_calloc, tracked_realloc, tracked_free);
+
+  TSParser *parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, tree_sitter_fd())) {
+    fprintf(stderr, "tree-sitter runtime rejected the fd language (ABI mismatch)\n");
+    return 1;
+  }
+
+  int file_count = argc - first_file;
+  Buffer *files = calloc((size_t)file_count, sizeof(Buffer));
+  for (int i = 0; i < file_count; i++) {
+    files[i] = read_file(argv[first_file + i]);
+    if (!files[i].data) {
+      fprintf(stderr, "cannot read %s\n", argv[first_file + i]);
+      return 1;
+    }
+  }
+
+  printf("%-28s %12s %10s %12s %12s %12s\n", "input", "bytes", "MB/s", "reparse p50",
+         "reparse p99", "peak bytes");
+
+  int status = 0;
+  for (int i = 0; i < file_count; i++) {
+    const char *name = strrchr(argv[first_file + i], '/');
+    name = name ? name + 1 : argv[first_file + i];
+    status |= report(name, &files[i], parser, &options);
+  }
+
+  // Synthetic documents: "1,10,100" builds 1 MB, 10 MB and 100 MB inputs.
+  for (const char *cursor = synthetic; cursor && *cursor;) {
+    char *end = NULL;
+    long megabytes = strtol(cursor, &end, 10);
+    if (megabytes > 0) {
+      char name[32];
+      snprintf(name, sizeof(name), "synthetic-%ldMB", megabytes);
+      Buffer document = replicate(files, file_count, (size_t)megabytes * 1000 * 1000);
+      status |= report(name, &document, parser, &options);
+      free(document.data);
+    }
+    cursor = (end && *end == ',') ? end + 1 : NULL;
+  }
+
+  for (int i = 0; i < file_count; i++) free(files[i].data);
+  free(files);
+  ts_parser_delete(parser);
+  return status;
+}
@@ -0,0 +1,31 @@
+{
+  "targets": [
+    {
+      "target_name": "tree_sitter_fd_binding",
+      "dependencies": [
+        "<!(node -p \"require('node-addon-api').targets\"):node_addon_api_except"
+      ],
+      "include_dirs": [
+        "src"
+      ],
+      "sources": [
+        "bindings/node/binding.cc",
+        "src/parser_dispatch.c",
+        "src/scanner.c"
+      ],
+      "defines": [
+        "TREE_SITTER_FD_OPTIMIZE"
+      ],
+      "conditions": [
+        ["OS!='win'", {
+          "cflags_c": ["-std=c11", "-O2"],
+          "xcode_settings": {
+            "OTHER_CFLAGS": ["-std=c11", "-O2"]
+          }
+        }, {
+          "cflags_c": ["/std:c11", "/utf-8", "/O2"]
+        }]
+      ]
+    }
+  ]
+}
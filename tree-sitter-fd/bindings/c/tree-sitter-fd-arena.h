@@ -0,0 +1,69 @@
+#ifndef TREE_SITTER_FD_ARENA_H_
+#define TREE_SITTER_FD_ARENA_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bump/arena allocator for batch parsing of many .fd documents.
+ *
+ * Install the fd_arena_* allocation functions once with
+ * `ts_set_allocator` (with TREE_SITTER_REUSE_ALLOCATOR, the grammar's own
+ * allocations follow). Then activate an arena on the current thread around
+ * each document:
+ *
+ *   ts_set_allocator(fd_arena_malloc, fd_arena_calloc,
+ *                    fd_arena_realloc, fd_arena_free);
+ *   FdArena *arena = fd_arena_new(0);
+ *   for (each file) {
+ *     fd_arena_activate(arena);
+ *     TSParser *parser = ts_parser_new();
+ *     ... parse, query, lint ...
+ *     ts_tree_delete(tree);
+ *     ts_parser_delete(parser);
+ *     fd_arena_activate(NULL);
+ *     fd_arena_reset(arena);
+ *   }
+ *   fd_arena_delete(arena);
+ *
+ * While an arena is active, allocations are bump-allocated from it and
+ * `free` is a no-op; memory comes back all at once on `fd_arena_reset`.
+ * With no active arena the functions fall back to the system allocator,
+ * so objects created outside an arena behave normally.
+ *
+ * Every tree-sitter object allocated under an arena must be deleted (or
+ * abandoned) before that arena is reset. The active arena is per thread,
+ * so each worker thread can use its own.
+ */
+
+typedef struct FdArena FdArena;
+
+/// Create an arena that grows in chunks of `chunk_size` bytes (0 = 1 MiB).
+FdArena *fd_arena_new(size_t chunk_size);
+
+/// Free the arena and every block allocated from it.
+void fd_arena_delete(FdArena *arena);
+
+/// Release every block allocated from the arena, keeping its first chunk
+/// for reuse by the next document.
+void fd_arena_reset(FdArena *arena);
+
+/// Make `arena` the current thread's allocation target (NULL = system malloc).
+void fd_arena_activate(FdArena *arena);
+
+/// Bytes handed out since the last reset (including per-block headers).
+size_t fd_arena_bytes_used(const FdArena *arena);
+
+void *fd_arena_malloc(size_t size);
+void *fd_arena_calloc(size_t count, size_t size);
+void *fd_arena_realloc(void *ptr, size_t size);
+void fd_arena_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_FD_ARENA_H_
@@ -0,0 +1,9 @@
+// Loads the N-API prebuild from prebuilds/ (one binary serves every Node
+// and Electron version), falling back to a local node-gyp build.
+const root = require("path").join(__dirname, "..", "..");
+
+module.exports = require("node-gyp-build")(root);
+
+try {
+  module.exports.nodeTypeInfo = require("../../src/node-types.json");
+} catch (_) {}
@@ -0,0 +1,22 @@
+fn main() {
+    let src_dir = std::path::Path::new("src");
+
+    let mut c_config = cc::Build::new();
+    c_config
+        .std("c11")
+        .include(src_dir)
+        // Same profile as the CMake and node-gyp builds: tables and lexer
+        // at -O2 with the jump-table ADVANCE_MAP.
+        .define("TREE_SITTER_FD_OPTIMIZE", None)
+        .opt_level(2)
+        .warnings(false)
+        .file(src_dir.join("parser_dispatch.c"))
+        .file(src_dir.join("scanner.c"));
+
+    // parser_dispatch.c #includes parser.c and advance_map.h.
+    for file in ["parser_dispatch.c", "parser.c", "advance_map.h", "scanner.c"] {
+        println!("cargo:rerun-if-changed={}", src_dir.join(file).display());
+    }
+
+    c_config.compile("tree-sitter-fd");
+}
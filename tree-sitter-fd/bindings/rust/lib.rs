@@ -0,0 +1,58 @@
+//! Tree-sitter grammar for FD (Fast Draft) files.
+//!
+//! ```ignore
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&tree_sitter_fd::LANGUAGE.into())?;
+//! let tree = parser.parse("rect @box { w: 100 h: 50 }", None).unwrap();
+//! assert!(!tree.root_node().has_error());
+//! ```
+
+use tree_sitter_language::LanguageFn;
+
+unsafe extern "C" {
+    fn tree_sitter_fd() -> *const ();
+}
+
+/// The tree-sitter [`LanguageFn`] for this grammar.
+pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_fd) };
+
+/// The content of the [`node-types.json`] file for this grammar.
+///
+/// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers/6-static-node-types
+pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
+
+/// The syntax highlighting query for this grammar.
+pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
+
+/// The local-variable (definition/reference) query for this grammar.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
+
+/// The outline query: `@item` per symbol, with `@name` and `@context`.
+pub const OUTLINE_QUERY: &str = include_str!("../../queries/outline.scm");
+
+/// The folding query: one `@fold` per foldable block.
+pub const FOLDS_QUERY: &str = include_str!("../../queries/folds.scm");
+
+#[cfg(test)]
+mod tests {
+    #[test]
+    fn test_can_load_grammar() {
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(&super::LANGUAGE.into())
+            .expect("Error loading FD parser");
+    }
+
+    #[test]
+    fn test_queries_compile() {
+        let language = super::LANGUAGE.into();
+        for source in [
+            super::HIGHLIGHTS_QUERY,
+            super::LOCALS_QUERY,
+            super::OUTLINE_QUERY,
+            super::FOLDS_QUERY,
+        ] {
+            tree_sitter::Query::new(&language, source).expect("query should compile");
+        }
+    }
+}
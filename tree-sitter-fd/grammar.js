@@ -12,18 +12,41 @@ module.exports = grammar({
 
     extras: ($) => [/\s/, $.comment],
 
+    // Produced by src/scanner.c; keep the order in sync with its TokenType.
+    externals: ($) => [
+        $.property_name,
+        $.string, // double-quoted, backslash escapes, may span lines
+        $.spec_text,
+        $._error_sentinel,
+    ],
+
+    // Keywords are lexed as identifiers, then matched against the keyword
+    // table — keeps ts_lex from growing a DFA branch per keyword.
+    word: ($) => $.identifier,
+
     rules: {
         // ─── Document ────────────────────────────────────────────
         document: ($) =>
             repeat(
                 choice(
+                    $.import_declaration,
                     $.style_block,
                     $.node_declaration,
+                    $.edge_block,
                     $.constraint_line,
                     $.spec_block,
                 ),
             ),
 
+        // ─── Imports ─────────────────────────────────────────────
+        import_declaration: ($) =>
+            seq(
+                "import",
+                field("path", $.string),
+                "as",
+                field("namespace", $.identifier),
+            ),
+
         // ─── Comments ────────────────────────────────────────────
         comment: (_$) => token(prec(-1, seq("#", /[^#\n][^\n]*/))),
 
@@ -50,7 +73,8 @@ module.exports = grammar({
                 field("value", choice($.string, $.spec_text)),
             ),
 
-        spec_text: (_$) => /[^\n}]+/,
+        // `spec_text` runs to the end of the line. Balanced `{...}` inside
+        // it is prose; an unmatched `}` closes the spec block.
 
         spec_keyword: (_$) =>
             choice("accept", "status", "priority", "tag"),
@@ -67,16 +91,24 @@ module.exports = grammar({
 
         // ─── Node Declaration ────────────────────────────────────
         node_declaration: ($) =>
+            choice(
+                $._typed_node,
+                // Generic node: `@id { ... }` with no kind keyword
+                seq(field("id", $.node_id), $._node_body),
+            ),
+
+        _typed_node: ($) =>
             seq(
                 field("kind", $.node_kind),
                 optional(field("id", $.node_id)),
                 optional(field("inline_text", $.string)),
-                "{",
-                repeat($.node_body_item),
-                "}",
+                $._node_body,
             ),
 
-        node_kind: (_$) => choice("group", "rect", "ellipse", "path", "text"),
+        _node_body: ($) => seq("{", repeat($.node_body_item), "}"),
+
+        node_kind: (_$) =>
+            choice("group", "frame", "rect", "ellipse", "path", "text"),
 
         node_body_item: ($) =>
             choice(
@@ -86,35 +118,81 @@ module.exports = grammar({
                 $.spec_block,
             ),
 
+        // ─── Edge Block ──────────────────────────────────────────
+        edge_block: ($) =>
+            seq(
+                "edge",
+                optional(field("id", $.node_id)),
+                "{",
+                repeat(
+                    choice(
+                        alias($.edge_property, $.property),
+                        alias($._typed_node, $.node_declaration),
+                        $.anim_block,
+                        $.spec_block,
+                    ),
+                ),
+                "}",
+            ),
+
+        // Like `property`, but values may reference nodes (`from: @a`).
+        // Node bodies can't allow that: `@child {` after a value would be
+        // ambiguous with a generic child node.
+        edge_property: ($) =>
+            prec.right(seq(
+                field("name", $.property_name),
+                ":",
+                repeat1(choice($.node_id, $._value_item)),
+                optional(";"),
+            )),
+
         // ─── Properties ──────────────────────────────────────────
         property: ($) =>
             prec.right(seq(
                 field("name", $.property_name),
                 ":",
                 repeat1($._value_item),
+                optional(";"),
             )),
 
-        property_name: (_$) =>
-            choice(
-                "w", "h", "width", "height",
-                "fill", "stroke", "corner", "opacity",
-                "font", "bg", "use", "layout",
-                "shadow", "scale", "rotate", "translate",
-                "center_in", "offset", "ease", "duration",
-            ),
+        // `property_name` is any identifier immediately followed by `:`
+        // (see src/scanner.c). Deciding that in the scanner keeps
+        // `w: 200 h: 48` LR(1): by the time the parser sees `h` it already
+        // knows whether it is a value or the next property. New properties
+        // on the Rust side parse without touching the grammar; the known
+        // names are highlighted in queries/highlights.scm.
 
         _value_item: ($) =>
             choice(
                 $.number,
                 $.hex_color,
                 $.string,
-                $.node_id,
                 $.key_value_pair,
+                $.gradient,
+                $.tuple,
                 $.identifier,
+                ",",
             ),
 
         key_value_pair: ($) =>
-            prec(1, seq($.identifier, "=", choice($.number, $.hex_color, $.string, $.identifier))),
+            prec(1, seq(
+                field("key", $.identifier),
+                "=",
+                field("value", choice($.number, $.hex_color, $.string, $.identifier, $.tuple)),
+            )),
+
+        // linear(90deg, #HEX 0, #HEX 1) / radial(#HEX 0, #HEX 1)
+        gradient: ($) =>
+            seq(
+                field("function", $.identifier),
+                token.immediate("("),
+                repeat(choice($.number, $.hex_color, ",")),
+                ")",
+            ),
+
+        // (0,4,20,#0000001A)
+        tuple: ($) =>
+            seq("(", repeat(choice($.number, $.hex_color, ",")), ")"),
 
         // ─── When/Animation Block ────────────────────────────────
         anim_block: ($) =>
@@ -135,7 +213,8 @@ module.exports = grammar({
                 "->",
                 field("constraint_type", $.identifier),
                 ":",
-                repeat1($._value_item),
+                optional(field("reference", $.node_id)),
+                repeat($._value_item),
             )),
 
         // ─── Literals ────────────────────────────────────────────
@@ -143,10 +222,8 @@ module.exports = grammar({
 
         identifier: (_$) => /[a-zA-Z_][a-zA-Z0-9_]*/,
 
-        number: (_$) => /-?\d+(\.\d+)?(ms)?/,
+        number: (_$) => /-?\d+(\.\d+)?(ms|px|deg)?/,
 
         hex_color: (_$) => /#[0-9A-Fa-f]{3,8}/,
-
-        string: (_$) => seq('"', /[^"]*/, '"'),
     },
 });
@@ -0,0 +1,9 @@
+; FD (Fast Draft) — Tree-sitter folding queries
+
+[
+  (node_declaration)
+  (edge_block)
+  (style_block)
+  (anim_block)
+  (spec_block)
+] @fold
@@ -6,8 +6,17 @@
 
 ; ─── Keywords ──────────────────────────────────────────────
 (node_kind) @keyword
-"style" @keyword
-"anim" @keyword
+[
+  "style"
+  "theme"
+  "anim"
+  "when"
+  "edge"
+] @keyword
+[
+  "import"
+  "as"
+] @keyword.import
 
 ; ─── Node IDs ──────────────────────────────────────────────
 (node_id
@@ -17,6 +26,17 @@
 ; ─── Properties ────────────────────────────────────────────
 (property_name) @property
 
+; Names the Rust parser understands; anything else still parses.
+((property_name) @property.builtin
+  (#any-of? @property.builtin
+   "x" "y" "w" "h" "width" "height"
+   "fill" "background" "color" "bg" "stroke"
+   "corner" "rounded" "radius" "opacity"
+   "align" "text_align" "font" "label"
+   "use" "layout" "clip" "shadow"
+   "scale" "rotate" "translate" "ease" "duration"
+   "from" "to" "arrow" "curve" "flow" "label_offset"))
+
 ; ─── Spec Blocks ───────────────────────────────────────────
 "spec" @keyword
 (spec_keyword) @attribute
@@ -37,13 +57,26 @@
 (key_value_pair
   key: (identifier) @property)
 
+; ─── Gradients ─────────────────────────────────────────────
+(gradient
+  function: (identifier) @function.builtin)
+
+; ─── Imports and styles ────────────────────────────────────
+(import_declaration
+  namespace: (identifier) @module)
+(style_block
+  name: (identifier) @type)
+
 ; ─── Identifiers (layout modes, easing, etc.) ─────────────
-(property_value
+(property
   (identifier) @constant)
 
 ; ─── Punctuation ───────────────────────────────────────────
 "{" @punctuation.bracket
 "}" @punctuation.bracket
+"(" @punctuation.bracket
+")" @punctuation.bracket
 ":" @punctuation.delimiter
 "," @punctuation.delimiter
+";" @punctuation.delimiter
 "=" @operator
@@ -0,0 +1,34 @@
+; FD (Fast Draft) — Tree-sitter locals queries
+; Node IDs and style names are document-global.
+
+(document) @local.scope
+
+; ─── Definitions ───────────────────────────────────────────
+(node_declaration
+  id: (node_id (identifier) @local.definition))
+
+(edge_block
+  id: (node_id (identifier) @local.definition))
+
+(style_block
+  name: (identifier) @local.definition)
+
+(import_declaration
+  namespace: (identifier) @local.definition)
+
+; ─── References ────────────────────────────────────────────
+(constraint_line
+  target: (node_id (identifier) @local.reference))
+
+(constraint_line
+  reference: (node_id (identifier) @local.reference))
+
+; `from: @a`, `to: @b` in edges
+(property
+  (node_id (identifier) @local.reference))
+
+; `use: style_name`
+((property
+  name: (property_name) @_name
+  (identifier) @local.reference)
+  (#eq? @_name "use"))
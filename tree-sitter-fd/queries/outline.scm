@@ -0,0 +1,22 @@
+; FD (Fast Draft) — Tree-sitter outline queries
+; Symbols for document outlines and breadcrumbs (used by fd-lsp)
+
+; ─── Nodes ─────────────────────────────────────────────────
+(node_declaration
+  kind: (node_kind) @context
+  id: (node_id (identifier) @name)) @item
+
+; Generic `@id { }` nodes
+(node_declaration
+  !kind
+  id: (node_id (identifier) @name)) @item
+
+; ─── Edges ─────────────────────────────────────────────────
+(edge_block
+  "edge" @context
+  id: (node_id (identifier) @name)) @item
+
+; ─── Styles ────────────────────────────────────────────────
+(style_block
+  ["style" "theme"] @context
+  name: (identifier) @name) @item
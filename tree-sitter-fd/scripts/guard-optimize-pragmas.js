@@ -0,0 +1,34 @@
+#!/usr/bin/env node
+// @ts-check
+
+/**
+ * Post-generate step for src/parser.c.
+ *
+ * `tree-sitter generate` emits `optimize off` / `O0` pragmas at the top of
+ * parser.c for grammars with large lex tables. Wrap them in
+ * `#ifndef TREE_SITTER_FD_OPTIMIZE` so optimized builds (CMake,
+ * node-gyp, or `-DTREE_SITTER_FD_OPTIMIZE`) compile ts_lex and the parse
+ * tables at the requested -O level. Idempotent; a no-op when the
+ * generator did not emit the pragmas.
+ */
+const fs = require("fs");
+const path = require("path");
+
+const parserPath = process.argv[2] || path.join(__dirname, "..", "src", "parser.c");
+const source = fs.readFileSync(parserPath, "utf8");
+
+if (source.includes("#ifndef TREE_SITTER_FD_OPTIMIZE")) {
+    process.exit(0);
+}
+
+const pragmas =
+    /#ifdef _MSC_VER\n#pragma optimize\("", off\)\n(?:#elif [^\n]*\n#pragma [^\n]*\n)*#endif\n/;
+
+if (!pragmas.test(source)) {
+    process.exit(0);
+}
+
+fs.writeFileSync(
+    parserPath,
+    source.replace(pragmas, (block) => `#ifndef TREE_SITTER_FD_OPTIMIZE\n${block}#endif\n`),
+);
@@ -0,0 +1,114 @@
+#ifndef TREE_SITTER_FD_ADVANCE_MAP_H_
+#define TREE_SITTER_FD_ADVANCE_MAP_H_
+
+/*
+ * Jump-table ADVANCE_MAP for the fd lexer.
+ *
+ * The generated ADVANCE_MAP in tree_sitter/parser.h scans a static array of
+ * (char, state) pairs for every lookahead character. This replacement
+ * expands the same pairs into `case` labels of a `switch (lookahead)`, which
+ * the compiler lowers to a dense jump table: one bounds check and one
+ * indirect branch per character, no per-call-site init and no shared state,
+ * so it is safe for concurrent parsers.
+ *
+ * Include after tree_sitter/parser.h and before parser.c (see
+ * parser_dispatch.c). Supports up to 31 pairs per call site; the largest
+ * map in the current parser.c has 11.
+ */
+
+#include "tree_sitter/parser.h"
+
+#undef ADVANCE_MAP
+
+// MSVC's traditional preprocessor forwards __VA_ARGS__ as a single
+// argument unless it is rescanned.
+#define FD_AM_EXPAND(x) x
+
+#define FD_AM_CASE(c, s) \
+  case c:                \
+    state = s;           \
+    goto next_state;
+
+#define FD_AM_ARG_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, N, ...) N
+#define FD_AM_NARG(...) FD_AM_EXPAND(FD_AM_ARG_N(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+
+// The generator emits a trailing comma, so the last argument may be empty.
+#define FD_AM_0(...)
+#define FD_AM_1(...)
+#define FD_AM_2(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_0(__VA_ARGS__))
+#define FD_AM_3(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_1(__VA_ARGS__))
+#define FD_AM_4(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_2(__VA_ARGS__))
+#define FD_AM_5(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_3(__VA_ARGS__))
+#define FD_AM_6(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_4(__VA_ARGS__))
+#define FD_AM_7(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_5(__VA_ARGS__))
+#define FD_AM_8(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_6(__VA_ARGS__))
+#define FD_AM_9(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_7(__VA_ARGS__))
+#define FD_AM_10(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_8(__VA_ARGS__))
+#define FD_AM_11(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_9(__VA_ARGS__))
+#define FD_AM_12(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_10(__VA_ARGS__))
+#define FD_AM_13(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_11(__VA_ARGS__))
+#define FD_AM_14(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_12(__VA_ARGS__))
+#define FD_AM_15(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_13(__VA_ARGS__))
+#define FD_AM_16(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_14(__VA_ARGS__))
+#define FD_AM_17(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_15(__VA_ARGS__))
+#define FD_AM_18(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_16(__VA_ARGS__))
+#define FD_AM_19(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_17(__VA_ARGS__))
+#define FD_AM_20(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_18(__VA_ARGS__))
+#define FD_AM_21(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_19(__VA_ARGS__))
+#define FD_AM_22(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_20(__VA_ARGS__))
+#define FD_AM_23(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_21(__VA_ARGS__))
+#define FD_AM_24(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_22(__VA_ARGS__))
+#define FD_AM_25(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_23(__VA_ARGS__))
+#define FD_AM_26(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_24(__VA_ARGS__))
+#define FD_AM_27(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_25(__VA_ARGS__))
+#define FD_AM_28(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_26(__VA_ARGS__))
+#define FD_AM_29(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_27(__VA_ARGS__))
+#define FD_AM_30(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_28(__VA_ARGS__))
+#define FD_AM_31(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_29(__VA_ARGS__))
+#define FD_AM_32(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_30(__VA_ARGS__))
+#define FD_AM_33(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_31(__VA_ARGS__))
+#define FD_AM_34(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_32(__VA_ARGS__))
+#define FD_AM_35(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_33(__VA_ARGS__))
+#define FD_AM_36(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_34(__VA_ARGS__))
+#define FD_AM_37(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_35(__VA_ARGS__))
+#define FD_AM_38(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_36(__VA_ARGS__))
+#define FD_AM_39(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_37(__VA_ARGS__))
+#define FD_AM_40(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_38(__VA_ARGS__))
+#define FD_AM_41(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_39(__VA_ARGS__))
+#define FD_AM_42(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_40(__VA_ARGS__))
+#define FD_AM_43(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_41(__VA_ARGS__))
+#define FD_AM_44(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_42(__VA_ARGS__))
+#define FD_AM_45(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_43(__VA_ARGS__))
+#define FD_AM_46(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_44(__VA_ARGS__))
+#define FD_AM_47(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_45(__VA_ARGS__))
+#define FD_AM_48(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_46(__VA_ARGS__))
+#define FD_AM_49(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_47(__VA_ARGS__))
+#define FD_AM_50(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_48(__VA_ARGS__))
+#define FD_AM_51(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_49(__VA_ARGS__))
+#define FD_AM_52(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_50(__VA_ARGS__))
+#define FD_AM_53(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_51(__VA_ARGS__))
+#define FD_AM_54(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_52(__VA_ARGS__))
+#define FD_AM_55(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_53(__VA_ARGS__))
+#define FD_AM_56(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_54(__VA_ARGS__))
+#define FD_AM_57(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_55(__VA_ARGS__))
+#define FD_AM_58(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_56(__VA_ARGS__))
+#define FD_AM_59(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_57(__VA_ARGS__))
+#define FD_AM_60(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_58(__VA_ARGS__))
+#define FD_AM_61(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_59(__VA_ARGS__))
+#define FD_AM_62(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_60(__VA_ARGS__))
+#define FD_AM_63(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_61(__VA_ARGS__))
+#define FD_AM_64(c, s, ...) FD_AM_CASE(c, s) FD_AM_EXPAND(FD_AM_62(__VA_ARGS__))
+
+#define FD_AM_CAT(a, b) FD_AM_CAT_(a, b)
+#define FD_AM_CAT_(a, b) a##b
+
+#define ADVANCE_MAP(...)                                                    \
+  {                                                                         \
+    switch (lookahead) {                                                    \
+      FD_AM_EXPAND(FD_AM_CAT(FD_AM_, FD_AM_NARG(__VA_ARGS__))(__VA_ARGS__)) \
+      default:                                                              \
+        break;                                                              \
+    }                                                                       \
+  }
+
+#endif  // TREE_SITTER_FD_ADVANCE_MAP_H_
@@ -0,0 +1,195 @@
+// Bump/arena allocator for batch parsing; see bindings/c/tree-sitter-fd-arena.h.
+
+#include "../bindings/c/tree-sitter-fd-arena.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#define FD_THREAD_LOCAL __declspec(thread)
+#else
+#define FD_THREAD_LOCAL _Thread_local
+#endif
+
+#define FD_ARENA_DEFAULT_CHUNK_SIZE ((size_t)1 << 20)
+
+// Every block, arena or heap, is preceded by a header recording its size
+// and owner so `realloc`/`free` can tell the two apart without lookups.
+typedef union {
+  struct {
+    size_t size;
+    FdArena *owner; // NULL for blocks from the system allocator
+  } info;
+  max_align_t align;
+} BlockHeader;
+
+typedef union Chunk {
+  struct {
+    union Chunk *next;
+    size_t capacity;
+    size_t used;
+  } info;
+  max_align_t align;
+} Chunk;
+
+struct FdArena {
+  Chunk *head;  // chunk currently being bumped (newest)
+  Chunk *first; // oldest chunk, kept across resets
+  size_t chunk_size;
+  size_t bytes_used;
+  BlockHeader *last_block;
+};
+
+static FD_THREAD_LOCAL FdArena *current_arena;
+
+static size_t align_up(size_t size) {
+  const size_t alignment = sizeof(max_align_t);
+  return (size + alignment - 1) & ~(alignment - 1);
+}
+
+static char *chunk_data(Chunk *chunk) {
+  return (char *)(chunk + 1);
+}
+
+static Chunk *chunk_new(size_t capacity, Chunk *next) {
+  Chunk *chunk = malloc(sizeof(Chunk) + capacity);
+  if (!chunk) return NULL;
+  chunk->info.next = next;
+  chunk->info.capacity = capacity;
+  chunk->info.used = 0;
+  return chunk;
+}
+
+// ─── Lifecycle ────────────────────────────────────────────────
+
+FdArena *fd_arena_new(size_t chunk_size) {
+  FdArena *arena = calloc(1, sizeof(FdArena));
+  if (!arena) return NULL;
+  arena->chunk_size = align_up(chunk_size ? chunk_size : FD_ARENA_DEFAULT_CHUNK_SIZE);
+  arena->first = chunk_new(arena->chunk_size, NULL);
+  if (!arena->first) {
+    free(arena);
+    return NULL;
+  }
+  arena->head = arena->first;
+  return arena;
+}
+
+void fd_arena_delete(FdArena *arena) {
+  if (!arena) return;
+  if (current_arena == arena) current_arena = NULL;
+  Chunk *chunk = arena->head;
+  while (chunk) {
+    Chunk *next = chunk->info.next;
+    free(chunk);
+    chunk = next;
+  }
+  free(arena);
+}
+
+void fd_arena_reset(FdArena *arena) {
+  Chunk *chunk = arena->head;
+  while (chunk != arena->first) {
+    Chunk *next = chunk->info.next;
+    free(chunk);
+    chunk = next;
+  }
+  arena->first->info.used = 0;
+  arena->head = arena->first;
+  arena->bytes_used = 0;
+  arena->last_block = NULL;
+}
+
+void fd_arena_activate(FdArena *arena) {
+  current_arena = arena;
+}
+
+size_t fd_arena_bytes_used(const FdArena *arena) {
+  return arena->bytes_used;
+}
+
+// ─── Allocation ───────────────────────────────────────────────
+
+static void *arena_alloc(FdArena *arena, size_t size) {
+  size_t total = sizeof(BlockHeader) + align_up(size);
+  Chunk *chunk = arena->head;
+  if (chunk->info.used + total > chunk->info.capacity) {
+    size_t capacity = total > arena->chunk_size ? total : arena->chunk_size;
+    chunk = chunk_new(capacity, arena->head);
+    if (!chunk) return NULL;
+    arena->head = chunk;
+  }
+
+  BlockHeader *header = (BlockHeader *)(chunk_data(chunk) + chunk->info.used);
+  chunk->info.used += total;
+  arena->bytes_used += total;
+  arena->last_block = header;
+
+  header->info.size = size;
+  header->info.owner = arena;
+  return header + 1;
+}
+
+static void *heap_alloc(size_t size) {
+  BlockHeader *header = malloc(sizeof(BlockHeader) + size);
+  if (!header) return NULL;
+  header->info.size = size;
+  header->info.owner = NULL;
+  return header + 1;
+}
+
+void *fd_arena_malloc(size_t size) {
+  return current_arena ? arena_alloc(current_arena, size) : heap_alloc(size);
+}
+
+void *fd_arena_calloc(size_t count, size_t size) {
+  if (size && count > SIZE_MAX / size) return NULL;
+  void *result = fd_arena_malloc(count * size);
+  if (result) memset(result, 0, count * size);
+  return result;
+}
+
+void *fd_arena_realloc(void *ptr, size_t size) {
+  if (!ptr) return fd_arena_malloc(size);
+
+  BlockHeader *header = (BlockHeader *)ptr - 1;
+  FdArena *owner = header->info.owner;
+  size_t old_size = header->info.size;
+
+  if (!owner) {
+    header = realloc(header, sizeof(BlockHeader) + size);
+    if (!header) return NULL;
+    header->info.size = size;
+    return header + 1;
+  }
+
+  if (size <= old_size) {
+    header->info.size = size;
+    return ptr;
+  }
+
+  // Growing the most recent block (typical for stacks and child arrays)
+  // extends it in place when the chunk has room.
+  Chunk *chunk = owner->head;
+  if (owner == current_arena && header == owner->last_block) {
+    size_t extra = align_up(size) - align_up(old_size);
+    if (chunk->info.used + extra <= chunk->info.capacity) {
+      chunk->info.used += extra;
+      owner->bytes_used += extra;
+      header->info.size = size;
+      return ptr;
+    }
+  }
+
+  void *result = fd_arena_malloc(size);
+  if (result) memcpy(result, ptr, old_size);
+  return result;
+}
+
+void fd_arena_free(void *ptr) {
+  if (!ptr) return;
+  BlockHeader *header = (BlockHeader *)ptr - 1;
+  // Arena blocks are reclaimed in bulk by fd_arena_reset.
+  if (!header->info.owner) free(header);
+}
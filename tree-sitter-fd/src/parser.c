@@ -6,108 +6,98 @@
 #pragma GCC diagnostic ignored "-Wmissing-field-initializers"
 #endif
 
-#ifdef _MSC_VER
-#pragma optimize("", off)
-#elif defined(__clang__)
-#pragma clang optimize off
-#elif defined(__GNUC__)
-#pragma GCC optimize ("O0")
-#endif
-
-#define LANGUAGE_VERSION 15
-#define STATE_COUNT 99
-#define LARGE_STATE_COUNT 15
-#define SYMBOL_COUNT 71
+#define LANGUAGE_VERSION 14
+#define STATE_COUNT 135
+#define LARGE_STATE_COUNT 2
+#define SYMBOL_COUNT 69
 #define ALIAS_COUNT 0
-#define TOKEN_COUNT 48
-#define EXTERNAL_TOKEN_COUNT 0
-#define FIELD_COUNT 9
+#define TOKEN_COUNT 38
+#define EXTERNAL_TOKEN_COUNT 4
+#define FIELD_COUNT 13
 #define MAX_ALIAS_SEQUENCE_LENGTH 6
-#define MAX_RESERVED_WORD_SET_SIZE 0
-#define PRODUCTION_ID_COUNT 10
-#define SUPERTYPE_COUNT 0
+#define PRODUCTION_ID_COUNT 17
 
 enum ts_symbol_identifiers {
-  sym_comment = 1,
-  anon_sym_spec = 2,
-  anon_sym_LBRACE = 3,
-  anon_sym_RBRACE = 4,
-  anon_sym_COLON = 5,
-  sym_spec_text = 6,
-  anon_sym_accept = 7,
-  anon_sym_status = 8,
-  anon_sym_priority = 9,
-  anon_sym_tag = 10,
-  anon_sym_theme = 11,
-  anon_sym_style = 12,
-  anon_sym_group = 13,
-  anon_sym_rect = 14,
-  anon_sym_ellipse = 15,
-  anon_sym_path = 16,
-  anon_sym_text = 17,
-  anon_sym_w = 18,
-  anon_sym_h = 19,
-  anon_sym_width = 20,
-  anon_sym_height = 21,
-  anon_sym_fill = 22,
-  anon_sym_stroke = 23,
-  anon_sym_corner = 24,
-  anon_sym_opacity = 25,
-  anon_sym_font = 26,
-  anon_sym_bg = 27,
-  anon_sym_use = 28,
-  anon_sym_layout = 29,
-  anon_sym_shadow = 30,
-  anon_sym_scale = 31,
-  anon_sym_rotate = 32,
-  anon_sym_translate = 33,
-  anon_sym_center_in = 34,
-  anon_sym_offset = 35,
-  anon_sym_ease = 36,
-  anon_sym_duration = 37,
-  anon_sym_EQ = 38,
-  anon_sym_when = 39,
-  anon_sym_anim = 40,
-  anon_sym_DASH_GT = 41,
-  anon_sym_AT = 42,
-  sym_identifier = 43,
-  sym_number = 44,
-  sym_hex_color = 45,
-  anon_sym_DQUOTE = 46,
-  aux_sym_string_token1 = 47,
-  sym_document = 48,
-  sym_spec_block = 49,
-  sym_spec_item = 50,
-  sym_spec_typed = 51,
-  sym_spec_keyword = 52,
-  sym_style_block = 53,
-  sym_node_declaration = 54,
-  sym_node_kind = 55,
-  sym_node_body_item = 56,
-  sym_property = 57,
-  sym_property_name = 58,
-  sym__value_item = 59,
-  sym_key_value_pair = 60,
-  sym_anim_block = 61,
-  sym_anim_trigger = 62,
-  sym_constraint_line = 63,
-  sym_node_id = 64,
-  sym_string = 65,
-  aux_sym_document_repeat1 = 66,
-  aux_sym_spec_block_repeat1 = 67,
-  aux_sym_style_block_repeat1 = 68,
-  aux_sym_node_declaration_repeat1 = 69,
-  aux_sym_property_repeat1 = 70,
+  sym_identifier = 1,
+  anon_sym_import = 2,
+  anon_sym_as = 3,
+  sym_comment = 4,
+  anon_sym_spec = 5,
+  anon_sym_LBRACE = 6,
+  anon_sym_RBRACE = 7,
+  anon_sym_COLON = 8,
+  anon_sym_accept = 9,
+  anon_sym_status = 10,
+  anon_sym_priority = 11,
+  anon_sym_tag = 12,
+  anon_sym_theme = 13,
+  anon_sym_style = 14,
+  anon_sym_group = 15,
+  anon_sym_frame = 16,
+  anon_sym_rect = 17,
+  anon_sym_ellipse = 18,
+  anon_sym_path = 19,
+  anon_sym_text = 20,
+  anon_sym_edge = 21,
+  anon_sym_SEMI = 22,
+  anon_sym_COMMA = 23,
+  anon_sym_EQ = 24,
+  anon_sym_LPAREN = 25,
+  anon_sym_RPAREN = 26,
+  anon_sym_LPAREN2 = 27,
+  anon_sym_when = 28,
+  anon_sym_anim = 29,
+  anon_sym_DASH_GT = 30,
+  anon_sym_AT = 31,
+  sym_number = 32,
+  sym_hex_color = 33,
+  sym_property_name = 34,
+  sym_string = 35,
+  sym_spec_text = 36,
+  sym__error_sentinel = 37,
+  sym_document = 38,
+  sym_import_declaration = 39,
+  sym_spec_block = 40,
+  sym_spec_item = 41,
+  sym_spec_typed = 42,
+  sym_spec_keyword = 43,
+  sym_style_block = 44,
+  sym_node_declaration = 45,
+  sym__typed_node = 46,
+  sym__node_body = 47,
+  sym_node_kind = 48,
+  sym_node_body_item = 49,
+  sym_edge_block = 50,
+  sym_edge_property = 51,
+  sym_property = 52,
+  sym__value_item = 53,
+  sym_key_value_pair = 54,
+  sym_gradient = 55,
+  sym_tuple = 56,
+  sym_anim_block = 57,
+  sym_anim_trigger = 58,
+  sym_constraint_line = 59,
+  sym_node_id = 60,
+  aux_sym_document_repeat1 = 61,
+  aux_sym_spec_block_repeat1 = 62,
+  aux_sym_style_block_repeat1 = 63,
+  aux_sym__node_body_repeat1 = 64,
+  aux_sym_edge_block_repeat1 = 65,
+  aux_sym_edge_property_repeat1 = 66,
+  aux_sym_property_repeat1 = 67,
+  aux_sym_gradient_repeat1 = 68,
 };
 
 static const char * const ts_symbol_names[] = {
   [ts_builtin_sym_end] = "end",
+  [sym_identifier] = "identifier",
+  [anon_sym_import] = "import",
+  [anon_sym_as] = "as",
   [sym_comment] = "comment",
   [anon_sym_spec] = "spec",
   [anon_sym_LBRACE] = "{",
   [anon_sym_RBRACE] = "}",
   [anon_sym_COLON] = ":",
-  [sym_spec_text] = "spec_text",
   [anon_sym_accept] = "accept",
   [anon_sym_status] = "status",
   [anon_sym_priority] = "priority",
@@ -115,73 +105,71 @@ static const char * const ts_symbol_names[] = {
   [anon_sym_theme] = "theme",
   [anon_sym_style] = "style",
   [anon_sym_group] = "group",
+  [anon_sym_frame] = "frame",
   [anon_sym_rect] = "rect",
   [anon_sym_ellipse] = "ellipse",
   [anon_sym_path] = "path",
   [anon_sym_text] = "text",
-  [anon_sym_w] = "w",
-  [anon_sym_h] = "h",
-  [anon_sym_width] = "width",
-  [anon_sym_height] = "height",
-  [anon_sym_fill] = "fill",
-  [anon_sym_stroke] = "stroke",
-  [anon_sym_corner] = "corner",
-  [anon_sym_opacity] = "opacity",
-  [anon_sym_font] = "font",
-  [anon_sym_bg] = "bg",
-  [anon_sym_use] = "use",
-  [anon_sym_layout] = "layout",
-  [anon_sym_shadow] = "shadow",
-  [anon_sym_scale] = "scale",
-  [anon_sym_rotate] = "rotate",
-  [anon_sym_translate] = "translate",
-  [anon_sym_center_in] = "center_in",
-  [anon_sym_offset] = "offset",
-  [anon_sym_ease] = "ease",
-  [anon_sym_duration] = "duration",
+  [anon_sym_edge] = "edge",
+  [anon_sym_SEMI] = ";",
+  [anon_sym_COMMA] = ",",
   [anon_sym_EQ] = "=",
+  [anon_sym_LPAREN] = "(",
+  [anon_sym_RPAREN] = ")",
+  [anon_sym_LPAREN2] = "(",
   [anon_sym_when] = "when",
   [anon_sym_anim] = "anim",
   [anon_sym_DASH_GT] = "->",
   [anon_sym_AT] = "@",
-  [sym_identifier] = "identifier",
   [sym_number] = "number",
   [sym_hex_color] = "hex_color",
-  [anon_sym_DQUOTE] = "\"",
-  [aux_sym_string_token1] = "string_token1",
+  [sym_property_name] = "property_name",
+  [sym_string] = "string",
+  [sym_spec_text] = "spec_text",
+  [sym__error_sentinel] = "_error_sentinel",
   [sym_document] = "document",
+  [sym_import_declaration] = "import_declaration",
   [sym_spec_block] = "spec_block",
   [sym_spec_item] = "spec_item",
   [sym_spec_typed] = "spec_typed",
   [sym_spec_keyword] = "spec_keyword",
   [sym_style_block] = "style_block",
   [sym_node_declaration] = "node_declaration",
+  [sym__typed_node] = "_typed_node",
+  [sym__node_body] = "_node_body",
   [sym_node_kind] = "node_kind",
   [sym_node_body_item] = "node_body_item",
+  [sym_edge_block] = "edge_block",
+  [sym_edge_property] = "property",
   [sym_property] = "property",
-  [sym_property_name] = "property_name",
   [sym__value_item] = "_value_item",
   [sym_key_value_pair] = "key_value_pair",
+  [sym_gradient] = "gradient",
+  [sym_tuple] = "tuple",
   [sym_anim_block] = "anim_block",
   [sym_anim_trigger] = "anim_trigger",
   [sym_constraint_line] = "constraint_line",
   [sym_node_id] = "node_id",
-  [sym_string] = "string",
   [aux_sym_document_repeat1] = "document_repeat1",
   [aux_sym_spec_block_repeat1] = "spec_block_repeat1",
   [aux_sym_style_block_repeat1] = "style_block_repeat1",
-  [aux_sym_node_declaration_repeat1] = "node_declaration_repeat1",
+  [aux_sym__node_body_repeat1] = "_node_body_repeat1",
+  [aux_sym_edge_block_repeat1] = "edge_block_repeat1",
+  [aux_sym_edge_property_repeat1] = "edge_property_repeat1",
   [aux_sym_property_repeat1] = "property_repeat1",
+  [aux_sym_gradient_repeat1] = "gradient_repeat1",
 };
 
 static const TSSymbol ts_symbol_map[] = {
   [ts_builtin_sym_end] = ts_builtin_sym_end,
+  [sym_identifier] = sym_identifier,
+  [anon_sym_import] = anon_sym_import,
+  [anon_sym_as] = anon_sym_as,
   [sym_comment] = sym_comment,
   [anon_sym_spec] = anon_sym_spec,
   [anon_sym_LBRACE] = anon_sym_LBRACE,
   [anon_sym_RBRACE] = anon_sym_RBRACE,
   [anon_sym_COLON] = anon_sym_COLON,
-  [sym_spec_text] = sym_spec_text,
   [anon_sym_accept] = anon_sym_accept,
   [anon_sym_status] = anon_sym_status,
   [anon_sym_priority] = anon_sym_priority,
@@ -189,63 +177,59 @@ static const TSSymbol ts_symbol_map[] = {
   [anon_sym_theme] = anon_sym_theme,
   [anon_sym_style] = anon_sym_style,
   [anon_sym_group] = anon_sym_group,
+  [anon_sym_frame] = anon_sym_frame,
   [anon_sym_rect] = anon_sym_rect,
   [anon_sym_ellipse] = anon_sym_ellipse,
   [anon_sym_path] = anon_sym_path,
   [anon_sym_text] = anon_sym_text,
-  [anon_sym_w] = anon_sym_w,
-  [anon_sym_h] = anon_sym_h,
-  [anon_sym_width] = anon_sym_width,
-  [anon_sym_height] = anon_sym_height,
-  [anon_sym_fill] = anon_sym_fill,
-  [anon_sym_stroke] = anon_sym_stroke,
-  [anon_sym_corner] = anon_sym_corner,
-  [anon_sym_opacity] = anon_sym_opacity,
-  [anon_sym_font] = anon_sym_font,
-  [anon_sym_bg] = anon_sym_bg,
-  [anon_sym_use] = anon_sym_use,
-  [anon_sym_layout] = anon_sym_layout,
-  [anon_sym_shadow] = anon_sym_shadow,
-  [anon_sym_scale] = anon_sym_scale,
-  [anon_sym_rotate] = anon_sym_rotate,
-  [anon_sym_translate] = anon_sym_translate,
-  [anon_sym_center_in] = anon_sym_center_in,
-  [anon_sym_offset] = anon_sym_offset,
-  [anon_sym_ease] = anon_sym_ease,
-  [anon_sym_duration] = anon_sym_duration,
+  [anon_sym_edge] = anon_sym_edge,
+  [anon_sym_SEMI] = anon_sym_SEMI,
+  [anon_sym_COMMA] = anon_sym_COMMA,
   [anon_sym_EQ] = anon_sym_EQ,
+  [anon_sym_LPAREN] = anon_sym_LPAREN,
+  [anon_sym_RPAREN] = anon_sym_RPAREN,
+  [anon_sym_LPAREN2] = anon_sym_LPAREN,
   [anon_sym_when] = anon_sym_when,
   [anon_sym_anim] = anon_sym_anim,
   [anon_sym_DASH_GT] = anon_sym_DASH_GT,
   [anon_sym_AT] = anon_sym_AT,
-  [sym_identifier] = sym_identifier,
   [sym_number] = sym_number,
   [sym_hex_color] = sym_hex_color,
-  [anon_sym_DQUOTE] = anon_sym_DQUOTE,
-  [aux_sym_string_token1] = aux_sym_string_token1,
+  [sym_property_name] = sym_property_name,
+  [sym_string] = sym_string,
+  [sym_spec_text] = sym_spec_text,
+  [sym__error_sentinel] = sym__error_sentinel,
   [sym_document] = sym_document,
+  [sym_import_declaration] = sym_import_declaration,
   [sym_spec_block] = sym_spec_block,
   [sym_spec_item] = sym_spec_item,
   [sym_spec_typed] = sym_spec_typed,
   [sym_spec_keyword] = sym_spec_keyword,
   [sym_style_block] = sym_style_block,
   [sym_node_declaration] = sym_node_declaration,
+  [sym__typed_node] = sym__typed_node,
+  [sym__node_body] = sym__node_body,
   [sym_node_kind] = sym_node_kind,
   [sym_node_body_item] = sym_node_body_item,
+  [sym_edge_block] = sym_edge_block,
+  [sym_edge_property] = sym_property,
   [sym_property] = sym_property,
-  [sym_property_name] = sym_property_name,
   [sym__value_item] = sym__value_item,
   [sym_key_value_pair] = sym_key_value_pair,
+  [sym_gradient] = sym_gradient,
+  [sym_tuple] = sym_tuple,
   [sym_anim_block] = sym_anim_block,
   [sym_anim_trigger] = sym_anim_trigger,
   [sym_constraint_line] = sym_constraint_line,
   [sym_node_id] = sym_node_id,
-  [sym_string] = sym_string,
   [aux_sym_document_repeat1] = aux_sym_document_repeat1,
   [aux_sym_spec_block_repeat1] = aux_sym_spec_block_repeat1,
   [aux_sym_style_block_repeat1] = aux_sym_style_block_repeat1,
-  [aux_sym_node_declaration_repeat1] = aux_sym_node_declaration_repeat1,
+  [aux_sym__node_body_repeat1] = aux_sym__node_body_repeat1,
+  [aux_sym_edge_block_repeat1] = aux_sym_edge_block_repeat1,
+  [aux_sym_edge_property_repeat1] = aux_sym_edge_property_repeat1,
   [aux_sym_property_repeat1] = aux_sym_property_repeat1,
+  [aux_sym_gradient_repeat1] = aux_sym_gradient_repeat1,
 };
 
 static const TSSymbolMetadata ts_symbol_metadata[] = {
@@ -253,6 +237,18 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = true,
   },
+  [sym_identifier] = {
+    .visible = true,
+    .named = true,
+  },
+  [anon_sym_import] = {
+    .visible = true,
+    .named = false,
+  },
+  [anon_sym_as] = {
+    .visible = true,
+    .named = false,
+  },
   [sym_comment] = {
     .visible = true,
     .named = true,
@@ -273,10 +269,6 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
-  [sym_spec_text] = {
-    .visible = true,
-    .named = true,
-  },
   [anon_sym_accept] = {
     .visible = true,
     .named = false,
@@ -305,6 +297,10 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
+  [anon_sym_frame] = {
+    .visible = true,
+    .named = false,
+  },
   [anon_sym_rect] = {
     .visible = true,
     .named = false,
@@ -321,87 +317,31 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_w] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_h] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_width] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_height] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_fill] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_stroke] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_corner] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_opacity] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_font] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_bg] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_use] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_layout] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_shadow] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_scale] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_rotate] = {
+  [anon_sym_edge] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_translate] = {
+  [anon_sym_SEMI] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_center_in] = {
+  [anon_sym_COMMA] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_offset] = {
+  [anon_sym_EQ] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_ease] = {
+  [anon_sym_LPAREN] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_duration] = {
+  [anon_sym_RPAREN] = {
     .visible = true,
     .named = false,
   },
-  [anon_sym_EQ] = {
+  [anon_sym_LPAREN2] = {
     .visible = true,
     .named = false,
   },
@@ -421,30 +361,38 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = false,
   },
-  [sym_identifier] = {
+  [sym_number] = {
     .visible = true,
     .named = true,
   },
-  [sym_number] = {
+  [sym_hex_color] = {
     .visible = true,
     .named = true,
   },
-  [sym_hex_color] = {
+  [sym_property_name] = {
     .visible = true,
     .named = true,
   },
-  [anon_sym_DQUOTE] = {
+  [sym_string] = {
     .visible = true,
-    .named = false,
+    .named = true,
   },
-  [aux_sym_string_token1] = {
+  [sym_spec_text] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym__error_sentinel] = {
     .visible = false,
-    .named = false,
+    .named = true,
   },
   [sym_document] = {
     .visible = true,
     .named = true,
   },
+  [sym_import_declaration] = {
+    .visible = true,
+    .named = true,
+  },
   [sym_spec_block] = {
     .visible = true,
     .named = true,
@@ -469,6 +417,14 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym__typed_node] = {
+    .visible = false,
+    .named = true,
+  },
+  [sym__node_body] = {
+    .visible = false,
+    .named = true,
+  },
   [sym_node_kind] = {
     .visible = true,
     .named = true,
@@ -477,11 +433,15 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym_property] = {
+  [sym_edge_block] = {
     .visible = true,
     .named = true,
   },
-  [sym_property_name] = {
+  [sym_edge_property] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_property] = {
     .visible = true,
     .named = true,
   },
@@ -493,6 +453,14 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
+  [sym_gradient] = {
+    .visible = true,
+    .named = true,
+  },
+  [sym_tuple] = {
+    .visible = true,
+    .named = true,
+  },
   [sym_anim_block] = {
     .visible = true,
     .named = true,
@@ -509,10 +477,6 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = true,
     .named = true,
   },
-  [sym_string] = {
-    .visible = true,
-    .named = true,
-  },
   [aux_sym_document_repeat1] = {
     .visible = false,
     .named = false,
@@ -525,7 +489,15 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = false,
   },
-  [aux_sym_node_declaration_repeat1] = {
+  [aux_sym__node_body_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym_edge_block_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
+  [aux_sym_edge_property_repeat1] = {
     .visible = false,
     .named = false,
   },
@@ -533,77 +505,119 @@ static const TSSymbolMetadata ts_symbol_metadata[] = {
     .visible = false,
     .named = false,
   },
+  [aux_sym_gradient_repeat1] = {
+    .visible = false,
+    .named = false,
+  },
 };
 
 enum ts_field_identifiers {
   field_constraint_type = 1,
-  field_id = 2,
-  field_inline_text = 3,
-  field_key = 4,
-  field_kind = 5,
-  field_name = 6,
-  field_target = 7,
-  field_trigger = 8,
-  field_value = 9,
+  field_function = 2,
+  field_id = 3,
+  field_inline_text = 4,
+  field_key = 5,
+  field_kind = 6,
+  field_name = 7,
+  field_namespace = 8,
+  field_path = 9,
+  field_reference = 10,
+  field_target = 11,
+  field_trigger = 12,
+  field_value = 13,
 };
 
 static const char * const ts_field_names[] = {
   [0] = NULL,
   [field_constraint_type] = "constraint_type",
+  [field_function] = "function",
   [field_id] = "id",
   [field_inline_text] = "inline_text",
   [field_key] = "key",
   [field_kind] = "kind",
   [field_name] = "name",
+  [field_namespace] = "namespace",
+  [field_path] = "path",
+  [field_reference] = "reference",
   [field_target] = "target",
   [field_trigger] = "trigger",
   [field_value] = "value",
 };
 
 static const TSMapSlice ts_field_map_slices[PRODUCTION_ID_COUNT] = {
-  [1] = {.index = 0, .length = 1},
-  [2] = {.index = 1, .length = 1},
-  [3] = {.index = 2, .length = 2},
-  [4] = {.index = 4, .length = 2},
-  [5] = {.index = 6, .length = 2},
-  [6] = {.index = 8, .length = 1},
-  [7] = {.index = 9, .length = 3},
-  [8] = {.index = 12, .length = 2},
-  [9] = {.index = 14, .length = 1},
+  [1] = {.index = 0, .length = 3},
+  [2] = {.index = 3, .length = 1},
+  [3] = {.index = 4, .length = 1},
+  [4] = {.index = 0, .length = 3},
+  [5] = {.index = 5, .length = 2},
+  [6] = {.index = 7, .length = 2},
+  [7] = {.index = 9, .length = 2},
+  [8] = {.index = 11, .length = 1},
+  [9] = {.index = 12, .length = 1},
+  [10] = {.index = 13, .length = 3},
+  [11] = {.index = 16, .length = 2},
+  [12] = {.index = 18, .length = 2},
+  [13] = {.index = 20, .length = 1},
+  [14] = {.index = 21, .length = 3},
+  [15] = {.index = 24, .length = 1},
+  [16] = {.index = 25, .length = 1},
 };
 
 static const TSFieldMapEntry ts_field_map_entries[] = {
   [0] =
-    {field_kind, 0},
-  [1] =
-    {field_name, 1},
-  [2] =
-    {field_id, 1},
+    {field_id, 0, .inherited = true},
+    {field_inline_text, 0, .inherited = true},
+    {field_kind, 0, .inherited = true},
+  [3] =
     {field_kind, 0},
   [4] =
+    {field_id, 0},
+  [5] =
     {field_inline_text, 1},
     {field_kind, 0},
-  [6] =
-    {field_key, 0},
-    {field_value, 2},
-  [8] =
-    {field_name, 0},
+  [7] =
+    {field_id, 1},
+    {field_kind, 0},
   [9] =
+    {field_namespace, 3},
+    {field_path, 1},
+  [11] =
+    {field_name, 1},
+  [12] =
+    {field_id, 1},
+  [13] =
     {field_id, 1},
     {field_inline_text, 2},
     {field_kind, 0},
-  [12] =
+  [16] =
+    {field_constraint_type, 2},
+    {field_target, 0},
+  [18] =
+    {field_key, 0},
+    {field_value, 2},
+  [20] =
+    {field_name, 0},
+  [21] =
     {field_constraint_type, 2},
+    {field_reference, 4},
     {field_target, 0},
-  [14] =
+  [24] =
     {field_trigger, 1},
+  [25] =
+    {field_function, 0},
 };
 
 static const TSSymbol ts_alias_sequences[PRODUCTION_ID_COUNT][MAX_ALIAS_SEQUENCE_LENGTH] = {
   [0] = {0},
+  [4] = {
+    [0] = sym_node_declaration,
+  },
 };
 
 static const uint16_t ts_non_terminal_alias_map[] = {
+  sym__typed_node, 2,
+    sym__typed_node,
+    sym_node_declaration,
   0,
 };
 
@@ -618,95 +632,131 @@ static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
   [7] = 7,
   [8] = 8,
   [9] = 9,
-  [10] = 10,
+  [10] = 8,
   [11] = 11,
   [12] = 12,
   [13] = 13,
   [14] = 14,
   [15] = 15,
-  [16] = 2,
-  [17] = 17,
-  [18] = 18,
-  [19] = 19,
+  [16] = 16,
+  [17] = 16,
+  [18] = 13,
+  [19] = 14,
   [20] = 20,
   [21] = 21,
   [22] = 22,
   [23] = 23,
   [24] = 24,
-  [25] = 25,
-  [26] = 26,
-  [27] = 27,
-  [28] = 28,
-  [29] = 3,
-  [30] = 4,
-  [31] = 31,
+  [25] = 20,
+  [26] = 21,
+  [27] = 22,
+  [28] = 23,
+  [29] = 24,
+  [30] = 30,
+  [31] = 30,
   [32] = 32,
   [33] = 33,
-  [34] = 14,
-  [35] = 2,
-  [36] = 17,
-  [37] = 15,
+  [34] = 34,
+  [35] = 35,
+  [36] = 36,
+  [37] = 37,
   [38] = 38,
   [39] = 39,
   [40] = 40,
   [41] = 41,
   [42] = 42,
   [43] = 43,
-  [44] = 4,
+  [44] = 44,
   [45] = 45,
   [46] = 46,
-  [47] = 14,
-  [48] = 17,
-  [49] = 15,
-  [50] = 2,
+  [47] = 47,
+  [48] = 48,
+  [49] = 49,
+  [50] = 50,
   [51] = 51,
   [52] = 52,
   [53] = 53,
   [54] = 54,
   [55] = 55,
-  [56] = 54,
+  [56] = 56,
   [57] = 57,
   [58] = 58,
   [59] = 59,
-  [60] = 60,
-  [61] = 61,
-  [62] = 62,
-  [63] = 61,
-  [64] = 61,
-  [65] = 17,
-  [66] = 66,
-  [67] = 67,
-  [68] = 68,
-  [69] = 69,
-  [70] = 70,
+  [60] = 37,
+  [61] = 38,
+  [62] = 39,
+  [63] = 40,
+  [64] = 41,
+  [65] = 43,
+  [66] = 44,
+  [67] = 45,
+  [68] = 47,
+  [69] = 52,
+  [70] = 53,
   [71] = 71,
   [72] = 72,
   [73] = 73,
   [74] = 74,
   [75] = 75,
   [76] = 76,
-  [77] = 77,
-  [78] = 78,
+  [77] = 74,
+  [78] = 75,
   [79] = 79,
   [80] = 80,
   [81] = 81,
-  [82] = 82,
+  [82] = 81,
   [83] = 83,
   [84] = 84,
   [85] = 85,
-  [86] = 71,
-  [87] = 84,
+  [86] = 86,
+  [87] = 87,
   [88] = 88,
-  [89] = 89,
-  [90] = 71,
-  [91] = 84,
-  [92] = 92,
-  [93] = 71,
-  [94] = 84,
-  [95] = 89,
-  [96] = 92,
-  [97] = 89,
-  [98] = 89,
+  [89] = 83,
+  [90] = 84,
+  [91] = 85,
+  [92] = 86,
+  [93] = 88,
+  [94] = 94,
+  [95] = 95,
+  [96] = 96,
+  [97] = 97,
+  [98] = 98,
+  [99] = 99,
+  [100] = 100,
+  [101] = 101,
+  [102] = 102,
+  [103] = 102,
+  [104] = 104,
+  [105] = 30,
+  [106] = 106,
+  [107] = 107,
+  [108] = 108,
+  [109] = 109,
+  [110] = 110,
+  [111] = 30,
+  [112] = 104,
+  [113] = 106,
+  [114] = 109,
+  [115] = 115,
+  [116] = 116,
+  [117] = 117,
+  [118] = 118,
+  [119] = 119,
+  [120] = 120,
+  [121] = 121,
+  [122] = 122,
+  [123] = 123,
+  [124] = 124,
+  [125] = 125,
+  [126] = 126,
+  [127] = 127,
+  [128] = 128,
+  [129] = 129,
+  [130] = 130,
+  [131] = 131,
+  [132] = 117,
+  [133] = 117,
+  [134] = 117,
 };
 
 static bool ts_lex(TSLexer *lexer, TSStateId state) {
@@ -714,2290 +764,652 @@ static bool ts_lex(TSLexer *lexer, TSStateId state) {
   eof = lexer->eof(lexer);
   switch (state) {
     case 0:
-      if (eof) ADVANCE(134);
+      if (eof) ADVANCE(14);
       ADVANCE_MAP(
-        '"', 359,
-        '#', 130,
-        '-', 7,
-        ':', 142,
-        '=', 209,
-        '@', 215,
-        'a', 231,
-        'b', 264,
-        'c', 241,
-        'd', 339,
-        'e', 227,
-        'f', 271,
-        'g', 308,
-        'h', 171,
-        'l', 217,
-        'o', 262,
-        'p', 218,
-        'r', 254,
-        's', 233,
-        't', 220,
-        'u', 317,
-        'w', 168,
-        '{', 140,
-        '}', 141,
+        '#', 9,
+        '(', 24,
+        ')', 25,
+        ',', 22,
+        '-', 2,
+        ':', 20,
+        ';', 21,
+        '=', 23,
+        '@', 28,
+        '{', 18,
+        '}', 19,
       );
       if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(0);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
+          lookahead == ' ') SKIP(11);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
       if (('A' <= lookahead && lookahead <= 'Z') ||
           lookahead == '_' ||
-          ('i' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(29);
       END_STATE();
     case 1:
-      if (lookahead == '\n') SKIP(1);
-      if (lookahead == '"') ADVANCE(360);
-      if (lookahead == '#') ADVANCE(144);
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') ADVANCE(143);
-      if (lookahead != 0 &&
-          lookahead != '}') ADVANCE(145);
+      if (lookahead == '>') ADVANCE(27);
       END_STATE();
     case 2:
-      ADVANCE_MAP(
-        '"', 359,
-        '#', 130,
-        '-', 128,
-        '=', 209,
-        '@', 215,
-        'a', 289,
-        'b', 264,
-        'c', 241,
-        'd', 339,
-        'e', 227,
-        'f', 271,
-        'g', 308,
-        'h', 171,
-        'l', 217,
-        'o', 262,
-        'p', 219,
-        'r', 254,
-        's', 234,
-        't', 243,
-        'u', 317,
-        'w', 168,
-        '}', 141,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(2);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('i' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+      if (lookahead == '>') ADVANCE(27);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
       END_STATE();
     case 3:
-      ADVANCE_MAP(
-        '"', 359,
-        '#', 130,
-        '-', 128,
-        '=', 209,
-        '@', 215,
-        'b', 264,
-        'c', 241,
-        'd', 339,
-        'e', 228,
-        'f', 271,
-        'h', 171,
-        'l', 217,
-        'o', 262,
-        'r', 300,
-        's', 235,
-        't', 313,
-        'u', 317,
-        'w', 170,
-        '}', 141,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(3);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+      if (lookahead == 'e') ADVANCE(4);
       END_STATE();
     case 4:
-      if (lookahead == '"') ADVANCE(359);
-      if (lookahead == '#') ADVANCE(130);
-      if (lookahead == '-') ADVANCE(128);
-      if (lookahead == '@') ADVANCE(215);
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(4);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+      if (lookahead == 'g') ADVANCE(30);
       END_STATE();
     case 5:
-      if (lookahead == '#') ADVANCE(131);
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(5);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+      if (lookahead == 's') ADVANCE(30);
       END_STATE();
     case 6:
-      if (lookahead == '>') ADVANCE(214);
+      if (lookahead == 'x') ADVANCE(30);
       END_STATE();
     case 7:
-      if (lookahead == '>') ADVANCE(214);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
       END_STATE();
     case 8:
-      if (lookahead == '_') ADVANCE(61);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(32);
       END_STATE();
     case 9:
-      if (lookahead == 'a') ADVANCE(127);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(16);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '#') ADVANCE(17);
       END_STATE();
     case 10:
-      if (lookahead == 'a') ADVANCE(102);
-      if (lookahead == 'r') ADVANCE(57);
+      if (lookahead != 0 &&
+          lookahead != '\n' &&
+          lookahead != '#') ADVANCE(17);
       END_STATE();
     case 11:
-      if (lookahead == 'a') ADVANCE(50);
-      if (lookahead == 'e') ADVANCE(124);
-      if (lookahead == 'h') ADVANCE(41);
-      if (lookahead == 'r') ADVANCE(14);
+      if (eof) ADVANCE(14);
+      ADVANCE_MAP(
+        '#', 9,
+        '(', 26,
+        ')', 25,
+        ',', 22,
+        '-', 2,
+        ':', 20,
+        ';', 21,
+        '=', 23,
+        '@', 28,
+        '{', 18,
+        '}', 19,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(11);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(29);
       END_STATE();
     case 12:
-      if (lookahead == 'a') ADVANCE(27);
+      if (eof) ADVANCE(14);
+      if (lookahead == '#') ADVANCE(9);
+      if (lookahead == '(') ADVANCE(26);
+      if (lookahead == ',') ADVANCE(22);
+      if (lookahead == '-') ADVANCE(7);
+      if (lookahead == ';') ADVANCE(21);
+      if (lookahead == '@') ADVANCE(28);
+      if (lookahead == '}') ADVANCE(19);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(12);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(29);
       END_STATE();
     case 13:
-      if (lookahead == 'a') ADVANCE(24);
+      if (eof) ADVANCE(14);
+      if (lookahead == '#') ADVANCE(10);
+      if (lookahead == '-') ADVANCE(1);
+      if (lookahead == ':') ADVANCE(20);
+      if (lookahead == '@') ADVANCE(28);
+      if (lookahead == '{') ADVANCE(18);
+      if (lookahead == '}') ADVANCE(19);
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(13);
+      if (('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(29);
       END_STATE();
     case 14:
-      if (lookahead == 'a') ADVANCE(76);
+      ACCEPT_TOKEN(ts_builtin_sym_end);
       END_STATE();
     case 15:
-      if (lookahead == 'a') ADVANCE(68);
+      ACCEPT_TOKEN(sym_comment);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(38);
+      if (lookahead != 0 &&
+          lookahead != '\n') ADVANCE(17);
       END_STATE();
     case 16:
-      if (lookahead == 'a') ADVANCE(113);
-      if (lookahead == 'r') ADVANCE(80);
-      if (lookahead == 'y') ADVANCE(69);
+      ACCEPT_TOKEN(sym_comment);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(15);
+      if (lookahead != 0 &&
+          lookahead != '\n') ADVANCE(17);
       END_STATE();
     case 17:
-      if (lookahead == 'a') ADVANCE(114);
+      ACCEPT_TOKEN(sym_comment);
+      if (lookahead != 0 &&
+          lookahead != '\n') ADVANCE(17);
       END_STATE();
     case 18:
-      if (lookahead == 'a') ADVANCE(99);
-      if (lookahead == 'l') ADVANCE(67);
+      ACCEPT_TOKEN(anon_sym_LBRACE);
       END_STATE();
     case 19:
-      if (lookahead == 'a') ADVANCE(117);
+      ACCEPT_TOKEN(anon_sym_RBRACE);
       END_STATE();
     case 20:
-      if (lookahead == 'a') ADVANCE(118);
+      ACCEPT_TOKEN(anon_sym_COLON);
       END_STATE();
     case 21:
-      if (lookahead == 'c') ADVANCE(26);
-      if (lookahead == 'n') ADVANCE(55);
+      ACCEPT_TOKEN(anon_sym_SEMI);
       END_STATE();
     case 22:
-      if (lookahead == 'c') ADVANCE(138);
+      ACCEPT_TOKEN(anon_sym_COMMA);
       END_STATE();
     case 23:
-      if (lookahead == 'c') ADVANCE(15);
-      if (lookahead == 'h') ADVANCE(12);
-      if (lookahead == 'p') ADVANCE(42);
-      if (lookahead == 't') ADVANCE(16);
+      ACCEPT_TOKEN(anon_sym_EQ);
       END_STATE();
     case 24:
-      if (lookahead == 'c') ADVANCE(62);
+      ACCEPT_TOKEN(anon_sym_LPAREN);
       END_STATE();
     case 25:
-      if (lookahead == 'c') ADVANCE(104);
+      ACCEPT_TOKEN(anon_sym_RPAREN);
       END_STATE();
     case 26:
-      if (lookahead == 'c') ADVANCE(31);
+      ACCEPT_TOKEN(anon_sym_LPAREN2);
       END_STATE();
     case 27:
-      if (lookahead == 'd') ADVANCE(81);
+      ACCEPT_TOKEN(anon_sym_DASH_GT);
       END_STATE();
     case 28:
-      if (lookahead == 'd') ADVANCE(112);
+      ACCEPT_TOKEN(anon_sym_AT);
       END_STATE();
     case 29:
-      if (lookahead == 'e') ADVANCE(77);
-      if (lookahead == 'o') ADVANCE(92);
+      ACCEPT_TOKEN(sym_identifier);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'Z') ||
+          lookahead == '_' ||
+          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(29);
       END_STATE();
     case 30:
-      if (lookahead == 'e') ADVANCE(189);
+      ACCEPT_TOKEN(sym_number);
       END_STATE();
     case 31:
-      if (lookahead == 'e') ADVANCE(87);
+      ACCEPT_TOKEN(sym_number);
+      if (lookahead == '.') ADVANCE(8);
+      if (lookahead == 'd') ADVANCE(3);
+      if (lookahead == 'm') ADVANCE(5);
+      if (lookahead == 'p') ADVANCE(6);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(31);
       END_STATE();
     case 32:
-      if (lookahead == 'e') ADVANCE(205);
+      ACCEPT_TOKEN(sym_number);
+      if (lookahead == 'd') ADVANCE(3);
+      if (lookahead == 'm') ADVANCE(5);
+      if (lookahead == 'p') ADVANCE(6);
+      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(32);
       END_STATE();
     case 33:
-      if (lookahead == 'e') ADVANCE(195);
+      ACCEPT_TOKEN(sym_hex_color);
       END_STATE();
     case 34:
-      if (lookahead == 'e') ADVANCE(156);
+      ACCEPT_TOKEN(sym_hex_color);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(33);
       END_STATE();
     case 35:
-      if (lookahead == 'e') ADVANCE(154);
+      ACCEPT_TOKEN(sym_hex_color);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(34);
       END_STATE();
     case 36:
-      if (lookahead == 'e') ADVANCE(197);
+      ACCEPT_TOKEN(sym_hex_color);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(35);
       END_STATE();
     case 37:
-      if (lookahead == 'e') ADVANCE(179);
+      ACCEPT_TOKEN(sym_hex_color);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(36);
       END_STATE();
     case 38:
-      if (lookahead == 'e') ADVANCE(162);
+      ACCEPT_TOKEN(sym_hex_color);
+      if (('0' <= lookahead && lookahead <= '9') ||
+          ('A' <= lookahead && lookahead <= 'F') ||
+          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(37);
       END_STATE();
-    case 39:
-      if (lookahead == 'e') ADVANCE(199);
+    default:
+      return false;
+  }
+}
+
+static bool ts_lex_keywords(TSLexer *lexer, TSStateId state) {
+  START_LEXER();
+  eof = lexer->eof(lexer);
+  switch (state) {
+    case 0:
+      ADVANCE_MAP(
+        'a', 1,
+        'e', 2,
+        'f', 3,
+        'g', 4,
+        'i', 5,
+        'p', 6,
+        'r', 7,
+        's', 8,
+        't', 9,
+        'w', 10,
+      );
+      if (('\t' <= lookahead && lookahead <= '\r') ||
+          lookahead == ' ') SKIP(0);
       END_STATE();
-    case 40:
-      if (lookahead == 'e') ADVANCE(25);
-      if (lookahead == 'o') ADVANCE(115);
+    case 1:
+      if (lookahead == 'c') ADVANCE(11);
+      if (lookahead == 'n') ADVANCE(12);
+      if (lookahead == 's') ADVANCE(13);
       END_STATE();
-    case 41:
-      if (lookahead == 'e') ADVANCE(72);
+    case 2:
+      if (lookahead == 'd') ADVANCE(14);
+      if (lookahead == 'l') ADVANCE(15);
       END_STATE();
-    case 42:
-      if (lookahead == 'e') ADVANCE(22);
+    case 3:
+      if (lookahead == 'r') ADVANCE(16);
       END_STATE();
-    case 43:
-      if (lookahead == 'e') ADVANCE(73);
+    case 4:
+      if (lookahead == 'r') ADVANCE(17);
       END_STATE();
-    case 44:
-      if (lookahead == 'e') ADVANCE(90);
+    case 5:
+      if (lookahead == 'm') ADVANCE(18);
       END_STATE();
-    case 45:
-      if (lookahead == 'e') ADVANCE(91);
+    case 6:
+      if (lookahead == 'a') ADVANCE(19);
+      if (lookahead == 'r') ADVANCE(20);
       END_STATE();
-    case 46:
-      if (lookahead == 'e') ADVANCE(109);
+    case 7:
+      if (lookahead == 'e') ADVANCE(21);
       END_STATE();
-    case 47:
-      if (lookahead == 'f') ADVANCE(48);
-      if (lookahead == 'p') ADVANCE(13);
+    case 8:
+      if (lookahead == 'p') ADVANCE(22);
+      if (lookahead == 't') ADVANCE(23);
       END_STATE();
-    case 48:
-      if (lookahead == 'f') ADVANCE(100);
-      END_STATE();
-    case 49:
-      if (lookahead == 'g') ADVANCE(187);
-      END_STATE();
-    case 50:
-      if (lookahead == 'g') ADVANCE(152);
-      END_STATE();
-    case 51:
-      if (lookahead == 'g') ADVANCE(54);
-      END_STATE();
-    case 52:
-      if (lookahead == 'h') ADVANCE(164);
-      END_STATE();
-    case 53:
-      if (lookahead == 'h') ADVANCE(173);
-      END_STATE();
-    case 54:
-      if (lookahead == 'h') ADVANCE(107);
-      END_STATE();
-    case 55:
-      if (lookahead == 'i') ADVANCE(71);
-      END_STATE();
-    case 56:
-      if (lookahead == 'i') ADVANCE(66);
-      if (lookahead == 'o') ADVANCE(78);
-      END_STATE();
-    case 57:
-      if (lookahead == 'i') ADVANCE(84);
-      END_STATE();
-    case 58:
-      if (lookahead == 'i') ADVANCE(88);
-      END_STATE();
-    case 59:
-      if (lookahead == 'i') ADVANCE(51);
-      END_STATE();
-    case 60:
-      if (lookahead == 'i') ADVANCE(85);
-      END_STATE();
-    case 61:
-      if (lookahead == 'i') ADVANCE(75);
-      END_STATE();
-    case 62:
-      if (lookahead == 'i') ADVANCE(110);
-      END_STATE();
-    case 63:
-      if (lookahead == 'i') ADVANCE(111);
-      END_STATE();
-    case 64:
-      if (lookahead == 'k') ADVANCE(37);
-      END_STATE();
-    case 65:
-      if (lookahead == 'l') ADVANCE(177);
-      END_STATE();
-    case 66:
-      if (lookahead == 'l') ADVANCE(65);
-      END_STATE();
-    case 67:
-      if (lookahead == 'l') ADVANCE(58);
-      END_STATE();
-    case 68:
-      if (lookahead == 'l') ADVANCE(33);
-      END_STATE();
-    case 69:
-      if (lookahead == 'l') ADVANCE(34);
-      END_STATE();
-    case 70:
-      if (lookahead == 'l') ADVANCE(20);
-      END_STATE();
-    case 71:
-      if (lookahead == 'm') ADVANCE(212);
-      END_STATE();
-    case 72:
-      if (lookahead == 'm') ADVANCE(35);
-      END_STATE();
-    case 73:
-      if (lookahead == 'n') ADVANCE(210);
-      END_STATE();
-    case 74:
-      if (lookahead == 'n') ADVANCE(207);
-      END_STATE();
-    case 75:
-      if (lookahead == 'n') ADVANCE(201);
-      END_STATE();
-    case 76:
-      if (lookahead == 'n') ADVANCE(98);
-      END_STATE();
-    case 77:
-      if (lookahead == 'n') ADVANCE(116);
-      END_STATE();
-    case 78:
-      if (lookahead == 'n') ADVANCE(103);
-      END_STATE();
-    case 79:
-      if (lookahead == 'n') ADVANCE(45);
-      END_STATE();
-    case 80:
-      if (lookahead == 'o') ADVANCE(64);
-      END_STATE();
-    case 81:
-      if (lookahead == 'o') ADVANCE(123);
-      END_STATE();
-    case 82:
-      if (lookahead == 'o') ADVANCE(120);
-      END_STATE();
-    case 83:
-      if (lookahead == 'o') ADVANCE(122);
-      END_STATE();
-    case 84:
-      if (lookahead == 'o') ADVANCE(94);
-      END_STATE();
-    case 85:
-      if (lookahead == 'o') ADVANCE(74);
-      END_STATE();
-    case 86:
-      if (lookahead == 'p') ADVANCE(158);
-      END_STATE();
-    case 87:
-      if (lookahead == 'p') ADVANCE(106);
-      END_STATE();
-    case 88:
-      if (lookahead == 'p') ADVANCE(101);
-      END_STATE();
-    case 89:
-      if (lookahead == 'r') ADVANCE(82);
-      END_STATE();
-    case 90:
-      if (lookahead == 'r') ADVANCE(8);
-      END_STATE();
-    case 91:
-      if (lookahead == 'r') ADVANCE(181);
-      END_STATE();
-    case 92:
-      if (lookahead == 'r') ADVANCE(79);
-      END_STATE();
-    case 93:
-      if (lookahead == 'r') ADVANCE(17);
+    case 9:
+      if (lookahead == 'a') ADVANCE(24);
+      if (lookahead == 'e') ADVANCE(25);
+      if (lookahead == 'h') ADVANCE(26);
       END_STATE();
-    case 94:
-      if (lookahead == 'r') ADVANCE(63);
+    case 10:
+      if (lookahead == 'h') ADVANCE(27);
       END_STATE();
-    case 95:
-      if (lookahead == 's') ADVANCE(350);
+    case 11:
+      if (lookahead == 'c') ADVANCE(28);
       END_STATE();
-    case 96:
-      if (lookahead == 's') ADVANCE(148);
+    case 12:
+      if (lookahead == 'i') ADVANCE(29);
       END_STATE();
-    case 97:
-      if (lookahead == 's') ADVANCE(30);
+    case 13:
+      ACCEPT_TOKEN(anon_sym_as);
       END_STATE();
-    case 98:
-      if (lookahead == 's') ADVANCE(70);
+    case 14:
+      if (lookahead == 'g') ADVANCE(30);
       END_STATE();
-    case 99:
-      if (lookahead == 's') ADVANCE(32);
+    case 15:
+      if (lookahead == 'l') ADVANCE(31);
       END_STATE();
-    case 100:
-      if (lookahead == 's') ADVANCE(46);
+    case 16:
+      if (lookahead == 'a') ADVANCE(32);
       END_STATE();
-    case 101:
-      if (lookahead == 's') ADVANCE(38);
+    case 17:
+      if (lookahead == 'o') ADVANCE(33);
       END_STATE();
-    case 102:
-      if (lookahead == 't') ADVANCE(52);
+    case 18:
+      if (lookahead == 'p') ADVANCE(34);
       END_STATE();
-    case 103:
-      if (lookahead == 't') ADVANCE(185);
+    case 19:
+      if (lookahead == 't') ADVANCE(35);
       END_STATE();
-    case 104:
-      if (lookahead == 't') ADVANCE(160);
+    case 20:
+      if (lookahead == 'i') ADVANCE(36);
       END_STATE();
-    case 105:
-      if (lookahead == 't') ADVANCE(166);
+    case 21:
+      if (lookahead == 'c') ADVANCE(37);
       END_STATE();
-    case 106:
-      if (lookahead == 't') ADVANCE(146);
+    case 22:
+      if (lookahead == 'e') ADVANCE(38);
       END_STATE();
-    case 107:
-      if (lookahead == 't') ADVANCE(175);
+    case 23:
+      if (lookahead == 'a') ADVANCE(39);
+      if (lookahead == 'y') ADVANCE(40);
       END_STATE();
-    case 108:
-      if (lookahead == 't') ADVANCE(191);
+    case 24:
+      if (lookahead == 'g') ADVANCE(41);
       END_STATE();
-    case 109:
-      if (lookahead == 't') ADVANCE(203);
+    case 25:
+      if (lookahead == 'x') ADVANCE(42);
       END_STATE();
-    case 110:
-      if (lookahead == 't') ADVANCE(125);
+    case 26:
+      if (lookahead == 'e') ADVANCE(43);
       END_STATE();
-    case 111:
-      if (lookahead == 't') ADVANCE(126);
+    case 27:
+      if (lookahead == 'e') ADVANCE(44);
       END_STATE();
-    case 112:
-      if (lookahead == 't') ADVANCE(53);
+    case 28:
+      if (lookahead == 'e') ADVANCE(45);
       END_STATE();
-    case 113:
-      if (lookahead == 't') ADVANCE(121);
+    case 29:
+      if (lookahead == 'm') ADVANCE(46);
       END_STATE();
-    case 114:
-      if (lookahead == 't') ADVANCE(60);
+    case 30:
+      if (lookahead == 'e') ADVANCE(47);
       END_STATE();
-    case 115:
-      if (lookahead == 't') ADVANCE(19);
+    case 31:
+      if (lookahead == 'i') ADVANCE(48);
       END_STATE();
-    case 116:
-      if (lookahead == 't') ADVANCE(44);
+    case 32:
+      if (lookahead == 'm') ADVANCE(49);
       END_STATE();
-    case 117:
-      if (lookahead == 't') ADVANCE(36);
+    case 33:
+      if (lookahead == 'u') ADVANCE(50);
       END_STATE();
-    case 118:
-      if (lookahead == 't') ADVANCE(39);
+    case 34:
+      if (lookahead == 'o') ADVANCE(51);
       END_STATE();
-    case 119:
-      if (lookahead == 'u') ADVANCE(93);
+    case 35:
+      if (lookahead == 'h') ADVANCE(52);
       END_STATE();
-    case 120:
-      if (lookahead == 'u') ADVANCE(86);
+    case 36:
+      if (lookahead == 'o') ADVANCE(53);
       END_STATE();
-    case 121:
-      if (lookahead == 'u') ADVANCE(96);
+    case 37:
+      if (lookahead == 't') ADVANCE(54);
       END_STATE();
-    case 122:
-      if (lookahead == 'u') ADVANCE(108);
+    case 38:
+      if (lookahead == 'c') ADVANCE(55);
       END_STATE();
-    case 123:
-      if (lookahead == 'w') ADVANCE(193);
+    case 39:
+      if (lookahead == 't') ADVANCE(56);
       END_STATE();
-    case 124:
-      if (lookahead == 'x') ADVANCE(105);
+    case 40:
+      if (lookahead == 'l') ADVANCE(57);
       END_STATE();
-    case 125:
-      if (lookahead == 'y') ADVANCE(183);
+    case 41:
+      ACCEPT_TOKEN(anon_sym_tag);
       END_STATE();
-    case 126:
-      if (lookahead == 'y') ADVANCE(150);
+    case 42:
+      if (lookahead == 't') ADVANCE(58);
       END_STATE();
-    case 127:
-      if (lookahead == 'y') ADVANCE(83);
+    case 43:
+      if (lookahead == 'm') ADVANCE(59);
       END_STATE();
-    case 128:
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
+    case 44:
+      if (lookahead == 'n') ADVANCE(60);
       END_STATE();
-    case 129:
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(352);
+    case 45:
+      if (lookahead == 'p') ADVANCE(61);
       END_STATE();
-    case 130:
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(136);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '#') ADVANCE(137);
+    case 46:
+      ACCEPT_TOKEN(anon_sym_anim);
       END_STATE();
-    case 131:
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '#') ADVANCE(137);
+    case 47:
+      ACCEPT_TOKEN(anon_sym_edge);
       END_STATE();
-    case 132:
-      if (eof) ADVANCE(134);
-      ADVANCE_MAP(
-        '"', 359,
-        '#', 130,
-        '-', 128,
-        '=', 209,
-        '@', 215,
-        'e', 280,
-        'g', 308,
-        'p', 219,
-        'r', 255,
-        's', 304,
-        't', 242,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(132);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 48:
+      if (lookahead == 'p') ADVANCE(62);
       END_STATE();
-    case 133:
-      if (eof) ADVANCE(134);
-      ADVANCE_MAP(
-        '"', 359,
-        '#', 131,
-        '-', 6,
-        ':', 142,
-        '@', 215,
-        'a', 21,
-        'b', 49,
-        'c', 29,
-        'd', 119,
-        'e', 18,
-        'f', 56,
-        'g', 89,
-        'h', 172,
-        'l', 9,
-        'o', 47,
-        'p', 10,
-        'r', 40,
-        's', 23,
-        't', 11,
-        'u', 97,
-        'w', 169,
-        '{', 140,
-        '}', 141,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(133);
+    case 49:
+      if (lookahead == 'e') ADVANCE(63);
       END_STATE();
-    case 134:
-      ACCEPT_TOKEN(ts_builtin_sym_end);
+    case 50:
+      if (lookahead == 'p') ADVANCE(64);
       END_STATE();
-    case 135:
-      ACCEPT_TOKEN(sym_comment);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(358);
-      if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(137);
+    case 51:
+      if (lookahead == 'r') ADVANCE(65);
       END_STATE();
-    case 136:
-      ACCEPT_TOKEN(sym_comment);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(135);
-      if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(137);
+    case 52:
+      ACCEPT_TOKEN(anon_sym_path);
       END_STATE();
-    case 137:
-      ACCEPT_TOKEN(sym_comment);
-      if (lookahead != 0 &&
-          lookahead != '\n') ADVANCE(137);
+    case 53:
+      if (lookahead == 'r') ADVANCE(66);
       END_STATE();
-    case 138:
-      ACCEPT_TOKEN(anon_sym_spec);
+    case 54:
+      ACCEPT_TOKEN(anon_sym_rect);
       END_STATE();
-    case 139:
+    case 55:
       ACCEPT_TOKEN(anon_sym_spec);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 140:
-      ACCEPT_TOKEN(anon_sym_LBRACE);
-      END_STATE();
-    case 141:
-      ACCEPT_TOKEN(anon_sym_RBRACE);
-      END_STATE();
-    case 142:
-      ACCEPT_TOKEN(anon_sym_COLON);
-      END_STATE();
-    case 143:
-      ACCEPT_TOKEN(sym_spec_text);
-      if (lookahead == '"') ADVANCE(360);
-      if (lookahead == '#') ADVANCE(144);
-      if (lookahead == '\t' ||
-          (0x0b <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') ADVANCE(143);
-      if (lookahead != 0 &&
-          (lookahead < '\t' || '\r' < lookahead) &&
-          lookahead != '}') ADVANCE(145);
       END_STATE();
-    case 144:
-      ACCEPT_TOKEN(sym_spec_text);
-      if (lookahead == '#') ADVANCE(145);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '}') ADVANCE(145);
+    case 56:
+      if (lookahead == 'u') ADVANCE(67);
       END_STATE();
-    case 145:
-      ACCEPT_TOKEN(sym_spec_text);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '}') ADVANCE(145);
+    case 57:
+      if (lookahead == 'e') ADVANCE(68);
       END_STATE();
-    case 146:
-      ACCEPT_TOKEN(anon_sym_accept);
+    case 58:
+      ACCEPT_TOKEN(anon_sym_text);
       END_STATE();
-    case 147:
-      ACCEPT_TOKEN(anon_sym_accept);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 59:
+      if (lookahead == 'e') ADVANCE(69);
       END_STATE();
-    case 148:
-      ACCEPT_TOKEN(anon_sym_status);
+    case 60:
+      ACCEPT_TOKEN(anon_sym_when);
       END_STATE();
-    case 149:
-      ACCEPT_TOKEN(anon_sym_status);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 61:
+      if (lookahead == 't') ADVANCE(70);
       END_STATE();
-    case 150:
-      ACCEPT_TOKEN(anon_sym_priority);
+    case 62:
+      if (lookahead == 's') ADVANCE(71);
       END_STATE();
-    case 151:
-      ACCEPT_TOKEN(anon_sym_priority);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 63:
+      ACCEPT_TOKEN(anon_sym_frame);
       END_STATE();
-    case 152:
-      ACCEPT_TOKEN(anon_sym_tag);
+    case 64:
+      ACCEPT_TOKEN(anon_sym_group);
       END_STATE();
-    case 153:
-      ACCEPT_TOKEN(anon_sym_tag);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 65:
+      if (lookahead == 't') ADVANCE(72);
       END_STATE();
-    case 154:
-      ACCEPT_TOKEN(anon_sym_theme);
+    case 66:
+      if (lookahead == 'i') ADVANCE(73);
       END_STATE();
-    case 155:
-      ACCEPT_TOKEN(anon_sym_theme);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 67:
+      if (lookahead == 's') ADVANCE(74);
       END_STATE();
-    case 156:
+    case 68:
       ACCEPT_TOKEN(anon_sym_style);
       END_STATE();
-    case 157:
-      ACCEPT_TOKEN(anon_sym_style);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 69:
+      ACCEPT_TOKEN(anon_sym_theme);
       END_STATE();
-    case 158:
-      ACCEPT_TOKEN(anon_sym_group);
+    case 70:
+      ACCEPT_TOKEN(anon_sym_accept);
       END_STATE();
-    case 159:
-      ACCEPT_TOKEN(anon_sym_group);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 71:
+      if (lookahead == 'e') ADVANCE(75);
       END_STATE();
-    case 160:
-      ACCEPT_TOKEN(anon_sym_rect);
+    case 72:
+      ACCEPT_TOKEN(anon_sym_import);
       END_STATE();
-    case 161:
-      ACCEPT_TOKEN(anon_sym_rect);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
+    case 73:
+      if (lookahead == 't') ADVANCE(76);
       END_STATE();
-    case 162:
-      ACCEPT_TOKEN(anon_sym_ellipse);
+    case 74:
+      ACCEPT_TOKEN(anon_sym_status);
       END_STATE();
-    case 163:
+    case 75:
       ACCEPT_TOKEN(anon_sym_ellipse);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
       END_STATE();
-    case 164:
-      ACCEPT_TOKEN(anon_sym_path);
-      END_STATE();
-    case 165:
-      ACCEPT_TOKEN(anon_sym_path);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 166:
-      ACCEPT_TOKEN(anon_sym_text);
+    case 76:
+      if (lookahead == 'y') ADVANCE(77);
       END_STATE();
-    case 167:
-      ACCEPT_TOKEN(anon_sym_text);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 168:
-      ACCEPT_TOKEN(anon_sym_w);
-      if (lookahead == 'h') ADVANCE(258);
-      if (lookahead == 'i') ADVANCE(240);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 169:
-      ACCEPT_TOKEN(anon_sym_w);
-      if (lookahead == 'h') ADVANCE(43);
-      if (lookahead == 'i') ADVANCE(28);
-      END_STATE();
-    case 170:
-      ACCEPT_TOKEN(anon_sym_w);
-      if (lookahead == 'i') ADVANCE(240);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 171:
-      ACCEPT_TOKEN(anon_sym_h);
-      if (lookahead == 'e') ADVANCE(274);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 172:
-      ACCEPT_TOKEN(anon_sym_h);
-      if (lookahead == 'e') ADVANCE(59);
-      END_STATE();
-    case 173:
-      ACCEPT_TOKEN(anon_sym_width);
-      END_STATE();
-    case 174:
-      ACCEPT_TOKEN(anon_sym_width);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 175:
-      ACCEPT_TOKEN(anon_sym_height);
-      END_STATE();
-    case 176:
-      ACCEPT_TOKEN(anon_sym_height);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 177:
-      ACCEPT_TOKEN(anon_sym_fill);
-      END_STATE();
-    case 178:
-      ACCEPT_TOKEN(anon_sym_fill);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 179:
-      ACCEPT_TOKEN(anon_sym_stroke);
-      END_STATE();
-    case 180:
-      ACCEPT_TOKEN(anon_sym_stroke);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 181:
-      ACCEPT_TOKEN(anon_sym_corner);
-      END_STATE();
-    case 182:
-      ACCEPT_TOKEN(anon_sym_corner);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 183:
-      ACCEPT_TOKEN(anon_sym_opacity);
-      END_STATE();
-    case 184:
-      ACCEPT_TOKEN(anon_sym_opacity);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 185:
-      ACCEPT_TOKEN(anon_sym_font);
-      END_STATE();
-    case 186:
-      ACCEPT_TOKEN(anon_sym_font);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 187:
-      ACCEPT_TOKEN(anon_sym_bg);
-      END_STATE();
-    case 188:
-      ACCEPT_TOKEN(anon_sym_bg);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 189:
-      ACCEPT_TOKEN(anon_sym_use);
-      END_STATE();
-    case 190:
-      ACCEPT_TOKEN(anon_sym_use);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 191:
-      ACCEPT_TOKEN(anon_sym_layout);
-      END_STATE();
-    case 192:
-      ACCEPT_TOKEN(anon_sym_layout);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 193:
-      ACCEPT_TOKEN(anon_sym_shadow);
-      END_STATE();
-    case 194:
-      ACCEPT_TOKEN(anon_sym_shadow);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 195:
-      ACCEPT_TOKEN(anon_sym_scale);
-      END_STATE();
-    case 196:
-      ACCEPT_TOKEN(anon_sym_scale);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 197:
-      ACCEPT_TOKEN(anon_sym_rotate);
-      END_STATE();
-    case 198:
-      ACCEPT_TOKEN(anon_sym_rotate);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 199:
-      ACCEPT_TOKEN(anon_sym_translate);
-      END_STATE();
-    case 200:
-      ACCEPT_TOKEN(anon_sym_translate);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 201:
-      ACCEPT_TOKEN(anon_sym_center_in);
-      END_STATE();
-    case 202:
-      ACCEPT_TOKEN(anon_sym_center_in);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 203:
-      ACCEPT_TOKEN(anon_sym_offset);
-      END_STATE();
-    case 204:
-      ACCEPT_TOKEN(anon_sym_offset);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 205:
-      ACCEPT_TOKEN(anon_sym_ease);
-      END_STATE();
-    case 206:
-      ACCEPT_TOKEN(anon_sym_ease);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 207:
-      ACCEPT_TOKEN(anon_sym_duration);
-      END_STATE();
-    case 208:
-      ACCEPT_TOKEN(anon_sym_duration);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 209:
-      ACCEPT_TOKEN(anon_sym_EQ);
-      END_STATE();
-    case 210:
-      ACCEPT_TOKEN(anon_sym_when);
-      END_STATE();
-    case 211:
-      ACCEPT_TOKEN(anon_sym_when);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 212:
-      ACCEPT_TOKEN(anon_sym_anim);
-      END_STATE();
-    case 213:
-      ACCEPT_TOKEN(anon_sym_anim);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 214:
-      ACCEPT_TOKEN(anon_sym_DASH_GT);
-      END_STATE();
-    case 215:
-      ACCEPT_TOKEN(anon_sym_AT);
-      END_STATE();
-    case 216:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == '_') ADVANCE(276);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 217:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(347);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 218:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(322);
-      if (lookahead == 'r') ADVANCE(272);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 219:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(322);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 220:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(265);
-      if (lookahead == 'e') ADVANCE(344);
-      if (lookahead == 'h') ADVANCE(256);
-      if (lookahead == 'r') ADVANCE(223);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 221:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(239);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 222:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(236);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 223:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(293);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 224:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(284);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 225:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(333);
-      if (lookahead == 'r') ADVANCE(297);
-      if (lookahead == 'y') ADVANCE(285);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 226:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(334);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 227:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(319);
-      if (lookahead == 'l') ADVANCE(283);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 228:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(319);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 229:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(337);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 230:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'a') ADVANCE(338);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 231:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(238);
-      if (lookahead == 'n') ADVANCE(270);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 232:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(139);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 233:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(224);
-      if (lookahead == 'h') ADVANCE(221);
-      if (lookahead == 'p') ADVANCE(257);
-      if (lookahead == 't') ADVANCE(225);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 234:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(224);
-      if (lookahead == 'h') ADVANCE(221);
-      if (lookahead == 'p') ADVANCE(257);
-      if (lookahead == 't') ADVANCE(312);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 235:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(224);
-      if (lookahead == 'h') ADVANCE(221);
-      if (lookahead == 't') ADVANCE(312);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 236:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(277);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 237:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(324);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 238:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'c') ADVANCE(245);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 239:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'd') ADVANCE(298);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 240:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'd') ADVANCE(332);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 241:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(294);
-      if (lookahead == 'o') ADVANCE(311);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 242:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(344);
-      if (lookahead == 'h') ADVANCE(256);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 243:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(344);
-      if (lookahead == 'r') ADVANCE(223);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 244:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(190);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 245:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(306);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 246:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(206);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 247:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(196);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 248:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(157);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 249:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(155);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 250:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(198);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 251:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(180);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 252:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(163);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 253:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(200);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 254:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(237);
-      if (lookahead == 'o') ADVANCE(335);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 255:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(237);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 256:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(288);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 257:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(232);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 258:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(290);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 259:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(309);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 260:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(310);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 261:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'e') ADVANCE(329);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 262:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'f') ADVANCE(263);
-      if (lookahead == 'p') ADVANCE(222);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 263:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'f') ADVANCE(320);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 264:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(188);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 265:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(153);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 266:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'g') ADVANCE(269);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 267:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'h') ADVANCE(165);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 268:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'h') ADVANCE(174);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 269:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'h') ADVANCE(327);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 270:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(287);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 271:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(282);
-      if (lookahead == 'o') ADVANCE(295);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 272:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(302);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 273:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(307);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 274:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(266);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 275:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(303);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 276:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(292);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 277:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(330);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 278:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'i') ADVANCE(331);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 279:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'k') ADVANCE(251);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 280:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(283);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 281:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(178);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 282:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(281);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 283:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(273);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 284:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(247);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 285:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(248);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 286:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'l') ADVANCE(230);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 287:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'm') ADVANCE(213);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 288:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'm') ADVANCE(249);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 289:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(270);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 290:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(211);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 291:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(208);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 292:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(202);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 293:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(318);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 294:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(336);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 295:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(323);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 296:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'n') ADVANCE(260);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 297:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(279);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 298:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(343);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 299:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(341);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 300:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(335);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 301:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(342);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 302:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(315);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 303:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'o') ADVANCE(291);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 304:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'p') ADVANCE(257);
-      if (lookahead == 't') ADVANCE(348);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 305:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'p') ADVANCE(159);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 306:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'p') ADVANCE(326);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 307:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'p') ADVANCE(321);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 308:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(299);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 309:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(216);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 310:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(182);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 311:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(296);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 312:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(297);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 313:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(223);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 314:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(226);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 315:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'r') ADVANCE(278);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 316:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(149);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 317:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(244);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 318:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(286);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 319:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(246);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 320:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(261);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 321:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 's') ADVANCE(252);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 322:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(267);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 323:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(186);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 324:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(161);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 325:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(167);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 326:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(147);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 327:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(176);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 328:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(192);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 329:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(204);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 330:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(345);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 331:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(346);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 332:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(268);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 333:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(340);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 334:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(275);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 335:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(229);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 336:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(259);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 337:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(250);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 338:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 't') ADVANCE(253);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 339:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'u') ADVANCE(314);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 340:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'u') ADVANCE(316);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 341:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'u') ADVANCE(305);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 342:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'u') ADVANCE(328);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 343:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'w') ADVANCE(194);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 344:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'x') ADVANCE(325);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 345:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'y') ADVANCE(184);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 346:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'y') ADVANCE(151);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 347:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'y') ADVANCE(301);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 348:
-      ACCEPT_TOKEN(sym_identifier);
-      if (lookahead == 'y') ADVANCE(285);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 349:
-      ACCEPT_TOKEN(sym_identifier);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(349);
-      END_STATE();
-    case 350:
-      ACCEPT_TOKEN(sym_number);
-      END_STATE();
-    case 351:
-      ACCEPT_TOKEN(sym_number);
-      if (lookahead == '.') ADVANCE(129);
-      if (lookahead == 'm') ADVANCE(95);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(351);
-      END_STATE();
-    case 352:
-      ACCEPT_TOKEN(sym_number);
-      if (lookahead == 'm') ADVANCE(95);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(352);
-      END_STATE();
-    case 353:
-      ACCEPT_TOKEN(sym_hex_color);
-      END_STATE();
-    case 354:
-      ACCEPT_TOKEN(sym_hex_color);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(353);
-      END_STATE();
-    case 355:
-      ACCEPT_TOKEN(sym_hex_color);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(354);
-      END_STATE();
-    case 356:
-      ACCEPT_TOKEN(sym_hex_color);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(355);
-      END_STATE();
-    case 357:
-      ACCEPT_TOKEN(sym_hex_color);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(356);
-      END_STATE();
-    case 358:
-      ACCEPT_TOKEN(sym_hex_color);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(357);
-      END_STATE();
-    case 359:
-      ACCEPT_TOKEN(anon_sym_DQUOTE);
-      END_STATE();
-    case 360:
-      ACCEPT_TOKEN(anon_sym_DQUOTE);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '}') ADVANCE(145);
-      END_STATE();
-    case 361:
-      ACCEPT_TOKEN(aux_sym_string_token1);
-      if (lookahead == '\n') ADVANCE(364);
-      if (lookahead != 0 &&
-          lookahead != '"') ADVANCE(361);
-      END_STATE();
-    case 362:
-      ACCEPT_TOKEN(aux_sym_string_token1);
-      if (lookahead == '#') ADVANCE(363);
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') ADVANCE(362);
-      if (lookahead != 0 &&
-          lookahead != '"' &&
-          lookahead != '#') ADVANCE(364);
-      END_STATE();
-    case 363:
-      ACCEPT_TOKEN(aux_sym_string_token1);
-      if (lookahead == '\n' ||
-          lookahead == '#') ADVANCE(364);
-      if (lookahead != 0 &&
-          lookahead != '"' &&
-          lookahead != '#') ADVANCE(361);
-      END_STATE();
-    case 364:
-      ACCEPT_TOKEN(aux_sym_string_token1);
-      if (lookahead != 0 &&
-          lookahead != '"') ADVANCE(364);
+    case 77:
+      ACCEPT_TOKEN(anon_sym_priority);
       END_STATE();
     default:
       return false;
   }
 }
 
-static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
-  [0] = {.lex_state = 0},
-  [1] = {.lex_state = 133},
-  [2] = {.lex_state = 133},
-  [3] = {.lex_state = 2},
-  [4] = {.lex_state = 2},
-  [5] = {.lex_state = 133},
-  [6] = {.lex_state = 133},
-  [7] = {.lex_state = 133},
-  [8] = {.lex_state = 133},
-  [9] = {.lex_state = 133},
-  [10] = {.lex_state = 133},
-  [11] = {.lex_state = 133},
-  [12] = {.lex_state = 133},
-  [13] = {.lex_state = 133},
-  [14] = {.lex_state = 2},
-  [15] = {.lex_state = 2},
-  [16] = {.lex_state = 2},
-  [17] = {.lex_state = 2},
-  [18] = {.lex_state = 133},
-  [19] = {.lex_state = 133},
-  [20] = {.lex_state = 133},
-  [21] = {.lex_state = 133},
-  [22] = {.lex_state = 133},
-  [23] = {.lex_state = 133},
-  [24] = {.lex_state = 133},
-  [25] = {.lex_state = 133},
-  [26] = {.lex_state = 133},
-  [27] = {.lex_state = 133},
-  [28] = {.lex_state = 133},
-  [29] = {.lex_state = 3},
-  [30] = {.lex_state = 3},
-  [31] = {.lex_state = 133},
-  [32] = {.lex_state = 133},
-  [33] = {.lex_state = 133},
-  [34] = {.lex_state = 3},
-  [35] = {.lex_state = 3},
-  [36] = {.lex_state = 3},
-  [37] = {.lex_state = 3},
-  [38] = {.lex_state = 133},
-  [39] = {.lex_state = 133},
-  [40] = {.lex_state = 133},
-  [41] = {.lex_state = 133},
-  [42] = {.lex_state = 133},
-  [43] = {.lex_state = 132},
-  [44] = {.lex_state = 132},
-  [45] = {.lex_state = 133},
-  [46] = {.lex_state = 133},
-  [47] = {.lex_state = 132},
-  [48] = {.lex_state = 132},
-  [49] = {.lex_state = 132},
-  [50] = {.lex_state = 132},
-  [51] = {.lex_state = 133},
-  [52] = {.lex_state = 133},
-  [53] = {.lex_state = 133},
-  [54] = {.lex_state = 4},
-  [55] = {.lex_state = 4},
-  [56] = {.lex_state = 4},
-  [57] = {.lex_state = 133},
-  [58] = {.lex_state = 133},
-  [59] = {.lex_state = 133},
-  [60] = {.lex_state = 133},
-  [61] = {.lex_state = 4},
-  [62] = {.lex_state = 133},
-  [63] = {.lex_state = 4},
-  [64] = {.lex_state = 4},
-  [65] = {.lex_state = 133},
-  [66] = {.lex_state = 133},
-  [67] = {.lex_state = 133},
-  [68] = {.lex_state = 133},
-  [69] = {.lex_state = 1},
-  [70] = {.lex_state = 133},
-  [71] = {.lex_state = 5},
-  [72] = {.lex_state = 133},
-  [73] = {.lex_state = 5},
-  [74] = {.lex_state = 5},
-  [75] = {.lex_state = 5},
-  [76] = {.lex_state = 133},
-  [77] = {.lex_state = 133},
-  [78] = {.lex_state = 133},
-  [79] = {.lex_state = 133},
-  [80] = {.lex_state = 133},
-  [81] = {.lex_state = 133},
-  [82] = {.lex_state = 133},
-  [83] = {.lex_state = 133},
-  [84] = {.lex_state = 133},
-  [85] = {.lex_state = 133},
-  [86] = {.lex_state = 5},
-  [87] = {.lex_state = 133},
-  [88] = {.lex_state = 133},
-  [89] = {.lex_state = 362},
-  [90] = {.lex_state = 5},
-  [91] = {.lex_state = 133},
-  [92] = {.lex_state = 133},
-  [93] = {.lex_state = 5},
-  [94] = {.lex_state = 133},
-  [95] = {.lex_state = 362},
-  [96] = {.lex_state = 133},
-  [97] = {.lex_state = 362},
-  [98] = {.lex_state = 362},
+static const TSLexMode ts_lex_modes[STATE_COUNT] = {
+  [0] = {.lex_state = 0, .external_lex_state = 1},
+  [1] = {.lex_state = 13},
+  [2] = {.lex_state = 12, .external_lex_state = 2},
+  [3] = {.lex_state = 12, .external_lex_state = 3},
+  [4] = {.lex_state = 12, .external_lex_state = 3},
+  [5] = {.lex_state = 12, .external_lex_state = 3},
+  [6] = {.lex_state = 12, .external_lex_state = 2},
+  [7] = {.lex_state = 12, .external_lex_state = 2},
+  [8] = {.lex_state = 12, .external_lex_state = 3},
+  [9] = {.lex_state = 12, .external_lex_state = 2},
+  [10] = {.lex_state = 12, .external_lex_state = 2},
+  [11] = {.lex_state = 13},
+  [12] = {.lex_state = 13},
+  [13] = {.lex_state = 13, .external_lex_state = 4},
+  [14] = {.lex_state = 13, .external_lex_state = 4},
+  [15] = {.lex_state = 13, .external_lex_state = 4},
+  [16] = {.lex_state = 0, .external_lex_state = 3},
+  [17] = {.lex_state = 0, .external_lex_state = 2},
+  [18] = {.lex_state = 13, .external_lex_state = 4},
+  [19] = {.lex_state = 13, .external_lex_state = 4},
+  [20] = {.lex_state = 12, .external_lex_state = 3},
+  [21] = {.lex_state = 12, .external_lex_state = 3},
+  [22] = {.lex_state = 12, .external_lex_state = 3},
+  [23] = {.lex_state = 12, .external_lex_state = 3},
+  [24] = {.lex_state = 12, .external_lex_state = 3},
+  [25] = {.lex_state = 12, .external_lex_state = 2},
+  [26] = {.lex_state = 12, .external_lex_state = 2},
+  [27] = {.lex_state = 12, .external_lex_state = 2},
+  [28] = {.lex_state = 12, .external_lex_state = 2},
+  [29] = {.lex_state = 12, .external_lex_state = 2},
+  [30] = {.lex_state = 12, .external_lex_state = 3},
+  [31] = {.lex_state = 12, .external_lex_state = 2},
+  [32] = {.lex_state = 13, .external_lex_state = 4},
+  [33] = {.lex_state = 13, .external_lex_state = 4},
+  [34] = {.lex_state = 13, .external_lex_state = 4},
+  [35] = {.lex_state = 13, .external_lex_state = 4},
+  [36] = {.lex_state = 13, .external_lex_state = 4},
+  [37] = {.lex_state = 13},
+  [38] = {.lex_state = 13},
+  [39] = {.lex_state = 13},
+  [40] = {.lex_state = 13},
+  [41] = {.lex_state = 13},
+  [42] = {.lex_state = 13},
+  [43] = {.lex_state = 13},
+  [44] = {.lex_state = 13},
+  [45] = {.lex_state = 13},
+  [46] = {.lex_state = 13},
+  [47] = {.lex_state = 13},
+  [48] = {.lex_state = 13},
+  [49] = {.lex_state = 12, .external_lex_state = 2},
+  [50] = {.lex_state = 13},
+  [51] = {.lex_state = 13},
+  [52] = {.lex_state = 13},
+  [53] = {.lex_state = 13},
+  [54] = {.lex_state = 13},
+  [55] = {.lex_state = 13},
+  [56] = {.lex_state = 13, .external_lex_state = 4},
+  [57] = {.lex_state = 13, .external_lex_state = 4},
+  [58] = {.lex_state = 13, .external_lex_state = 4},
+  [59] = {.lex_state = 13, .external_lex_state = 4},
+  [60] = {.lex_state = 13, .external_lex_state = 4},
+  [61] = {.lex_state = 13, .external_lex_state = 4},
+  [62] = {.lex_state = 13, .external_lex_state = 4},
+  [63] = {.lex_state = 13, .external_lex_state = 4},
+  [64] = {.lex_state = 13, .external_lex_state = 4},
+  [65] = {.lex_state = 13, .external_lex_state = 4},
+  [66] = {.lex_state = 13, .external_lex_state = 4},
+  [67] = {.lex_state = 13, .external_lex_state = 4},
+  [68] = {.lex_state = 13, .external_lex_state = 4},
+  [69] = {.lex_state = 13, .external_lex_state = 4},
+  [70] = {.lex_state = 13, .external_lex_state = 4},
+  [71] = {.lex_state = 13, .external_lex_state = 4},
+  [72] = {.lex_state = 12, .external_lex_state = 2},
+  [73] = {.lex_state = 13, .external_lex_state = 4},
+  [74] = {.lex_state = 13, .external_lex_state = 2},
+  [75] = {.lex_state = 13, .external_lex_state = 2},
+  [76] = {.lex_state = 13, .external_lex_state = 2},
+  [77] = {.lex_state = 13, .external_lex_state = 2},
+  [78] = {.lex_state = 13, .external_lex_state = 2},
+  [79] = {.lex_state = 13, .external_lex_state = 2},
+  [80] = {.lex_state = 13, .external_lex_state = 2},
+  [81] = {.lex_state = 12, .external_lex_state = 2},
+  [82] = {.lex_state = 12, .external_lex_state = 2},
+  [83] = {.lex_state = 13, .external_lex_state = 2},
+  [84] = {.lex_state = 0},
+  [85] = {.lex_state = 0},
+  [86] = {.lex_state = 0},
+  [87] = {.lex_state = 0},
+  [88] = {.lex_state = 0},
+  [89] = {.lex_state = 13, .external_lex_state = 2},
+  [90] = {.lex_state = 0},
+  [91] = {.lex_state = 0},
+  [92] = {.lex_state = 0},
+  [93] = {.lex_state = 0},
+  [94] = {.lex_state = 13, .external_lex_state = 4},
+  [95] = {.lex_state = 13, .external_lex_state = 4},
+  [96] = {.lex_state = 13, .external_lex_state = 4},
+  [97] = {.lex_state = 13, .external_lex_state = 4},
+  [98] = {.lex_state = 13, .external_lex_state = 4},
+  [99] = {.lex_state = 13, .external_lex_state = 2},
+  [100] = {.lex_state = 13},
+  [101] = {.lex_state = 13},
+  [102] = {.lex_state = 13, .external_lex_state = 2},
+  [103] = {.lex_state = 13, .external_lex_state = 2},
+  [104] = {.lex_state = 13, .external_lex_state = 2},
+  [105] = {.lex_state = 13},
+  [106] = {.lex_state = 13},
+  [107] = {.lex_state = 13},
+  [108] = {.lex_state = 13},
+  [109] = {.lex_state = 13},
+  [110] = {.lex_state = 13, .external_lex_state = 5},
+  [111] = {.lex_state = 13, .external_lex_state = 2},
+  [112] = {.lex_state = 13, .external_lex_state = 2},
+  [113] = {.lex_state = 13},
+  [114] = {.lex_state = 13},
+  [115] = {.lex_state = 13, .external_lex_state = 2},
+  [116] = {.lex_state = 13},
+  [117] = {.lex_state = 13},
+  [118] = {.lex_state = 13},
+  [119] = {.lex_state = 13},
+  [120] = {.lex_state = 13},
+  [121] = {.lex_state = 13},
+  [122] = {.lex_state = 13},
+  [123] = {.lex_state = 13},
+  [124] = {.lex_state = 13},
+  [125] = {.lex_state = 13},
+  [126] = {.lex_state = 13},
+  [127] = {.lex_state = 13},
+  [128] = {.lex_state = 13},
+  [129] = {.lex_state = 13},
+  [130] = {.lex_state = 13},
+  [131] = {.lex_state = 13},
+  [132] = {.lex_state = 13},
+  [133] = {.lex_state = 13},
+  [134] = {.lex_state = 13},
+};
+
+enum ts_external_scanner_symbol_identifiers {
+  ts_external_token_property_name = 0,
+  ts_external_token_string = 1,
+  ts_external_token_spec_text = 2,
+  ts_external_token__error_sentinel = 3,
 };
 
 static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
   [STATE(0)] = {
     [ts_builtin_sym_end] = ACTIONS(1),
+    [sym_identifier] = ACTIONS(1),
+    [anon_sym_import] = ACTIONS(1),
+    [anon_sym_as] = ACTIONS(1),
     [sym_comment] = ACTIONS(3),
     [anon_sym_spec] = ACTIONS(1),
     [anon_sym_LBRACE] = ACTIONS(1),
@@ -3010,2268 +1422,2380 @@ static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
     [anon_sym_theme] = ACTIONS(1),
     [anon_sym_style] = ACTIONS(1),
     [anon_sym_group] = ACTIONS(1),
+    [anon_sym_frame] = ACTIONS(1),
     [anon_sym_rect] = ACTIONS(1),
     [anon_sym_ellipse] = ACTIONS(1),
     [anon_sym_path] = ACTIONS(1),
     [anon_sym_text] = ACTIONS(1),
-    [anon_sym_w] = ACTIONS(1),
-    [anon_sym_h] = ACTIONS(1),
-    [anon_sym_width] = ACTIONS(1),
-    [anon_sym_height] = ACTIONS(1),
-    [anon_sym_fill] = ACTIONS(1),
-    [anon_sym_stroke] = ACTIONS(1),
-    [anon_sym_corner] = ACTIONS(1),
-    [anon_sym_opacity] = ACTIONS(1),
-    [anon_sym_font] = ACTIONS(1),
-    [anon_sym_bg] = ACTIONS(1),
-    [anon_sym_use] = ACTIONS(1),
-    [anon_sym_layout] = ACTIONS(1),
-    [anon_sym_shadow] = ACTIONS(1),
-    [anon_sym_scale] = ACTIONS(1),
-    [anon_sym_rotate] = ACTIONS(1),
-    [anon_sym_translate] = ACTIONS(1),
-    [anon_sym_center_in] = ACTIONS(1),
-    [anon_sym_offset] = ACTIONS(1),
-    [anon_sym_ease] = ACTIONS(1),
-    [anon_sym_duration] = ACTIONS(1),
+    [anon_sym_edge] = ACTIONS(1),
+    [anon_sym_SEMI] = ACTIONS(1),
+    [anon_sym_COMMA] = ACTIONS(1),
     [anon_sym_EQ] = ACTIONS(1),
+    [anon_sym_LPAREN] = ACTIONS(1),
+    [anon_sym_RPAREN] = ACTIONS(1),
+    [anon_sym_LPAREN2] = ACTIONS(1),
     [anon_sym_when] = ACTIONS(1),
     [anon_sym_anim] = ACTIONS(1),
     [anon_sym_DASH_GT] = ACTIONS(1),
     [anon_sym_AT] = ACTIONS(1),
-    [sym_identifier] = ACTIONS(1),
     [sym_number] = ACTIONS(1),
     [sym_hex_color] = ACTIONS(1),
-    [anon_sym_DQUOTE] = ACTIONS(1),
+    [sym_property_name] = ACTIONS(1),
+    [sym_string] = ACTIONS(1),
+    [sym_spec_text] = ACTIONS(1),
+    [sym__error_sentinel] = ACTIONS(1),
   },
   [STATE(1)] = {
-    [sym_document] = STATE(78),
-    [sym_spec_block] = STATE(46),
-    [sym_style_block] = STATE(46),
-    [sym_node_declaration] = STATE(46),
-    [sym_node_kind] = STATE(62),
-    [sym_constraint_line] = STATE(46),
-    [sym_node_id] = STATE(83),
-    [aux_sym_document_repeat1] = STATE(46),
+    [sym_document] = STATE(118),
+    [sym_import_declaration] = STATE(11),
+    [sym_spec_block] = STATE(11),
+    [sym_style_block] = STATE(11),
+    [sym_node_declaration] = STATE(11),
+    [sym__typed_node] = STATE(37),
+    [sym_node_kind] = STATE(83),
+    [sym_edge_block] = STATE(11),
+    [sym_constraint_line] = STATE(11),
+    [sym_node_id] = STATE(101),
+    [aux_sym_document_repeat1] = STATE(11),
     [ts_builtin_sym_end] = ACTIONS(5),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_theme] = ACTIONS(11),
-    [anon_sym_style] = ACTIONS(11),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_AT] = ACTIONS(15),
-  },
-  [STATE(2)] = {
-    [ts_builtin_sym_end] = ACTIONS(17),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(17),
-    [anon_sym_LBRACE] = ACTIONS(17),
-    [anon_sym_RBRACE] = ACTIONS(17),
-    [anon_sym_accept] = ACTIONS(17),
-    [anon_sym_status] = ACTIONS(17),
-    [anon_sym_priority] = ACTIONS(17),
-    [anon_sym_tag] = ACTIONS(17),
-    [anon_sym_theme] = ACTIONS(17),
-    [anon_sym_style] = ACTIONS(17),
-    [anon_sym_group] = ACTIONS(17),
-    [anon_sym_rect] = ACTIONS(17),
-    [anon_sym_ellipse] = ACTIONS(17),
-    [anon_sym_path] = ACTIONS(17),
-    [anon_sym_text] = ACTIONS(17),
-    [anon_sym_w] = ACTIONS(19),
-    [anon_sym_h] = ACTIONS(19),
-    [anon_sym_width] = ACTIONS(17),
-    [anon_sym_height] = ACTIONS(17),
-    [anon_sym_fill] = ACTIONS(17),
-    [anon_sym_stroke] = ACTIONS(17),
-    [anon_sym_corner] = ACTIONS(17),
-    [anon_sym_opacity] = ACTIONS(17),
-    [anon_sym_font] = ACTIONS(17),
-    [anon_sym_bg] = ACTIONS(17),
-    [anon_sym_use] = ACTIONS(17),
-    [anon_sym_layout] = ACTIONS(17),
-    [anon_sym_shadow] = ACTIONS(17),
-    [anon_sym_scale] = ACTIONS(17),
-    [anon_sym_rotate] = ACTIONS(17),
-    [anon_sym_translate] = ACTIONS(17),
-    [anon_sym_center_in] = ACTIONS(17),
-    [anon_sym_offset] = ACTIONS(17),
-    [anon_sym_ease] = ACTIONS(17),
-    [anon_sym_duration] = ACTIONS(17),
-    [anon_sym_when] = ACTIONS(17),
-    [anon_sym_anim] = ACTIONS(17),
-    [anon_sym_AT] = ACTIONS(17),
-    [anon_sym_DQUOTE] = ACTIONS(17),
-  },
-  [STATE(3)] = {
-    [sym__value_item] = STATE(4),
-    [sym_key_value_pair] = STATE(4),
-    [sym_node_id] = STATE(4),
-    [sym_string] = STATE(4),
-    [aux_sym_property_repeat1] = STATE(4),
-    [sym_comment] = ACTIONS(3),
-    [anon_sym_spec] = ACTIONS(21),
-    [anon_sym_RBRACE] = ACTIONS(23),
-    [anon_sym_group] = ACTIONS(21),
-    [anon_sym_rect] = ACTIONS(21),
-    [anon_sym_ellipse] = ACTIONS(21),
-    [anon_sym_path] = ACTIONS(21),
-    [anon_sym_text] = ACTIONS(21),
-    [anon_sym_w] = ACTIONS(21),
-    [anon_sym_h] = ACTIONS(21),
-    [anon_sym_width] = ACTIONS(21),
-    [anon_sym_height] = ACTIONS(21),
-    [anon_sym_fill] = ACTIONS(21),
-    [anon_sym_stroke] = ACTIONS(21),
-    [anon_sym_corner] = ACTIONS(21),
-    [anon_sym_opacity] = ACTIONS(21),
-    [anon_sym_font] = ACTIONS(21),
-    [anon_sym_bg] = ACTIONS(21),
-    [anon_sym_use] = ACTIONS(21),
-    [anon_sym_layout] = ACTIONS(21),
-    [anon_sym_shadow] = ACTIONS(21),
-    [anon_sym_scale] = ACTIONS(21),
-    [anon_sym_rotate] = ACTIONS(21),
-    [anon_sym_translate] = ACTIONS(21),
-    [anon_sym_center_in] = ACTIONS(21),
-    [anon_sym_offset] = ACTIONS(21),
-    [anon_sym_ease] = ACTIONS(21),
-    [anon_sym_duration] = ACTIONS(21),
-    [anon_sym_when] = ACTIONS(21),
-    [anon_sym_anim] = ACTIONS(21),
-    [anon_sym_AT] = ACTIONS(25),
-    [sym_identifier] = ACTIONS(27),
-    [sym_number] = ACTIONS(29),
-    [sym_hex_color] = ACTIONS(29),
-    [anon_sym_DQUOTE] = ACTIONS(31),
-  },
-  [STATE(4)] = {
-    [sym__value_item] = STATE(4),
-    [sym_key_value_pair] = STATE(4),
-    [sym_node_id] = STATE(4),
-    [sym_string] = STATE(4),
-    [aux_sym_property_repeat1] = STATE(4),
-    [sym_comment] = ACTIONS(3),
-    [anon_sym_spec] = ACTIONS(33),
-    [anon_sym_RBRACE] = ACTIONS(35),
-    [anon_sym_group] = ACTIONS(33),
-    [anon_sym_rect] = ACTIONS(33),
-    [anon_sym_ellipse] = ACTIONS(33),
-    [anon_sym_path] = ACTIONS(33),
-    [anon_sym_text] = ACTIONS(33),
-    [anon_sym_w] = ACTIONS(33),
-    [anon_sym_h] = ACTIONS(33),
-    [anon_sym_width] = ACTIONS(33),
-    [anon_sym_height] = ACTIONS(33),
-    [anon_sym_fill] = ACTIONS(33),
-    [anon_sym_stroke] = ACTIONS(33),
-    [anon_sym_corner] = ACTIONS(33),
-    [anon_sym_opacity] = ACTIONS(33),
-    [anon_sym_font] = ACTIONS(33),
-    [anon_sym_bg] = ACTIONS(33),
-    [anon_sym_use] = ACTIONS(33),
-    [anon_sym_layout] = ACTIONS(33),
-    [anon_sym_shadow] = ACTIONS(33),
-    [anon_sym_scale] = ACTIONS(33),
-    [anon_sym_rotate] = ACTIONS(33),
-    [anon_sym_translate] = ACTIONS(33),
-    [anon_sym_center_in] = ACTIONS(33),
-    [anon_sym_offset] = ACTIONS(33),
-    [anon_sym_ease] = ACTIONS(33),
-    [anon_sym_duration] = ACTIONS(33),
-    [anon_sym_when] = ACTIONS(33),
-    [anon_sym_anim] = ACTIONS(33),
-    [anon_sym_AT] = ACTIONS(37),
-    [sym_identifier] = ACTIONS(40),
-    [sym_number] = ACTIONS(43),
-    [sym_hex_color] = ACTIONS(43),
-    [anon_sym_DQUOTE] = ACTIONS(46),
-  },
-  [STATE(5)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(9),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(9),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(49),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(6)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(7),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(7),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(57),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(7)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(9),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(9),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(59),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(8)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(9),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(9),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(61),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(9)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(9),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(9),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(63),
-    [anon_sym_RBRACE] = ACTIONS(66),
-    [anon_sym_group] = ACTIONS(68),
-    [anon_sym_rect] = ACTIONS(68),
-    [anon_sym_ellipse] = ACTIONS(68),
-    [anon_sym_path] = ACTIONS(68),
-    [anon_sym_text] = ACTIONS(68),
-    [anon_sym_w] = ACTIONS(71),
-    [anon_sym_h] = ACTIONS(71),
-    [anon_sym_width] = ACTIONS(74),
-    [anon_sym_height] = ACTIONS(74),
-    [anon_sym_fill] = ACTIONS(74),
-    [anon_sym_stroke] = ACTIONS(74),
-    [anon_sym_corner] = ACTIONS(74),
-    [anon_sym_opacity] = ACTIONS(74),
-    [anon_sym_font] = ACTIONS(74),
-    [anon_sym_bg] = ACTIONS(74),
-    [anon_sym_use] = ACTIONS(74),
-    [anon_sym_layout] = ACTIONS(74),
-    [anon_sym_shadow] = ACTIONS(74),
-    [anon_sym_scale] = ACTIONS(74),
-    [anon_sym_rotate] = ACTIONS(74),
-    [anon_sym_translate] = ACTIONS(74),
-    [anon_sym_center_in] = ACTIONS(74),
-    [anon_sym_offset] = ACTIONS(74),
-    [anon_sym_ease] = ACTIONS(74),
-    [anon_sym_duration] = ACTIONS(74),
-    [anon_sym_when] = ACTIONS(77),
-    [anon_sym_anim] = ACTIONS(77),
-  },
-  [STATE(10)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(5),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(5),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(80),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(11)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(12),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(12),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(82),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(12)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(9),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(9),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(84),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(13)] = {
-    [sym_spec_block] = STATE(31),
-    [sym_node_declaration] = STATE(31),
-    [sym_node_kind] = STATE(62),
-    [sym_node_body_item] = STATE(8),
-    [sym_property] = STATE(31),
-    [sym_property_name] = STATE(92),
-    [sym_anim_block] = STATE(31),
-    [aux_sym_node_declaration_repeat1] = STATE(8),
-    [sym_comment] = ACTIONS(7),
-    [anon_sym_spec] = ACTIONS(9),
-    [anon_sym_RBRACE] = ACTIONS(86),
-    [anon_sym_group] = ACTIONS(13),
-    [anon_sym_rect] = ACTIONS(13),
-    [anon_sym_ellipse] = ACTIONS(13),
-    [anon_sym_path] = ACTIONS(13),
-    [anon_sym_text] = ACTIONS(13),
-    [anon_sym_w] = ACTIONS(51),
-    [anon_sym_h] = ACTIONS(51),
-    [anon_sym_width] = ACTIONS(53),
-    [anon_sym_height] = ACTIONS(53),
-    [anon_sym_fill] = ACTIONS(53),
-    [anon_sym_stroke] = ACTIONS(53),
-    [anon_sym_corner] = ACTIONS(53),
-    [anon_sym_opacity] = ACTIONS(53),
-    [anon_sym_font] = ACTIONS(53),
-    [anon_sym_bg] = ACTIONS(53),
-    [anon_sym_use] = ACTIONS(53),
-    [anon_sym_layout] = ACTIONS(53),
-    [anon_sym_shadow] = ACTIONS(53),
-    [anon_sym_scale] = ACTIONS(53),
-    [anon_sym_rotate] = ACTIONS(53),
-    [anon_sym_translate] = ACTIONS(53),
-    [anon_sym_center_in] = ACTIONS(53),
-    [anon_sym_offset] = ACTIONS(53),
-    [anon_sym_ease] = ACTIONS(53),
-    [anon_sym_duration] = ACTIONS(53),
-    [anon_sym_when] = ACTIONS(55),
-    [anon_sym_anim] = ACTIONS(55),
-  },
-  [STATE(14)] = {
-    [sym_comment] = ACTIONS(3),
-    [anon_sym_spec] = ACTIONS(88),
-    [anon_sym_RBRACE] = ACTIONS(90),
-    [anon_sym_group] = ACTIONS(88),
-    [anon_sym_rect] = ACTIONS(88),
-    [anon_sym_ellipse] = ACTIONS(88),
-    [anon_sym_path] = ACTIONS(88),
-    [anon_sym_text] = ACTIONS(88),
-    [anon_sym_w] = ACTIONS(88),
-    [anon_sym_h] = ACTIONS(88),
-    [anon_sym_width] = ACTIONS(88),
-    [anon_sym_height] = ACTIONS(88),
-    [anon_sym_fill] = ACTIONS(88),
-    [anon_sym_stroke] = ACTIONS(88),
-    [anon_sym_corner] = ACTIONS(88),
-    [anon_sym_opacity] = ACTIONS(88),
-    [anon_sym_font] = ACTIONS(88),
-    [anon_sym_bg] = ACTIONS(88),
-    [anon_sym_use] = ACTIONS(88),
-    [anon_sym_layout] = ACTIONS(88),
-    [anon_sym_shadow] = ACTIONS(88),
-    [anon_sym_scale] = ACTIONS(88),
-    [anon_sym_rotate] = ACTIONS(88),
-    [anon_sym_translate] = ACTIONS(88),
-    [anon_sym_center_in] = ACTIONS(88),
-    [anon_sym_offset] = ACTIONS(88),
-    [anon_sym_ease] = ACTIONS(88),
-    [anon_sym_duration] = ACTIONS(88),
-    [anon_sym_EQ] = ACTIONS(92),
-    [anon_sym_when] = ACTIONS(88),
-    [anon_sym_anim] = ACTIONS(88),
-    [anon_sym_AT] = ACTIONS(90),
-    [sym_identifier] = ACTIONS(88),
-    [sym_number] = ACTIONS(90),
-    [sym_hex_color] = ACTIONS(90),
-    [anon_sym_DQUOTE] = ACTIONS(90),
+    [anon_sym_import] = ACTIONS(7),
+    [sym_comment] = ACTIONS(9),
+    [anon_sym_spec] = ACTIONS(11),
+    [anon_sym_theme] = ACTIONS(13),
+    [anon_sym_style] = ACTIONS(13),
+    [anon_sym_group] = ACTIONS(15),
+    [anon_sym_frame] = ACTIONS(15),
+    [anon_sym_rect] = ACTIONS(15),
+    [anon_sym_ellipse] = ACTIONS(15),
+    [anon_sym_path] = ACTIONS(15),
+    [anon_sym_text] = ACTIONS(15),
+    [anon_sym_edge] = ACTIONS(17),
+    [anon_sym_AT] = ACTIONS(19),
   },
 };
 
 static const uint16_t ts_small_parse_table[] = {
-  [0] = 3,
+  [0] = 9,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(21), 1,
+      ts_builtin_sym_end,
+    ACTIONS(23), 1,
+      sym_identifier,
+    ACTIONS(29), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(31), 1,
+      anon_sym_AT,
+    STATE(6), 1,
+      sym_node_id,
+    ACTIONS(27), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(7), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(25), 11,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+  [45] = 9,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(33), 1,
+      sym_identifier,
+    ACTIONS(39), 1,
+      anon_sym_SEMI,
+    ACTIONS(43), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(45), 1,
+      anon_sym_AT,
+    ACTIONS(37), 2,
+      sym_property_name,
+      anon_sym_RBRACE,
+    ACTIONS(41), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(4), 6,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      sym_node_id,
+      aux_sym_edge_property_repeat1,
+    ACTIONS(35), 9,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+  [90] = 8,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(47), 1,
+      sym_identifier,
+    ACTIONS(57), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(60), 1,
+      anon_sym_AT,
+    ACTIONS(52), 3,
+      sym_property_name,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+    ACTIONS(54), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(4), 6,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      sym_node_id,
+      aux_sym_edge_property_repeat1,
+    ACTIONS(50), 9,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+  [133] = 8,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(33), 1,
+      sym_identifier,
+    ACTIONS(43), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(67), 1,
+      anon_sym_SEMI,
+    ACTIONS(65), 3,
+      sym_property_name,
+      anon_sym_RBRACE,
+      anon_sym_AT,
+    ACTIONS(69), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(8), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(63), 9,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+  [175] = 7,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(23), 1,
+      sym_identifier,
+    ACTIONS(29), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(71), 2,
+      ts_builtin_sym_end,
+      anon_sym_AT,
+    ACTIONS(75), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(9), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(73), 11,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+  [215] = 7,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(23), 1,
+      sym_identifier,
+    ACTIONS(29), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(77), 2,
+      ts_builtin_sym_end,
+      anon_sym_AT,
+    ACTIONS(81), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(10), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(79), 11,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+  [255] = 7,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(83), 1,
+      sym_identifier,
+    ACTIONS(93), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(88), 4,
+      sym_property_name,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_AT,
+    ACTIONS(90), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(8), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(86), 9,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+  [295] = 7,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(23), 1,
+      sym_identifier,
+    ACTIONS(29), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(96), 2,
+      ts_builtin_sym_end,
+      anon_sym_AT,
+    ACTIONS(81), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(10), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(98), 11,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+  [335] = 7,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(100), 1,
+      sym_identifier,
+    ACTIONS(106), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(88), 2,
+      ts_builtin_sym_end,
+      anon_sym_AT,
+    ACTIONS(103), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(10), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+    ACTIONS(86), 11,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+  [375] = 12,
+    ACTIONS(7), 1,
+      anon_sym_import,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(11), 1,
+      anon_sym_spec,
+    ACTIONS(17), 1,
+      anon_sym_edge,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(109), 1,
+      ts_builtin_sym_end,
+    STATE(37), 1,
+      sym__typed_node,
+    STATE(83), 1,
+      sym_node_kind,
+    STATE(101), 1,
+      sym_node_id,
+    ACTIONS(13), 2,
+      anon_sym_theme,
+      anon_sym_style,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+    STATE(12), 7,
+      sym_import_declaration,
+      sym_spec_block,
+      sym_style_block,
+      sym_node_declaration,
+      sym_edge_block,
+      sym_constraint_line,
+      aux_sym_document_repeat1,
+  [424] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(111), 1,
+      ts_builtin_sym_end,
+    ACTIONS(113), 1,
+      anon_sym_import,
+    ACTIONS(116), 1,
+      anon_sym_spec,
+    ACTIONS(125), 1,
+      anon_sym_edge,
+    ACTIONS(128), 1,
+      anon_sym_AT,
+    STATE(37), 1,
+      sym__typed_node,
+    STATE(83), 1,
+      sym_node_kind,
+    STATE(101), 1,
+      sym_node_id,
+    ACTIONS(119), 2,
+      anon_sym_theme,
+      anon_sym_style,
+    ACTIONS(122), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+    STATE(12), 7,
+      sym_import_declaration,
+      sym_spec_block,
+      sym_style_block,
+      sym_node_declaration,
+      sym_edge_block,
+      sym_constraint_line,
+      aux_sym_document_repeat1,
+  [473] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(133), 1,
+      anon_sym_RBRACE,
+    ACTIONS(137), 1,
+      sym_property_name,
+    STATE(60), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    STATE(108), 1,
+      sym_node_id,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(14), 2,
+      sym_node_body_item,
+      aux_sym__node_body_repeat1,
+    STATE(56), 4,
+      sym_spec_block,
+      sym_node_declaration,
+      sym_property,
+      sym_anim_block,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [520] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(139), 1,
+      anon_sym_RBRACE,
+    STATE(60), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    STATE(108), 1,
+      sym_node_id,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(15), 2,
+      sym_node_body_item,
+      aux_sym__node_body_repeat1,
+    STATE(56), 4,
+      sym_spec_block,
+      sym_node_declaration,
+      sym_property,
+      sym_anim_block,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [567] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(141), 1,
+      anon_sym_spec,
+    ACTIONS(144), 1,
+      anon_sym_RBRACE,
+    ACTIONS(152), 1,
+      anon_sym_AT,
+    ACTIONS(155), 1,
+      sym_property_name,
+    STATE(60), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    STATE(108), 1,
+      sym_node_id,
+    ACTIONS(149), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(15), 2,
+      sym_node_body_item,
+      aux_sym__node_body_repeat1,
+    STATE(56), 4,
+      sym_spec_block,
+      sym_node_declaration,
+      sym_property,
+      sym_anim_block,
+    ACTIONS(146), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [614] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(162), 1,
+      anon_sym_EQ,
+    ACTIONS(164), 1,
+      anon_sym_LPAREN,
+    ACTIONS(160), 8,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(158), 11,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_LPAREN2,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [647] = 5,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(166), 1,
+      anon_sym_EQ,
+    ACTIONS(168), 1,
+      anon_sym_LPAREN,
+    ACTIONS(160), 6,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(158), 13,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      anon_sym_LPAREN2,
+      sym_identifier,
+  [680] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(170), 1,
+      anon_sym_RBRACE,
+    STATE(60), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    STATE(108), 1,
+      sym_node_id,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(19), 2,
+      sym_node_body_item,
+      aux_sym__node_body_repeat1,
+    STATE(56), 4,
+      sym_spec_block,
+      sym_node_declaration,
+      sym_property,
+      sym_anim_block,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [727] = 12,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(172), 1,
+      anon_sym_RBRACE,
+    STATE(60), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    STATE(108), 1,
+      sym_node_id,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(15), 2,
+      sym_node_body_item,
+      aux_sym__node_body_repeat1,
+    STATE(56), 4,
+      sym_spec_block,
+      sym_node_declaration,
+      sym_property,
+      sym_anim_block,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [774] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(176), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(174), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [801] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(180), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(178), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [828] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(184), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(182), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [855] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(188), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(186), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [882] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(192), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(190), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [909] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(176), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(174), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [936] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(180), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(178), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [963] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(184), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(182), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [990] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(188), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(186), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [1017] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(192), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(190), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [1044] = 3,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(196), 9,
+      sym_property_name,
+      sym_string,
+      anon_sym_RBRACE,
+      anon_sym_SEMI,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(194), 10,
+      anon_sym_spec,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      sym_identifier,
+  [1071] = 3,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(96), 5,
+    ACTIONS(196), 7,
+      sym_string,
+      ts_builtin_sym_end,
+      anon_sym_COMMA,
+      anon_sym_LPAREN2,
+      anon_sym_AT,
+      sym_number,
+      sym_hex_color,
+    ACTIONS(194), 12,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      sym_identifier,
+  [1098] = 9,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(198), 1,
+      anon_sym_RBRACE,
+    ACTIONS(200), 1,
+      sym_property_name,
+    STATE(71), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(33), 4,
+      sym_spec_block,
+      sym_edge_property,
+      sym_anim_block,
+      aux_sym_edge_block_repeat1,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [1135] = 9,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(200), 1,
+      sym_property_name,
+    ACTIONS(202), 1,
+      anon_sym_RBRACE,
+    STATE(71), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(35), 4,
+      sym_spec_block,
+      sym_edge_property,
+      sym_anim_block,
+      aux_sym_edge_block_repeat1,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [1172] = 9,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(200), 1,
+      sym_property_name,
+    ACTIONS(204), 1,
+      anon_sym_RBRACE,
+    STATE(71), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(36), 4,
+      sym_spec_block,
+      sym_edge_property,
+      sym_anim_block,
+      aux_sym_edge_block_repeat1,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [1209] = 9,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(206), 1,
+      anon_sym_spec,
+    ACTIONS(209), 1,
+      anon_sym_RBRACE,
+    ACTIONS(217), 1,
+      sym_property_name,
+    STATE(71), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    ACTIONS(214), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(35), 4,
+      sym_spec_block,
+      sym_edge_property,
+      sym_anim_block,
+      aux_sym_edge_block_repeat1,
+    ACTIONS(211), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [1246] = 9,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(131), 1,
+      anon_sym_spec,
+    ACTIONS(200), 1,
+      sym_property_name,
+    ACTIONS(220), 1,
       anon_sym_RBRACE,
+    STATE(71), 1,
+      sym__typed_node,
+    STATE(89), 1,
+      sym_node_kind,
+    ACTIONS(135), 2,
+      anon_sym_when,
+      anon_sym_anim,
+    STATE(35), 4,
+      sym_spec_block,
+      sym_edge_property,
+      sym_anim_block,
+      aux_sym_edge_block_repeat1,
+    ACTIONS(15), 6,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+  [1283] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(222), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
+      anon_sym_AT,
+  [1302] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(224), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(94), 29,
+  [1321] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(226), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
-      sym_identifier,
-  [42] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(17), 5,
-      anon_sym_RBRACE,
+      anon_sym_edge,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(19), 29,
+  [1340] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(228), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
-      sym_identifier,
-  [84] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(100), 5,
-      anon_sym_RBRACE,
+      anon_sym_edge,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(98), 29,
+  [1359] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(230), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
-      sym_identifier,
-  [126] = 3,
-    ACTIONS(7), 1,
+      anon_sym_edge,
+      anon_sym_AT,
+  [1378] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(104), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(102), 31,
+    ACTIONS(232), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [167] = 3,
-    ACTIONS(7), 1,
+  [1397] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(108), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(106), 31,
+    ACTIONS(234), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [208] = 3,
-    ACTIONS(7), 1,
+  [1416] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(112), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(110), 31,
+    ACTIONS(236), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [249] = 3,
-    ACTIONS(7), 1,
+  [1435] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(116), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(114), 31,
+    ACTIONS(238), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [290] = 3,
-    ACTIONS(7), 1,
+  [1454] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(120), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(118), 31,
+    ACTIONS(240), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [331] = 3,
-    ACTIONS(7), 1,
+  [1473] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(124), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(122), 31,
+    ACTIONS(242), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [372] = 3,
-    ACTIONS(7), 1,
+  [1492] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(128), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(126), 31,
+    ACTIONS(244), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [413] = 3,
-    ACTIONS(7), 1,
+  [1511] = 6,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(43), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(45), 1,
+      anon_sym_AT,
+    ACTIONS(246), 1,
+      sym_identifier,
+    ACTIONS(248), 4,
+      sym_string,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+    STATE(3), 6,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      sym_node_id,
+      aux_sym_edge_property_repeat1,
+  [1538] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(132), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(130), 31,
+    ACTIONS(250), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [454] = 3,
-    ACTIONS(7), 1,
+  [1557] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(136), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(134), 31,
+    ACTIONS(252), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [495] = 3,
-    ACTIONS(7), 1,
+  [1576] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(140), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(138), 31,
+    ACTIONS(254), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [536] = 3,
-    ACTIONS(7), 1,
+  [1595] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(144), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(142), 31,
+    ACTIONS(256), 13,
       ts_builtin_sym_end,
+      anon_sym_import,
       anon_sym_spec,
-      anon_sym_RBRACE,
       anon_sym_theme,
       anon_sym_style,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      anon_sym_when,
-      anon_sym_anim,
+      anon_sym_edge,
       anon_sym_AT,
-  [577] = 8,
-    ACTIONS(3), 1,
+  [1614] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(23), 1,
-      anon_sym_RBRACE,
-    ACTIONS(146), 1,
+    ACTIONS(258), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
       anon_sym_AT,
-    ACTIONS(148), 1,
-      sym_identifier,
-    ACTIONS(152), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(150), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(30), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
-      sym_string,
-      aux_sym_property_repeat1,
-    ACTIONS(21), 20,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [626] = 8,
-    ACTIONS(3), 1,
+  [1633] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(35), 1,
-      anon_sym_RBRACE,
-    ACTIONS(154), 1,
+    ACTIONS(260), 13,
+      ts_builtin_sym_end,
+      anon_sym_import,
+      anon_sym_spec,
+      anon_sym_theme,
+      anon_sym_style,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_edge,
       anon_sym_AT,
-    ACTIONS(157), 1,
-      sym_identifier,
-    ACTIONS(163), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(160), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(30), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
-      sym_string,
-      aux_sym_property_repeat1,
-    ACTIONS(33), 20,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [675] = 3,
-    ACTIONS(7), 1,
+  [1652] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(168), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(166), 27,
+    ACTIONS(262), 12,
+      sym_property_name,
       anon_sym_spec,
       anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
       anon_sym_when,
       anon_sym_anim,
-  [712] = 3,
-    ACTIONS(7), 1,
+      anon_sym_AT,
+  [1670] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(172), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(170), 27,
+    ACTIONS(264), 12,
+      sym_property_name,
       anon_sym_spec,
       anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
       anon_sym_when,
       anon_sym_anim,
-  [749] = 3,
-    ACTIONS(7), 1,
+      anon_sym_AT,
+  [1688] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(176), 2,
-      anon_sym_w,
-      anon_sym_h,
-    ACTIONS(174), 27,
+    ACTIONS(266), 12,
+      sym_property_name,
       anon_sym_spec,
       anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
       anon_sym_when,
       anon_sym_anim,
-  [786] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(178), 1,
-      anon_sym_EQ,
-    ACTIONS(90), 5,
-      anon_sym_RBRACE,
-      anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(88), 21,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      sym_identifier,
-  [823] = 3,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(17), 5,
-      anon_sym_RBRACE,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(19), 21,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      sym_identifier,
-  [857] = 3,
-    ACTIONS(3), 1,
+  [1706] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(100), 5,
+    ACTIONS(268), 12,
+      sym_property_name,
+      anon_sym_spec,
       anon_sym_RBRACE,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(98), 21,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      sym_identifier,
-  [891] = 3,
-    ACTIONS(3), 1,
+  [1724] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(96), 5,
+    ACTIONS(222), 12,
+      sym_property_name,
+      anon_sym_spec,
       anon_sym_RBRACE,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(94), 21,
-      anon_sym_w,
-      anon_sym_h,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-      sym_identifier,
-  [925] = 6,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(180), 1,
-      anon_sym_RBRACE,
-    STATE(96), 1,
-      sym_property_name,
-    ACTIONS(51), 2,
-      anon_sym_w,
-      anon_sym_h,
-    STATE(41), 2,
-      sym_property,
-      aux_sym_style_block_repeat1,
-    ACTIONS(53), 18,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [963] = 6,
-    ACTIONS(7), 1,
+  [1742] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(182), 1,
-      anon_sym_RBRACE,
-    STATE(96), 1,
+    ACTIONS(224), 12,
       sym_property_name,
-    ACTIONS(184), 2,
-      anon_sym_w,
-      anon_sym_h,
-    STATE(39), 2,
-      sym_property,
-      aux_sym_style_block_repeat1,
-    ACTIONS(187), 18,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [1001] = 6,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(190), 1,
+      anon_sym_spec,
       anon_sym_RBRACE,
-    STATE(96), 1,
-      sym_property_name,
-    ACTIONS(51), 2,
-      anon_sym_w,
-      anon_sym_h,
-    STATE(42), 2,
-      sym_property,
-      aux_sym_style_block_repeat1,
-    ACTIONS(53), 18,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [1039] = 6,
-    ACTIONS(7), 1,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1760] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(192), 1,
-      anon_sym_RBRACE,
-    STATE(96), 1,
+    ACTIONS(226), 12,
       sym_property_name,
-    ACTIONS(51), 2,
-      anon_sym_w,
-      anon_sym_h,
-    STATE(39), 2,
-      sym_property,
-      aux_sym_style_block_repeat1,
-    ACTIONS(53), 18,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [1077] = 6,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(194), 1,
+      anon_sym_spec,
       anon_sym_RBRACE,
-    STATE(96), 1,
-      sym_property_name,
-    ACTIONS(51), 2,
-      anon_sym_w,
-      anon_sym_h,
-    STATE(39), 2,
-      sym_property,
-      aux_sym_style_block_repeat1,
-    ACTIONS(53), 18,
-      anon_sym_width,
-      anon_sym_height,
-      anon_sym_fill,
-      anon_sym_stroke,
-      anon_sym_corner,
-      anon_sym_opacity,
-      anon_sym_font,
-      anon_sym_bg,
-      anon_sym_use,
-      anon_sym_layout,
-      anon_sym_shadow,
-      anon_sym_scale,
-      anon_sym_rotate,
-      anon_sym_translate,
-      anon_sym_center_in,
-      anon_sym_offset,
-      anon_sym_ease,
-      anon_sym_duration,
-  [1115] = 8,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(196), 1,
-      ts_builtin_sym_end,
-    ACTIONS(200), 1,
-      anon_sym_AT,
-    ACTIONS(202), 1,
-      sym_identifier,
-    ACTIONS(206), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(204), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(44), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
-      sym_string,
-      aux_sym_property_repeat1,
-    ACTIONS(198), 8,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1778] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(228), 12,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-  [1152] = 8,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(35), 1,
-      ts_builtin_sym_end,
-    ACTIONS(208), 1,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-    ACTIONS(211), 1,
-      sym_identifier,
-    ACTIONS(217), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(214), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(44), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
-      sym_string,
-      aux_sym_property_repeat1,
-    ACTIONS(33), 8,
+  [1796] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(230), 12,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-  [1189] = 9,
-    ACTIONS(7), 1,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1814] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(220), 1,
-      ts_builtin_sym_end,
-    ACTIONS(222), 1,
+    ACTIONS(234), 12,
+      sym_property_name,
       anon_sym_spec,
-    ACTIONS(231), 1,
-      anon_sym_AT,
-    STATE(62), 1,
-      sym_node_kind,
-    STATE(83), 1,
-      sym_node_id,
-    ACTIONS(225), 2,
-      anon_sym_theme,
-      anon_sym_style,
-    ACTIONS(228), 5,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-    STATE(45), 5,
-      sym_spec_block,
-      sym_style_block,
-      sym_node_declaration,
-      sym_constraint_line,
-      aux_sym_document_repeat1,
-  [1226] = 9,
-    ACTIONS(7), 1,
-      sym_comment,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1832] = 2,
     ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(236), 12,
+      sym_property_name,
       anon_sym_spec,
-    ACTIONS(15), 1,
-      anon_sym_AT,
-    ACTIONS(234), 1,
-      ts_builtin_sym_end,
-    STATE(62), 1,
-      sym_node_kind,
-    STATE(83), 1,
-      sym_node_id,
-    ACTIONS(11), 2,
-      anon_sym_theme,
-      anon_sym_style,
-    ACTIONS(13), 5,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-    STATE(45), 5,
-      sym_spec_block,
-      sym_style_block,
-      sym_node_declaration,
-      sym_constraint_line,
-      aux_sym_document_repeat1,
-  [1263] = 4,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(236), 1,
-      anon_sym_EQ,
-    ACTIONS(90), 5,
-      ts_builtin_sym_end,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(88), 9,
+  [1850] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(238), 12,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      sym_identifier,
-  [1288] = 3,
-    ACTIONS(3), 1,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1868] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(100), 5,
-      ts_builtin_sym_end,
+    ACTIONS(242), 12,
+      sym_property_name,
+      anon_sym_spec,
+      anon_sym_RBRACE,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(98), 9,
+  [1886] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(254), 12,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      sym_identifier,
-  [1310] = 3,
-    ACTIONS(3), 1,
+      anon_sym_when,
+      anon_sym_anim,
+      anon_sym_AT,
+  [1904] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(96), 5,
-      ts_builtin_sym_end,
+    ACTIONS(256), 12,
+      sym_property_name,
+      anon_sym_spec,
+      anon_sym_RBRACE,
+      anon_sym_group,
+      anon_sym_frame,
+      anon_sym_rect,
+      anon_sym_ellipse,
+      anon_sym_path,
+      anon_sym_text,
+      anon_sym_when,
+      anon_sym_anim,
       anon_sym_AT,
-      sym_number,
-      sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(94), 9,
+  [1922] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(270), 11,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      sym_identifier,
-  [1332] = 3,
+      anon_sym_when,
+      anon_sym_anim,
+  [1939] = 5,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(17), 5,
-      ts_builtin_sym_end,
-      anon_sym_AT,
+    ACTIONS(43), 1,
+      anon_sym_LPAREN2,
+    ACTIONS(246), 1,
+      sym_identifier,
+    ACTIONS(272), 4,
+      sym_string,
+      anon_sym_COMMA,
       sym_number,
       sym_hex_color,
-      anon_sym_DQUOTE,
-    ACTIONS(19), 9,
+    STATE(5), 5,
+      sym__value_item,
+      sym_key_value_pair,
+      sym_gradient,
+      sym_tuple,
+      aux_sym_property_repeat1,
+  [1962] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(274), 11,
+      sym_property_name,
       anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
+      anon_sym_RBRACE,
       anon_sym_group,
+      anon_sym_frame,
       anon_sym_rect,
       anon_sym_ellipse,
       anon_sym_path,
       anon_sym_text,
-      sym_identifier,
-  [1354] = 7,
-    ACTIONS(7), 1,
+      anon_sym_when,
+      anon_sym_anim,
+  [1979] = 7,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(238), 1,
+    ACTIONS(276), 1,
       anon_sym_RBRACE,
-    ACTIONS(243), 1,
-      anon_sym_DQUOTE,
-    STATE(82), 1,
+    ACTIONS(280), 1,
+      sym_string,
+    STATE(79), 1,
+      sym_spec_typed,
+    STATE(125), 1,
       sym_spec_keyword,
-    STATE(51), 2,
+    STATE(75), 2,
       sym_spec_item,
       aux_sym_spec_block_repeat1,
-    STATE(59), 2,
-      sym_spec_typed,
-      sym_string,
-    ACTIONS(240), 4,
+    ACTIONS(278), 4,
       anon_sym_accept,
       anon_sym_status,
       anon_sym_priority,
       anon_sym_tag,
-  [1381] = 7,
-    ACTIONS(7), 1,
+  [2005] = 7,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(246), 1,
+    ACTIONS(280), 1,
+      sym_string,
+    ACTIONS(282), 1,
       anon_sym_RBRACE,
-    ACTIONS(250), 1,
-      anon_sym_DQUOTE,
-    STATE(82), 1,
+    STATE(79), 1,
+      sym_spec_typed,
+    STATE(125), 1,
       sym_spec_keyword,
-    STATE(51), 2,
+    STATE(76), 2,
       sym_spec_item,
       aux_sym_spec_block_repeat1,
-    STATE(59), 2,
-      sym_spec_typed,
-      sym_string,
-    ACTIONS(248), 4,
+    ACTIONS(278), 4,
       anon_sym_accept,
       anon_sym_status,
       anon_sym_priority,
       anon_sym_tag,
-  [1408] = 7,
-    ACTIONS(7), 1,
+  [2031] = 7,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(250), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(252), 1,
+    ACTIONS(284), 1,
       anon_sym_RBRACE,
-    STATE(82), 1,
+    ACTIONS(289), 1,
+      sym_string,
+    STATE(79), 1,
+      sym_spec_typed,
+    STATE(125), 1,
       sym_spec_keyword,
-    STATE(52), 2,
+    STATE(76), 2,
       sym_spec_item,
       aux_sym_spec_block_repeat1,
-    STATE(59), 2,
-      sym_spec_typed,
-      sym_string,
-    ACTIONS(248), 4,
+    ACTIONS(286), 4,
       anon_sym_accept,
       anon_sym_status,
       anon_sym_priority,
       anon_sym_tag,
-  [1435] = 6,
-    ACTIONS(3), 1,
-      sym_comment,
-    ACTIONS(146), 1,
-      anon_sym_AT,
-    ACTIONS(152), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(254), 1,
-      sym_identifier,
-    ACTIONS(256), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(29), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
-      sym_string,
-      aux_sym_property_repeat1,
-  [1459] = 6,
-    ACTIONS(3), 1,
+  [2057] = 7,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(200), 1,
-      anon_sym_AT,
-    ACTIONS(206), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(258), 1,
-      sym_identifier,
-    ACTIONS(260), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(43), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
+    ACTIONS(280), 1,
       sym_string,
-      aux_sym_property_repeat1,
-  [1483] = 6,
-    ACTIONS(3), 1,
+    ACTIONS(292), 1,
+      anon_sym_RBRACE,
+    STATE(79), 1,
+      sym_spec_typed,
+    STATE(125), 1,
+      sym_spec_keyword,
+    STATE(78), 2,
+      sym_spec_item,
+      aux_sym_spec_block_repeat1,
+    ACTIONS(278), 4,
+      anon_sym_accept,
+      anon_sym_status,
+      anon_sym_priority,
+      anon_sym_tag,
+  [2083] = 7,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(25), 1,
-      anon_sym_AT,
-    ACTIONS(31), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(262), 1,
-      sym_identifier,
-    ACTIONS(264), 2,
-      sym_number,
-      sym_hex_color,
-    STATE(3), 5,
-      sym__value_item,
-      sym_key_value_pair,
-      sym_node_id,
+    ACTIONS(280), 1,
       sym_string,
-      aux_sym_property_repeat1,
-  [1507] = 2,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(266), 10,
-      ts_builtin_sym_end,
-      anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
-      anon_sym_group,
-      anon_sym_rect,
-      anon_sym_ellipse,
-      anon_sym_path,
-      anon_sym_text,
-      anon_sym_AT,
-  [1523] = 2,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(268), 10,
-      ts_builtin_sym_end,
-      anon_sym_spec,
-      anon_sym_theme,
-      anon_sym_style,
-      anon_sym_group,
-      anon_sym_rect,
-      anon_sym_ellipse,
-      anon_sym_path,
-      anon_sym_text,
-      anon_sym_AT,
-  [1539] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(294), 1,
+      anon_sym_RBRACE,
+    STATE(79), 1,
+      sym_spec_typed,
+    STATE(125), 1,
+      sym_spec_keyword,
+    STATE(76), 2,
+      sym_spec_item,
+      aux_sym_spec_block_repeat1,
+    ACTIONS(278), 4,
+      anon_sym_accept,
+      anon_sym_status,
+      anon_sym_priority,
+      anon_sym_tag,
+  [2109] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(270), 6,
+    ACTIONS(296), 6,
+      sym_string,
       anon_sym_RBRACE,
       anon_sym_accept,
       anon_sym_status,
       anon_sym_priority,
       anon_sym_tag,
-      anon_sym_DQUOTE,
-  [1551] = 2,
-    ACTIONS(7), 1,
+  [2121] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(272), 6,
+    ACTIONS(298), 6,
+      sym_string,
       anon_sym_RBRACE,
       anon_sym_accept,
       anon_sym_status,
       anon_sym_priority,
       anon_sym_tag,
-      anon_sym_DQUOTE,
-  [1563] = 4,
+  [2133] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(31), 1,
-      anon_sym_DQUOTE,
-    STATE(15), 1,
+    ACTIONS(43), 1,
+      anon_sym_LPAREN2,
+    STATE(22), 1,
+      sym_tuple,
+    ACTIONS(300), 4,
       sym_string,
-    ACTIONS(274), 3,
       sym_identifier,
       sym_number,
       sym_hex_color,
-  [1578] = 6,
-    ACTIONS(7), 1,
+  [2149] = 4,
+    ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(15), 1,
-      anon_sym_AT,
-    ACTIONS(250), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(276), 1,
+    ACTIONS(29), 1,
+      anon_sym_LPAREN2,
+    STATE(27), 1,
+      sym_tuple,
+    ACTIONS(302), 4,
+      sym_string,
+      sym_identifier,
+      sym_number,
+      sym_hex_color,
+  [2165] = 6,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(304), 1,
       anon_sym_LBRACE,
-    STATE(66), 1,
-      sym_node_id,
-    STATE(72), 1,
+    ACTIONS(306), 1,
+      anon_sym_AT,
+    ACTIONS(308), 1,
       sym_string,
-  [1597] = 4,
+    STATE(39), 1,
+      sym__node_body,
+    STATE(102), 1,
+      sym_node_id,
+  [2184] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(206), 1,
-      anon_sym_DQUOTE,
-    STATE(49), 1,
-      sym_string,
-    ACTIONS(278), 3,
-      sym_identifier,
+    ACTIONS(312), 1,
+      anon_sym_RPAREN,
+    STATE(85), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(310), 3,
+      anon_sym_COMMA,
       sym_number,
       sym_hex_color,
-  [1612] = 4,
+  [2199] = 4,
     ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(152), 1,
-      anon_sym_DQUOTE,
-    STATE(37), 1,
+    ACTIONS(316), 1,
+      anon_sym_RPAREN,
+    STATE(87), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(314), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2214] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(320), 1,
+      anon_sym_RPAREN,
+    STATE(88), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(318), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2229] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(325), 1,
+      anon_sym_RPAREN,
+    STATE(87), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(322), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2244] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(327), 1,
+      anon_sym_RPAREN,
+    STATE(87), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(314), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2259] = 6,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(306), 1,
+      anon_sym_AT,
+    ACTIONS(329), 1,
+      anon_sym_LBRACE,
+    ACTIONS(331), 1,
       sym_string,
-    ACTIONS(280), 3,
-      sym_identifier,
+    STATE(62), 1,
+      sym__node_body,
+    STATE(103), 1,
+      sym_node_id,
+  [2278] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(335), 1,
+      anon_sym_RPAREN,
+    STATE(91), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(333), 3,
+      anon_sym_COMMA,
       sym_number,
       sym_hex_color,
-  [1627] = 2,
-    ACTIONS(7), 1,
+  [2293] = 4,
+    ACTIONS(3), 1,
       sym_comment,
-    ACTIONS(100), 3,
+    ACTIONS(337), 1,
+      anon_sym_RPAREN,
+    STATE(87), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(314), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2308] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(341), 1,
+      anon_sym_RPAREN,
+    STATE(93), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(339), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2323] = 4,
+    ACTIONS(3), 1,
+      sym_comment,
+    ACTIONS(343), 1,
+      anon_sym_RPAREN,
+    STATE(87), 1,
+      aux_sym_gradient_repeat1,
+    ACTIONS(314), 3,
+      anon_sym_COMMA,
+      sym_number,
+      sym_hex_color,
+  [2338] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(345), 1,
+      anon_sym_RBRACE,
+    STATE(95), 2,
+      sym_property,
+      aux_sym_style_block_repeat1,
+  [2352] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(347), 1,
+      anon_sym_RBRACE,
+    STATE(96), 2,
+      sym_property,
+      aux_sym_style_block_repeat1,
+  [2366] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(349), 1,
+      anon_sym_RBRACE,
+    ACTIONS(351), 1,
+      sym_property_name,
+    STATE(96), 2,
+      sym_property,
+      aux_sym_style_block_repeat1,
+  [2380] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(354), 1,
+      anon_sym_RBRACE,
+    STATE(98), 2,
+      sym_property,
+      aux_sym_style_block_repeat1,
+  [2394] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(137), 1,
+      sym_property_name,
+    ACTIONS(356), 1,
+      anon_sym_RBRACE,
+    STATE(96), 2,
+      sym_property,
+      aux_sym_style_block_repeat1,
+  [2408] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(358), 3,
+      sym_string,
+      anon_sym_LBRACE,
+      anon_sym_AT,
+  [2417] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(19), 1,
+      anon_sym_AT,
+    ACTIONS(360), 1,
       anon_sym_LBRACE,
+    STATE(121), 1,
+      sym_node_id,
+  [2430] = 4,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(304), 1,
+      anon_sym_LBRACE,
+    ACTIONS(362), 1,
       anon_sym_DASH_GT,
-      anon_sym_DQUOTE,
-  [1636] = 4,
-    ACTIONS(7), 1,
+    STATE(40), 1,
+      sym__node_body,
+  [2443] = 4,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(250), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(282), 1,
+    ACTIONS(304), 1,
       anon_sym_LBRACE,
-    STATE(79), 1,
+    ACTIONS(364), 1,
       sym_string,
-  [1649] = 2,
-    ACTIONS(7), 1,
+    STATE(45), 1,
+      sym__node_body,
+  [2456] = 4,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(284), 3,
+    ACTIONS(329), 1,
       anon_sym_LBRACE,
-      anon_sym_AT,
-      anon_sym_DQUOTE,
-  [1658] = 4,
-    ACTIONS(7), 1,
+    ACTIONS(366), 1,
+      sym_string,
+    STATE(67), 1,
+      sym__node_body,
+  [2469] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(250), 1,
-      anon_sym_DQUOTE,
-    ACTIONS(286), 1,
+    ACTIONS(368), 1,
       anon_sym_LBRACE,
-    STATE(24), 1,
+    ACTIONS(370), 1,
       sym_string,
-  [1671] = 4,
-    ACTIONS(3), 1,
+  [2479] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(288), 1,
-      sym_spec_text,
-    ACTIONS(290), 1,
-      anon_sym_DQUOTE,
-    STATE(60), 1,
-      sym_string,
-  [1684] = 3,
-    ACTIONS(7), 1,
+    ACTIONS(196), 2,
+      anon_sym_LBRACE,
+      anon_sym_DASH_GT,
+  [2487] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(292), 1,
+    ACTIONS(304), 1,
+      anon_sym_LBRACE,
+    STATE(43), 1,
+      sym__node_body,
+  [2497] = 3,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(372), 1,
       anon_sym_COLON,
-    STATE(76), 1,
+    STATE(130), 1,
       sym_anim_trigger,
-  [1694] = 2,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(294), 1,
-      sym_identifier,
-  [1701] = 2,
-    ACTIONS(7), 1,
+  [2507] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(296), 1,
+    ACTIONS(329), 1,
       anon_sym_LBRACE,
-  [1708] = 2,
-    ACTIONS(7), 1,
-      sym_comment,
-    ACTIONS(298), 1,
-      sym_identifier,
-  [1715] = 2,
-    ACTIONS(7), 1,
+    STATE(63), 1,
+      sym__node_body,
+  [2517] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(300), 1,
-      sym_identifier,
-  [1722] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(304), 1,
+      anon_sym_LBRACE,
+    STATE(53), 1,
+      sym__node_body,
+  [2527] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(302), 1,
-      sym_identifier,
-  [1729] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(374), 2,
+      sym_string,
+      sym_spec_text,
+  [2535] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(304), 1,
+    ACTIONS(196), 2,
+      sym_string,
       anon_sym_LBRACE,
-  [1736] = 2,
-    ACTIONS(7), 1,
+  [2543] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(306), 1,
+    ACTIONS(376), 1,
       anon_sym_LBRACE,
-  [1743] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(378), 1,
+      sym_string,
+  [2553] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(308), 1,
-      ts_builtin_sym_end,
-  [1750] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(329), 1,
+      anon_sym_LBRACE,
+    STATE(65), 1,
+      sym__node_body,
+  [2563] = 3,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(310), 1,
+    ACTIONS(329), 1,
       anon_sym_LBRACE,
-  [1757] = 2,
-    ACTIONS(7), 1,
+    STATE(70), 1,
+      sym__node_body,
+  [2573] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(312), 1,
-      anon_sym_COLON,
-  [1764] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(380), 1,
+      sym_string,
+  [2580] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(314), 1,
-      anon_sym_COLON,
-  [1771] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(382), 1,
+      sym_identifier,
+  [2587] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(316), 1,
-      anon_sym_COLON,
-  [1778] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(384), 1,
+      sym_identifier,
+  [2594] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(318), 1,
-      anon_sym_DASH_GT,
-  [1785] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(386), 1,
+      ts_builtin_sym_end,
+  [2601] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(320), 1,
-      anon_sym_DQUOTE,
-  [1792] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(388), 1,
+      anon_sym_as,
+  [2608] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(322), 1,
-      anon_sym_COLON,
-  [1799] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(390), 1,
+      anon_sym_LBRACE,
+  [2615] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(324), 1,
+    ACTIONS(392), 1,
+      anon_sym_LBRACE,
+  [2622] = 2,
+    ACTIONS(9), 1,
+      sym_comment,
+    ACTIONS(394), 1,
       sym_identifier,
-  [1806] = 2,
-    ACTIONS(7), 1,
+  [2629] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(326), 1,
-      anon_sym_DQUOTE,
-  [1813] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(396), 1,
+      sym_identifier,
+  [2636] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(328), 1,
-      anon_sym_LBRACE,
-  [1820] = 2,
-    ACTIONS(3), 1,
+    ACTIONS(398), 1,
+      anon_sym_COLON,
+  [2643] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(330), 1,
-      aux_sym_string_token1,
-  [1827] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(400), 1,
+      anon_sym_COLON,
+  [2650] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(332), 1,
-      sym_identifier,
-  [1834] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(402), 1,
+      anon_sym_COLON,
+  [2657] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(334), 1,
-      anon_sym_DQUOTE,
-  [1841] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(404), 1,
+      anon_sym_COLON,
+  [2664] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(336), 1,
+    ACTIONS(406), 1,
       anon_sym_COLON,
-  [1848] = 2,
-    ACTIONS(7), 1,
+  [2671] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(338), 1,
+    ACTIONS(408), 1,
       sym_identifier,
-  [1855] = 2,
-    ACTIONS(7), 1,
+  [2678] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(340), 1,
-      anon_sym_DQUOTE,
-  [1862] = 2,
-    ACTIONS(3), 1,
+    ACTIONS(410), 1,
+      anon_sym_LBRACE,
+  [2685] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(342), 1,
-      aux_sym_string_token1,
-  [1869] = 2,
-    ACTIONS(7), 1,
+    ACTIONS(412), 1,
+      anon_sym_LBRACE,
+  [2692] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(344), 1,
-      anon_sym_COLON,
-  [1876] = 2,
-    ACTIONS(3), 1,
+    ACTIONS(414), 1,
+      sym_identifier,
+  [2699] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(346), 1,
-      aux_sym_string_token1,
-  [1883] = 2,
-    ACTIONS(3), 1,
+    ACTIONS(416), 1,
+      sym_identifier,
+  [2706] = 2,
+    ACTIONS(9), 1,
       sym_comment,
-    ACTIONS(348), 1,
-      aux_sym_string_token1,
+    ACTIONS(418), 1,
+      sym_identifier,
 };
 
 static const uint32_t ts_small_parse_table_map[] = {
-  [SMALL_STATE(15)] = 0,
-  [SMALL_STATE(16)] = 42,
-  [SMALL_STATE(17)] = 84,
-  [SMALL_STATE(18)] = 126,
-  [SMALL_STATE(19)] = 167,
-  [SMALL_STATE(20)] = 208,
-  [SMALL_STATE(21)] = 249,
-  [SMALL_STATE(22)] = 290,
-  [SMALL_STATE(23)] = 331,
-  [SMALL_STATE(24)] = 372,
-  [SMALL_STATE(25)] = 413,
-  [SMALL_STATE(26)] = 454,
-  [SMALL_STATE(27)] = 495,
-  [SMALL_STATE(28)] = 536,
-  [SMALL_STATE(29)] = 577,
-  [SMALL_STATE(30)] = 626,
-  [SMALL_STATE(31)] = 675,
-  [SMALL_STATE(32)] = 712,
-  [SMALL_STATE(33)] = 749,
-  [SMALL_STATE(34)] = 786,
-  [SMALL_STATE(35)] = 823,
-  [SMALL_STATE(36)] = 857,
-  [SMALL_STATE(37)] = 891,
-  [SMALL_STATE(38)] = 925,
-  [SMALL_STATE(39)] = 963,
-  [SMALL_STATE(40)] = 1001,
-  [SMALL_STATE(41)] = 1039,
-  [SMALL_STATE(42)] = 1077,
-  [SMALL_STATE(43)] = 1115,
-  [SMALL_STATE(44)] = 1152,
-  [SMALL_STATE(45)] = 1189,
-  [SMALL_STATE(46)] = 1226,
-  [SMALL_STATE(47)] = 1263,
-  [SMALL_STATE(48)] = 1288,
-  [SMALL_STATE(49)] = 1310,
-  [SMALL_STATE(50)] = 1332,
-  [SMALL_STATE(51)] = 1354,
-  [SMALL_STATE(52)] = 1381,
-  [SMALL_STATE(53)] = 1408,
-  [SMALL_STATE(54)] = 1435,
-  [SMALL_STATE(55)] = 1459,
-  [SMALL_STATE(56)] = 1483,
-  [SMALL_STATE(57)] = 1507,
-  [SMALL_STATE(58)] = 1523,
-  [SMALL_STATE(59)] = 1539,
-  [SMALL_STATE(60)] = 1551,
-  [SMALL_STATE(61)] = 1563,
-  [SMALL_STATE(62)] = 1578,
-  [SMALL_STATE(63)] = 1597,
-  [SMALL_STATE(64)] = 1612,
-  [SMALL_STATE(65)] = 1627,
-  [SMALL_STATE(66)] = 1636,
-  [SMALL_STATE(67)] = 1649,
-  [SMALL_STATE(68)] = 1658,
-  [SMALL_STATE(69)] = 1671,
-  [SMALL_STATE(70)] = 1684,
-  [SMALL_STATE(71)] = 1694,
-  [SMALL_STATE(72)] = 1701,
-  [SMALL_STATE(73)] = 1708,
-  [SMALL_STATE(74)] = 1715,
-  [SMALL_STATE(75)] = 1722,
-  [SMALL_STATE(76)] = 1729,
-  [SMALL_STATE(77)] = 1736,
-  [SMALL_STATE(78)] = 1743,
-  [SMALL_STATE(79)] = 1750,
-  [SMALL_STATE(80)] = 1757,
-  [SMALL_STATE(81)] = 1764,
-  [SMALL_STATE(82)] = 1771,
-  [SMALL_STATE(83)] = 1778,
-  [SMALL_STATE(84)] = 1785,
-  [SMALL_STATE(85)] = 1792,
-  [SMALL_STATE(86)] = 1799,
-  [SMALL_STATE(87)] = 1806,
-  [SMALL_STATE(88)] = 1813,
-  [SMALL_STATE(89)] = 1820,
-  [SMALL_STATE(90)] = 1827,
-  [SMALL_STATE(91)] = 1834,
-  [SMALL_STATE(92)] = 1841,
-  [SMALL_STATE(93)] = 1848,
-  [SMALL_STATE(94)] = 1855,
-  [SMALL_STATE(95)] = 1862,
-  [SMALL_STATE(96)] = 1869,
-  [SMALL_STATE(97)] = 1876,
-  [SMALL_STATE(98)] = 1883,
+  [SMALL_STATE(2)] = 0,
+  [SMALL_STATE(3)] = 45,
+  [SMALL_STATE(4)] = 90,
+  [SMALL_STATE(5)] = 133,
+  [SMALL_STATE(6)] = 175,
+  [SMALL_STATE(7)] = 215,
+  [SMALL_STATE(8)] = 255,
+  [SMALL_STATE(9)] = 295,
+  [SMALL_STATE(10)] = 335,
+  [SMALL_STATE(11)] = 375,
+  [SMALL_STATE(12)] = 424,
+  [SMALL_STATE(13)] = 473,
+  [SMALL_STATE(14)] = 520,
+  [SMALL_STATE(15)] = 567,
+  [SMALL_STATE(16)] = 614,
+  [SMALL_STATE(17)] = 647,
+  [SMALL_STATE(18)] = 680,
+  [SMALL_STATE(19)] = 727,
+  [SMALL_STATE(20)] = 774,
+  [SMALL_STATE(21)] = 801,
+  [SMALL_STATE(22)] = 828,
+  [SMALL_STATE(23)] = 855,
+  [SMALL_STATE(24)] = 882,
+  [SMALL_STATE(25)] = 909,
+  [SMALL_STATE(26)] = 936,
+  [SMALL_STATE(27)] = 963,
+  [SMALL_STATE(28)] = 990,
+  [SMALL_STATE(29)] = 1017,
+  [SMALL_STATE(30)] = 1044,
+  [SMALL_STATE(31)] = 1071,
+  [SMALL_STATE(32)] = 1098,
+  [SMALL_STATE(33)] = 1135,
+  [SMALL_STATE(34)] = 1172,
+  [SMALL_STATE(35)] = 1209,
+  [SMALL_STATE(36)] = 1246,
+  [SMALL_STATE(37)] = 1283,
+  [SMALL_STATE(38)] = 1302,
+  [SMALL_STATE(39)] = 1321,
+  [SMALL_STATE(40)] = 1340,
+  [SMALL_STATE(41)] = 1359,
+  [SMALL_STATE(42)] = 1378,
+  [SMALL_STATE(43)] = 1397,
+  [SMALL_STATE(44)] = 1416,
+  [SMALL_STATE(45)] = 1435,
+  [SMALL_STATE(46)] = 1454,
+  [SMALL_STATE(47)] = 1473,
+  [SMALL_STATE(48)] = 1492,
+  [SMALL_STATE(49)] = 1511,
+  [SMALL_STATE(50)] = 1538,
+  [SMALL_STATE(51)] = 1557,
+  [SMALL_STATE(52)] = 1576,
+  [SMALL_STATE(53)] = 1595,
+  [SMALL_STATE(54)] = 1614,
+  [SMALL_STATE(55)] = 1633,
+  [SMALL_STATE(56)] = 1652,
+  [SMALL_STATE(57)] = 1670,
+  [SMALL_STATE(58)] = 1688,
+  [SMALL_STATE(59)] = 1706,
+  [SMALL_STATE(60)] = 1724,
+  [SMALL_STATE(61)] = 1742,
+  [SMALL_STATE(62)] = 1760,
+  [SMALL_STATE(63)] = 1778,
+  [SMALL_STATE(64)] = 1796,
+  [SMALL_STATE(65)] = 1814,
+  [SMALL_STATE(66)] = 1832,
+  [SMALL_STATE(67)] = 1850,
+  [SMALL_STATE(68)] = 1868,
+  [SMALL_STATE(69)] = 1886,
+  [SMALL_STATE(70)] = 1904,
+  [SMALL_STATE(71)] = 1922,
+  [SMALL_STATE(72)] = 1939,
+  [SMALL_STATE(73)] = 1962,
+  [SMALL_STATE(74)] = 1979,
+  [SMALL_STATE(75)] = 2005,
+  [SMALL_STATE(76)] = 2031,
+  [SMALL_STATE(77)] = 2057,
+  [SMALL_STATE(78)] = 2083,
+  [SMALL_STATE(79)] = 2109,
+  [SMALL_STATE(80)] = 2121,
+  [SMALL_STATE(81)] = 2133,
+  [SMALL_STATE(82)] = 2149,
+  [SMALL_STATE(83)] = 2165,
+  [SMALL_STATE(84)] = 2184,
+  [SMALL_STATE(85)] = 2199,
+  [SMALL_STATE(86)] = 2214,
+  [SMALL_STATE(87)] = 2229,
+  [SMALL_STATE(88)] = 2244,
+  [SMALL_STATE(89)] = 2259,
+  [SMALL_STATE(90)] = 2278,
+  [SMALL_STATE(91)] = 2293,
+  [SMALL_STATE(92)] = 2308,
+  [SMALL_STATE(93)] = 2323,
+  [SMALL_STATE(94)] = 2338,
+  [SMALL_STATE(95)] = 2352,
+  [SMALL_STATE(96)] = 2366,
+  [SMALL_STATE(97)] = 2380,
+  [SMALL_STATE(98)] = 2394,
+  [SMALL_STATE(99)] = 2408,
+  [SMALL_STATE(100)] = 2417,
+  [SMALL_STATE(101)] = 2430,
+  [SMALL_STATE(102)] = 2443,
+  [SMALL_STATE(103)] = 2456,
+  [SMALL_STATE(104)] = 2469,
+  [SMALL_STATE(105)] = 2479,
+  [SMALL_STATE(106)] = 2487,
+  [SMALL_STATE(107)] = 2497,
+  [SMALL_STATE(108)] = 2507,
+  [SMALL_STATE(109)] = 2517,
+  [SMALL_STATE(110)] = 2527,
+  [SMALL_STATE(111)] = 2535,
+  [SMALL_STATE(112)] = 2543,
+  [SMALL_STATE(113)] = 2553,
+  [SMALL_STATE(114)] = 2563,
+  [SMALL_STATE(115)] = 2573,
+  [SMALL_STATE(116)] = 2580,
+  [SMALL_STATE(117)] = 2587,
+  [SMALL_STATE(118)] = 2594,
+  [SMALL_STATE(119)] = 2601,
+  [SMALL_STATE(120)] = 2608,
+  [SMALL_STATE(121)] = 2615,
+  [SMALL_STATE(122)] = 2622,
+  [SMALL_STATE(123)] = 2629,
+  [SMALL_STATE(124)] = 2636,
+  [SMALL_STATE(125)] = 2643,
+  [SMALL_STATE(126)] = 2650,
+  [SMALL_STATE(127)] = 2657,
+  [SMALL_STATE(128)] = 2664,
+  [SMALL_STATE(129)] = 2671,
+  [SMALL_STATE(130)] = 2678,
+  [SMALL_STATE(131)] = 2685,
+  [SMALL_STATE(132)] = 2692,
+  [SMALL_STATE(133)] = 2699,
+  [SMALL_STATE(134)] = 2706,
 };
 
 static const TSParseActionEntry ts_parse_actions[] = {
@@ -5279,170 +3803,239 @@ static const TSParseActionEntry ts_parse_actions[] = {
   [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
   [3] = {.entry = {.count = 1, .reusable = false}}, SHIFT_EXTRA(),
   [5] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_document, 0, 0, 0),
-  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT_EXTRA(),
-  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
-  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
-  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
-  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
-  [17] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_string, 3, 0, 0),
-  [19] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_string, 3, 0, 0),
-  [21] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_property, 3, 0, 6),
-  [23] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_property, 3, 0, 6),
-  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
-  [27] = {.entry = {.count = 1, .reusable = false}}, SHIFT(14),
-  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
-  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [33] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0),
-  [35] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0),
-  [37] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(86),
-  [40] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(14),
-  [43] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(4),
-  [46] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(95),
-  [49] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
-  [51] = {.entry = {.count = 1, .reusable = false}}, SHIFT(81),
-  [53] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
-  [55] = {.entry = {.count = 1, .reusable = true}}, SHIFT(70),
-  [57] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
-  [59] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
-  [61] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
-  [63] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0), SHIFT_REPEAT(68),
-  [66] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0),
-  [68] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0), SHIFT_REPEAT(67),
-  [71] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0), SHIFT_REPEAT(81),
-  [74] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0), SHIFT_REPEAT(81),
-  [77] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_node_declaration_repeat1, 2, 0, 0), SHIFT_REPEAT(70),
-  [80] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [82] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
-  [84] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
-  [86] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
-  [88] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__value_item, 1, 0, 0),
-  [90] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__value_item, 1, 0, 0),
-  [92] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
-  [94] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_key_value_pair, 3, 0, 0),
-  [96] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_key_value_pair, 3, 0, 0),
-  [98] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_id, 2, 0, 0),
-  [100] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_id, 2, 0, 0),
-  [102] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 3, 0, 0),
-  [104] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_spec_block, 3, 0, 0),
-  [106] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 4, 0, 3),
-  [108] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 4, 0, 3),
-  [110] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 4, 0, 1),
-  [112] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 4, 0, 1),
-  [114] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 3, 0, 1),
-  [116] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 3, 0, 1),
-  [118] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 4, 0, 4),
-  [120] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 4, 0, 4),
-  [122] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 4, 0, 0),
-  [124] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_spec_block, 4, 0, 0),
-  [126] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 2, 0, 0),
-  [128] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_spec_block, 2, 0, 0),
-  [130] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 5, 0, 7),
-  [132] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 5, 0, 7),
-  [134] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 5, 0, 4),
-  [136] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 5, 0, 4),
-  [138] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 6, 0, 7),
-  [140] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 6, 0, 7),
-  [142] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 5, 0, 3),
-  [144] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_declaration, 5, 0, 3),
-  [146] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
-  [148] = {.entry = {.count = 1, .reusable = false}}, SHIFT(34),
-  [150] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
-  [152] = {.entry = {.count = 1, .reusable = true}}, SHIFT(98),
-  [154] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(93),
-  [157] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(34),
-  [160] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(30),
-  [163] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(98),
-  [166] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_body_item, 1, 0, 0),
-  [168] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_body_item, 1, 0, 0),
-  [170] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_block, 4, 0, 9),
-  [172] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_anim_block, 4, 0, 9),
-  [174] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_block, 5, 0, 9),
-  [176] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_anim_block, 5, 0, 9),
-  [178] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
-  [180] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
-  [182] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_style_block_repeat1, 2, 0, 0),
-  [184] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_style_block_repeat1, 2, 0, 0), SHIFT_REPEAT(81),
-  [187] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_style_block_repeat1, 2, 0, 0), SHIFT_REPEAT(81),
-  [190] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
-  [192] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
-  [194] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
-  [196] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_constraint_line, 5, 0, 8),
-  [198] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_constraint_line, 5, 0, 8),
-  [200] = {.entry = {.count = 1, .reusable = true}}, SHIFT(71),
-  [202] = {.entry = {.count = 1, .reusable = false}}, SHIFT(47),
-  [204] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
-  [206] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
-  [208] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(71),
-  [211] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(47),
-  [214] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(44),
-  [217] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(97),
-  [220] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0),
-  [222] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(68),
-  [225] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(73),
-  [228] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(67),
-  [231] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(90),
-  [234] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_document, 1, 0, 0),
-  [236] = {.entry = {.count = 1, .reusable = true}}, SHIFT(63),
-  [238] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0),
-  [240] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0), SHIFT_REPEAT(80),
-  [243] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0), SHIFT_REPEAT(89),
-  [246] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
-  [248] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
-  [250] = {.entry = {.count = 1, .reusable = true}}, SHIFT(89),
-  [252] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
-  [254] = {.entry = {.count = 1, .reusable = true}}, SHIFT(34),
-  [256] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
-  [258] = {.entry = {.count = 1, .reusable = true}}, SHIFT(47),
-  [260] = {.entry = {.count = 1, .reusable = true}}, SHIFT(43),
-  [262] = {.entry = {.count = 1, .reusable = true}}, SHIFT(14),
-  [264] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
-  [266] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_block, 4, 0, 2),
-  [268] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_block, 5, 0, 2),
-  [270] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_item, 1, 0, 0),
-  [272] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_typed, 3, 0, 5),
-  [274] = {.entry = {.count = 1, .reusable = true}}, SHIFT(15),
-  [276] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
-  [278] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
-  [280] = {.entry = {.count = 1, .reusable = true}}, SHIFT(37),
-  [282] = {.entry = {.count = 1, .reusable = true}}, SHIFT(6),
-  [284] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_kind, 1, 0, 0),
-  [286] = {.entry = {.count = 1, .reusable = true}}, SHIFT(53),
-  [288] = {.entry = {.count = 1, .reusable = false}}, SHIFT(60),
-  [290] = {.entry = {.count = 1, .reusable = false}}, SHIFT(89),
-  [292] = {.entry = {.count = 1, .reusable = true}}, SHIFT(75),
-  [294] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
-  [296] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
-  [298] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
-  [300] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
-  [302] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
-  [304] = {.entry = {.count = 1, .reusable = true}}, SHIFT(40),
-  [306] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
-  [308] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [310] = {.entry = {.count = 1, .reusable = true}}, SHIFT(11),
-  [312] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_keyword, 1, 0, 0),
-  [314] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_property_name, 1, 0, 0),
-  [316] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
-  [318] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
-  [320] = {.entry = {.count = 1, .reusable = true}}, SHIFT(2),
-  [322] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
-  [324] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
-  [326] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
-  [328] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_trigger, 2, 0, 0),
-  [330] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
-  [332] = {.entry = {.count = 1, .reusable = true}}, SHIFT(65),
-  [334] = {.entry = {.count = 1, .reusable = true}}, SHIFT(50),
-  [336] = {.entry = {.count = 1, .reusable = true}}, SHIFT(56),
-  [338] = {.entry = {.count = 1, .reusable = true}}, SHIFT(36),
-  [340] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [342] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
-  [344] = {.entry = {.count = 1, .reusable = true}}, SHIFT(54),
-  [346] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
-  [348] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [7] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
+  [9] = {.entry = {.count = 1, .reusable = true}}, SHIFT_EXTRA(),
+  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(104),
+  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
+  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(99),
+  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
+  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(117),
+  [21] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_constraint_line, 4, 0, 11),
+  [23] = {.entry = {.count = 1, .reusable = false}}, SHIFT(17),
+  [25] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_constraint_line, 4, 0, 11),
+  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
+  [29] = {.entry = {.count = 1, .reusable = true}}, SHIFT(90),
+  [31] = {.entry = {.count = 1, .reusable = true}}, SHIFT(134),
+  [33] = {.entry = {.count = 1, .reusable = false}}, SHIFT(16),
+  [35] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_edge_property, 3, 0, 13),
+  [37] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_property, 3, 0, 13),
+  [39] = {.entry = {.count = 1, .reusable = true}}, SHIFT(73),
+  [41] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
+  [43] = {.entry = {.count = 1, .reusable = true}}, SHIFT(84),
+  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(133),
+  [47] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0), SHIFT_REPEAT(16),
+  [50] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0),
+  [52] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0),
+  [54] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0), SHIFT_REPEAT(4),
+  [57] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0), SHIFT_REPEAT(84),
+  [60] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_property_repeat1, 2, 0, 0), SHIFT_REPEAT(133),
+  [63] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_property, 3, 0, 13),
+  [65] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_property, 3, 0, 13),
+  [67] = {.entry = {.count = 1, .reusable = true}}, SHIFT(58),
+  [69] = {.entry = {.count = 1, .reusable = true}}, SHIFT(8),
+  [71] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_constraint_line, 5, 0, 14),
+  [73] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_constraint_line, 5, 0, 14),
+  [75] = {.entry = {.count = 1, .reusable = true}}, SHIFT(9),
+  [77] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_constraint_line, 5, 0, 11),
+  [79] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_constraint_line, 5, 0, 11),
+  [81] = {.entry = {.count = 1, .reusable = true}}, SHIFT(10),
+  [83] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(16),
+  [86] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0),
+  [88] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0),
+  [90] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(8),
+  [93] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(84),
+  [96] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_constraint_line, 6, 0, 14),
+  [98] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_constraint_line, 6, 0, 14),
+  [100] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(17),
+  [103] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(10),
+  [106] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_property_repeat1, 2, 0, 0), SHIFT_REPEAT(90),
+  [109] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_document, 1, 0, 0),
+  [111] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0),
+  [113] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(115),
+  [116] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(104),
+  [119] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(116),
+  [122] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(99),
+  [125] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(100),
+  [128] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_document_repeat1, 2, 0, 0), SHIFT_REPEAT(117),
+  [131] = {.entry = {.count = 1, .reusable = true}}, SHIFT(112),
+  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(44),
+  [135] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
+  [137] = {.entry = {.count = 1, .reusable = true}}, SHIFT(127),
+  [139] = {.entry = {.count = 1, .reusable = true}}, SHIFT(52),
+  [141] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0), SHIFT_REPEAT(112),
+  [144] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0),
+  [146] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0), SHIFT_REPEAT(99),
+  [149] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0), SHIFT_REPEAT(107),
+  [152] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0), SHIFT_REPEAT(117),
+  [155] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym__node_body_repeat1, 2, 0, 0), SHIFT_REPEAT(127),
+  [158] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__value_item, 1, 0, 0),
+  [160] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__value_item, 1, 0, 0),
+  [162] = {.entry = {.count = 1, .reusable = true}}, SHIFT(81),
+  [164] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
+  [166] = {.entry = {.count = 1, .reusable = true}}, SHIFT(82),
+  [168] = {.entry = {.count = 1, .reusable = true}}, SHIFT(92),
+  [170] = {.entry = {.count = 1, .reusable = true}}, SHIFT(66),
+  [172] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
+  [174] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_tuple, 2, 0, 0),
+  [176] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_tuple, 2, 0, 0),
+  [178] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_tuple, 3, 0, 0),
+  [180] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_tuple, 3, 0, 0),
+  [182] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_key_value_pair, 3, 0, 12),
+  [184] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_key_value_pair, 3, 0, 12),
+  [186] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_gradient, 3, 0, 16),
+  [188] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_gradient, 3, 0, 16),
+  [190] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_gradient, 4, 0, 16),
+  [192] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_gradient, 4, 0, 16),
+  [194] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_node_id, 2, 0, 0),
+  [196] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_id, 2, 0, 0),
+  [198] = {.entry = {.count = 1, .reusable = true}}, SHIFT(42),
+  [200] = {.entry = {.count = 1, .reusable = true}}, SHIFT(126),
+  [202] = {.entry = {.count = 1, .reusable = true}}, SHIFT(50),
+  [204] = {.entry = {.count = 1, .reusable = true}}, SHIFT(51),
+  [206] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 2, 0, 0), SHIFT_REPEAT(112),
+  [209] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 2, 0, 0),
+  [211] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 2, 0, 0), SHIFT_REPEAT(99),
+  [214] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 2, 0, 0), SHIFT_REPEAT(107),
+  [217] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 2, 0, 0), SHIFT_REPEAT(126),
+  [220] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
+  [222] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 1, 0, 1),
+  [224] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 2, 0, 0),
+  [226] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__typed_node, 2, 0, 2),
+  [228] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_declaration, 2, 0, 3),
+  [230] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 3, 0, 0),
+  [232] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_block, 3, 0, 0),
+  [234] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__typed_node, 3, 0, 5),
+  [236] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__node_body, 2, 0, 0),
+  [238] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__typed_node, 3, 0, 6),
+  [240] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_import_declaration, 4, 0, 7),
+  [242] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_block, 4, 0, 0),
+  [244] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_block, 4, 0, 8),
+  [246] = {.entry = {.count = 1, .reusable = true}}, SHIFT(16),
+  [248] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
+  [250] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_block, 4, 0, 0),
+  [252] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_block, 4, 0, 9),
+  [254] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__node_body, 3, 0, 0),
+  [256] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__typed_node, 4, 0, 10),
+  [258] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_style_block, 5, 0, 8),
+  [260] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_block, 5, 0, 9),
+  [262] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_body_item, 1, 0, 0),
+  [264] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_block, 4, 0, 15),
+  [266] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_property, 4, 0, 13),
+  [268] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_block, 5, 0, 15),
+  [270] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_edge_block_repeat1, 1, 0, 4),
+  [272] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
+  [274] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_edge_property, 4, 0, 13),
+  [276] = {.entry = {.count = 1, .reusable = true}}, SHIFT(41),
+  [278] = {.entry = {.count = 1, .reusable = true}}, SHIFT(124),
+  [280] = {.entry = {.count = 1, .reusable = true}}, SHIFT(79),
+  [282] = {.entry = {.count = 1, .reusable = true}}, SHIFT(47),
+  [284] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0),
+  [286] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0), SHIFT_REPEAT(124),
+  [289] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_spec_block_repeat1, 2, 0, 0), SHIFT_REPEAT(79),
+  [292] = {.entry = {.count = 1, .reusable = true}}, SHIFT(64),
+  [294] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
+  [296] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_item, 1, 0, 0),
+  [298] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_typed, 3, 0, 12),
+  [300] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
+  [302] = {.entry = {.count = 1, .reusable = true}}, SHIFT(27),
+  [304] = {.entry = {.count = 1, .reusable = true}}, SHIFT(13),
+  [306] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
+  [308] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
+  [310] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
+  [312] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
+  [314] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
+  [316] = {.entry = {.count = 1, .reusable = true}}, SHIFT(21),
+  [318] = {.entry = {.count = 1, .reusable = true}}, SHIFT(88),
+  [320] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
+  [322] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_gradient_repeat1, 2, 0, 0), SHIFT_REPEAT(87),
+  [325] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_gradient_repeat1, 2, 0, 0),
+  [327] = {.entry = {.count = 1, .reusable = true}}, SHIFT(24),
+  [329] = {.entry = {.count = 1, .reusable = true}}, SHIFT(18),
+  [331] = {.entry = {.count = 1, .reusable = true}}, SHIFT(113),
+  [333] = {.entry = {.count = 1, .reusable = true}}, SHIFT(91),
+  [335] = {.entry = {.count = 1, .reusable = true}}, SHIFT(25),
+  [337] = {.entry = {.count = 1, .reusable = true}}, SHIFT(26),
+  [339] = {.entry = {.count = 1, .reusable = true}}, SHIFT(93),
+  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(28),
+  [343] = {.entry = {.count = 1, .reusable = true}}, SHIFT(29),
+  [345] = {.entry = {.count = 1, .reusable = true}}, SHIFT(48),
+  [347] = {.entry = {.count = 1, .reusable = true}}, SHIFT(54),
+  [349] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_style_block_repeat1, 2, 0, 0),
+  [351] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_style_block_repeat1, 2, 0, 0), SHIFT_REPEAT(127),
+  [354] = {.entry = {.count = 1, .reusable = true}}, SHIFT(57),
+  [356] = {.entry = {.count = 1, .reusable = true}}, SHIFT(59),
+  [358] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_node_kind, 1, 0, 0),
+  [360] = {.entry = {.count = 1, .reusable = true}}, SHIFT(32),
+  [362] = {.entry = {.count = 1, .reusable = true}}, SHIFT(122),
+  [364] = {.entry = {.count = 1, .reusable = true}}, SHIFT(109),
+  [366] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
+  [368] = {.entry = {.count = 1, .reusable = true}}, SHIFT(74),
+  [370] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
+  [372] = {.entry = {.count = 1, .reusable = true}}, SHIFT(129),
+  [374] = {.entry = {.count = 1, .reusable = true}}, SHIFT(80),
+  [376] = {.entry = {.count = 1, .reusable = true}}, SHIFT(77),
+  [378] = {.entry = {.count = 1, .reusable = true}}, SHIFT(61),
+  [380] = {.entry = {.count = 1, .reusable = true}}, SHIFT(119),
+  [382] = {.entry = {.count = 1, .reusable = true}}, SHIFT(120),
+  [384] = {.entry = {.count = 1, .reusable = true}}, SHIFT(105),
+  [386] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
+  [388] = {.entry = {.count = 1, .reusable = true}}, SHIFT(123),
+  [390] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
+  [392] = {.entry = {.count = 1, .reusable = true}}, SHIFT(34),
+  [394] = {.entry = {.count = 1, .reusable = true}}, SHIFT(128),
+  [396] = {.entry = {.count = 1, .reusable = true}}, SHIFT(46),
+  [398] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_spec_keyword, 1, 0, 0),
+  [400] = {.entry = {.count = 1, .reusable = true}}, SHIFT(110),
+  [402] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
+  [404] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
+  [406] = {.entry = {.count = 1, .reusable = true}}, SHIFT(2),
+  [408] = {.entry = {.count = 1, .reusable = true}}, SHIFT(131),
+  [410] = {.entry = {.count = 1, .reusable = true}}, SHIFT(97),
+  [412] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_anim_trigger, 2, 0, 0),
+  [414] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
+  [416] = {.entry = {.count = 1, .reusable = true}}, SHIFT(30),
+  [418] = {.entry = {.count = 1, .reusable = true}}, SHIFT(31),
+};
+
+static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
+  [ts_external_token_property_name] = sym_property_name,
+  [ts_external_token_string] = sym_string,
+  [ts_external_token_spec_text] = sym_spec_text,
+  [ts_external_token__error_sentinel] = sym__error_sentinel,
+};
+
+static const bool ts_external_scanner_states[6][EXTERNAL_TOKEN_COUNT] = {
+  [1] = {
+    [ts_external_token_property_name] = true,
+    [ts_external_token_string] = true,
+    [ts_external_token_spec_text] = true,
+    [ts_external_token__error_sentinel] = true,
+  },
+  [2] = {
+    [ts_external_token_string] = true,
+  },
+  [3] = {
+    [ts_external_token_property_name] = true,
+    [ts_external_token_string] = true,
+  },
+  [4] = {
+    [ts_external_token_property_name] = true,
+  },
+  [5] = {
+    [ts_external_token_string] = true,
+    [ts_external_token_spec_text] = true,
+  },
 };
 
 #ifdef __cplusplus
 extern "C" {
 #endif
+void *tree_sitter_fd_external_scanner_create(void);
+void tree_sitter_fd_external_scanner_destroy(void *);
+bool tree_sitter_fd_external_scanner_scan(void *, TSLexer *, const bool *);
+unsigned tree_sitter_fd_external_scanner_serialize(void *, char *);
+void tree_sitter_fd_external_scanner_deserialize(void *, const char *, unsigned);
+
 #ifdef TREE_SITTER_HIDE_SYMBOLS
 #define TS_PUBLIC
 #elif defined(_WIN32)
@@ -5461,7 +4054,6 @@ TS_PUBLIC const TSLanguage *tree_sitter_fd(void) {
     .state_count = STATE_COUNT,
     .large_state_count = LARGE_STATE_COUNT,
     .production_id_count = PRODUCTION_ID_COUNT,
-    .supertype_count = SUPERTYPE_COUNT,
     .field_count = FIELD_COUNT,
     .max_alias_sequence_length = MAX_ALIAS_SEQUENCE_LENGTH,
     .parse_table = &ts_parse_table[0][0],
@@ -5478,14 +4070,18 @@ TS_PUBLIC const TSLanguage *tree_sitter_fd(void) {
     .alias_sequences = &ts_alias_sequences[0][0],
     .lex_modes = (const void*)ts_lex_modes,
     .lex_fn = ts_lex,
-    .primary_state_ids = ts_primary_state_ids,
-    .name = "fd",
-    .max_reserved_word_set_size = 0,
-    .metadata = {
-      .major_version = 0,
-      .minor_version = 1,
-      .patch_version = 0,
+    .keyword_lex_fn = ts_lex_keywords,
+    .keyword_capture_token = sym_identifier,
+    .external_scanner = {
+      &ts_external_scanner_states[0][0],
+      ts_external_scanner_symbol_map,
+      tree_sitter_fd_external_scanner_create,
+      tree_sitter_fd_external_scanner_destroy,
+      tree_sitter_fd_external_scanner_scan,
+      tree_sitter_fd_external_scanner_serialize,
+      tree_sitter_fd_external_scanner_deserialize,
     },
+    .primary_state_ids = ts_primary_state_ids,
   };
   return &language;
 }
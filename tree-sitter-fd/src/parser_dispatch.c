@@ -0,0 +1,9 @@
+// parser.c compiled with the jump-table ADVANCE_MAP from advance_map.h.
+//
+// Build this file in place of parser.c. parser.h is include-guarded, so the
+// override below survives parser.c's own `#include "tree_sitter/parser.h"`
+// and stays intact across `tree-sitter generate`.
+
+#include "advance_map.h"
+
+#include "parser.c"
@@ -0,0 +1,139 @@
+// External scanner for tree-sitter-fd.
+//
+// Tokens the generated lexer cannot express: ones that depend on what
+// follows them, strings with escapes, and spec prose with nested braces.
+// Must stay in sync with `externals` in grammar.js.
+//
+// The scanner keeps no state between tokens; everything it needs is inside
+// the token being scanned. Serialization is therefore empty, and an edit
+// inside a long spec block only relexes the tokens it touches.
+
+#include "tree_sitter/parser.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum TokenType {
+  PROPERTY_NAME,
+  STRING,
+  SPEC_TEXT,
+  ERROR_SENTINEL, // only valid during error recovery
+};
+
+static bool is_identifier_start(int32_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static bool is_identifier_char(int32_t c) {
+  return is_identifier_start(c) || (c >= '0' && c <= '9');
+}
+
+static bool is_blank(int32_t c) {
+  return c == ' ' || c == '\t';
+}
+
+static bool is_space(int32_t c) {
+  return is_blank(c) || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// `name:` with no space before the colon. The token ends before the colon,
+// which the grammar matches as its own ":" token. Anything else (values,
+// `when :hover`, child node keywords) is left to the generated lexer.
+static bool scan_property_name(TSLexer *lexer) {
+  if (!is_identifier_start(lexer->lookahead)) return false;
+  while (is_identifier_char(lexer->lookahead)) lexer->advance(lexer, false);
+  lexer->mark_end(lexer);
+  if (lexer->lookahead != ':') return false;
+  lexer->result_symbol = PROPERTY_NAME;
+  return true;
+}
+
+// `"..."` with `\x` escapes. The body may contain newlines; an unterminated
+// string is not a token, so the generated lexer reports the error.
+static bool scan_string(TSLexer *lexer) {
+  lexer->advance(lexer, false);
+  for (;;) {
+    int32_t c = lexer->lookahead;
+    if (c == '"') {
+      lexer->advance(lexer, false);
+      lexer->result_symbol = STRING;
+      return true;
+    }
+    if (lexer->eof(lexer)) return false;
+    if (c == '\\') {
+      lexer->advance(lexer, false);
+      if (lexer->eof(lexer)) return false;
+    }
+    lexer->advance(lexer, false);
+  }
+}
+
+// Unquoted spec value: the rest of the line, trailing blanks trimmed.
+// `{...}` pairs are part of the prose; an unmatched `}` ends the value so
+// the spec block can close on the same line.
+static bool scan_spec_text(TSLexer *lexer) {
+  uint32_t depth = 0;
+  bool has_content = false;
+  for (;;) {
+    int32_t c = lexer->lookahead;
+    if (c == '\n' || c == '\r' || lexer->eof(lexer)) break;
+    if (c == '}') {
+      if (depth == 0) break;
+      depth--;
+    } else if (c == '{') {
+      depth++;
+    }
+    lexer->advance(lexer, false);
+    if (!is_blank(c)) {
+      lexer->mark_end(lexer);
+      has_content = true;
+    }
+  }
+  if (!has_content) return false;
+  lexer->result_symbol = SPEC_TEXT;
+  return true;
+}
+
+// ─── Entry points ─────────────────────────────────────────────
+
+void *tree_sitter_fd_external_scanner_create(void) {
+  return NULL;
+}
+
+void tree_sitter_fd_external_scanner_destroy(void *payload) {
+  (void)payload;
+}
+
+unsigned tree_sitter_fd_external_scanner_serialize(void *payload, char *buffer) {
+  (void)payload;
+  (void)buffer;
+  return 0;
+}
+
+void tree_sitter_fd_external_scanner_deserialize(void *payload, const char *buffer,
+                                                 unsigned length) {
+  (void)payload;
+  (void)buffer;
+  (void)length;
+}
+
+bool tree_sitter_fd_external_scanner_scan(void *payload, TSLexer *lexer,
+                                          const bool *valid_symbols) {
+  (void)payload;
+  // Error recovery marks every token valid; spec text would swallow whole
+  // lines there, so only offer the tokens that are unambiguous.
+  bool recovering = valid_symbols[ERROR_SENTINEL];
+
+  if (valid_symbols[SPEC_TEXT] && !recovering) {
+    while (is_blank(lexer->lookahead)) lexer->advance(lexer, true);
+    if (lexer->lookahead != '"') return scan_spec_text(lexer);
+  }
+
+  while (is_space(lexer->lookahead)) lexer->advance(lexer, true);
+
+  if (lexer->lookahead == '"') {
+    return valid_symbols[STRING] && scan_string(lexer);
+  }
+  if (valid_symbols[PROPERTY_NAME]) return scan_property_name(lexer);
+  return false;
+}